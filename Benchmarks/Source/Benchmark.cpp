@@ -0,0 +1,259 @@
+#include "Framework.h"
+
+#include "Benchmark.h"
+
+#include "../../Framework/Libraries/rapidjson/prettywriter.h"
+#include "../../Framework/Libraries/rapidjson/stringbuffer.h"
+
+#include <algorithm>
+#include <sstream>
+
+#if _MSC_VER
+const void* volatile g_pBenchmarkSink = nullptr;
+#endif
+
+BenchmarkRunner::BenchmarkRunner()
+{
+}
+
+void BenchmarkRunner::Add(const char* name, BenchmarkFunc func)
+{
+    Benchmark benchmark;
+    benchmark.name = name;
+    benchmark.func = func;
+    m_Benchmarks.push_back( benchmark );
+}
+
+void BenchmarkRunner::AddCheck(const char* name, CheckFunc func)
+{
+    Check check;
+    check.name = name;
+    check.func = func;
+    m_Checks.push_back( check );
+}
+
+bool BenchmarkRunner::ParseCommandLine(int argc, char** argv)
+{
+    for( int i=1; i<argc; i++ )
+    {
+        std::string arg = argv[i];
+        bool hasValue = i+1 < argc;
+
+        if( arg == "--filter" && hasValue )
+            m_Filter = argv[++i];
+        else if( arg == "--reps" && hasValue )
+            m_Repetitions = (unsigned int)atoi( argv[++i] );
+        else if( arg == "--warmup" && hasValue )
+            m_WarmupRepetitions = (unsigned int)atoi( argv[++i] );
+        else if( arg == "--min-time" && hasValue )
+            m_MinRepetitionTime = atof( argv[++i] ) / 1000;
+        else if( arg == "--json" && hasValue )
+            m_JSONFilename = argv[++i];
+        else if( arg == "--csv" && hasValue )
+            m_CSVFilename = argv[++i];
+        else if( arg == "--list" )
+            m_ListOnly = true;
+        else if( arg == "--check" )
+            m_RunChecks = true;
+        else
+        {
+            printf( "Unknown or incomplete option: %s\n", arg.c_str() );
+            printf( "Options: --filter <text> --reps <count> --warmup <count> --min-time <ms> --json <file> --csv <file> --list --check\n" );
+            return false;
+        }
+    }
+
+    if( m_Repetitions == 0 )
+        m_Repetitions = 1;
+
+    return true;
+}
+
+int BenchmarkRunner::Run()
+{
+    if( m_RunChecks )
+        return RunChecks();
+
+    m_Results.clear();
+
+    if( m_ListOnly == false )
+        printf( "%-40s %10s %12s %12s %12s %12s\n", "Benchmark", "Iterations", "Median ns", "Min ns", "p90 ns", "p99 ns" );
+
+    for( const Benchmark& benchmark : m_Benchmarks )
+    {
+        if( m_Filter.empty() == false && benchmark.name.find( m_Filter ) == std::string::npos )
+            continue;
+
+        if( m_ListOnly )
+        {
+            printf( "%s\n", benchmark.name.c_str() );
+            continue;
+        }
+
+        BenchmarkResult result = Measure( benchmark );
+        m_Results.push_back( result );
+
+        printf( "%-40s %10u %12.2f %12.2f %12.2f %12.2f\n", result.name.c_str(), result.iterations,
+                result.medianNs, result.minNs, result.p90Ns, result.p99Ns );
+        fflush( stdout );
+    }
+
+    bool succeeded = true;
+    if( m_JSONFilename.empty() == false )
+        succeeded &= WriteJSON( m_JSONFilename.c_str() );
+    if( m_CSVFilename.empty() == false )
+        succeeded &= WriteCSV( m_CSVFilename.c_str() );
+
+    return succeeded ? 0 : 1;
+}
+
+int BenchmarkRunner::RunChecks()
+{
+    unsigned int numRun = 0;
+    unsigned int numFailed = 0;
+
+    for( const Check& check : m_Checks )
+    {
+        if( m_Filter.empty() == false && check.name.find( m_Filter ) == std::string::npos )
+            continue;
+
+        if( m_ListOnly )
+        {
+            printf( "%s\n", check.name.c_str() );
+            continue;
+        }
+
+        bool passed = check.func();
+
+        printf( "%s %s\n", passed ? "PASS" : "FAIL", check.name.c_str() );
+        fflush( stdout );
+
+        numRun++;
+        if( passed == false )
+            numFailed++;
+    }
+
+    if( m_ListOnly == false )
+        printf( "%u of %u checks passed\n", numRun - numFailed, numRun );
+
+    return numFailed == 0 ? 0 : 1;
+}
+
+BenchmarkResult BenchmarkRunner::Measure(const Benchmark& benchmark)
+{
+    // A run of zero iterations first, so data a benchmark creates on first use isn't timed.
+    benchmark.func( 0 );
+
+    // Double the iterations until one repetition is long enough for the timer to be accurate.
+    unsigned int iterations = 1;
+    while( true )
+    {
+        double startTime = fw::GetSystemTime();
+        benchmark.func( iterations );
+        double time = fw::GetSystemTime() - startTime;
+
+        if( time >= m_MinRepetitionTime || iterations >= (1u << 30) )
+            break;
+
+        iterations *= 2;
+    }
+
+    // Warm the caches and branch predictors with the final count.
+    for( unsigned int i=0; i<m_WarmupRepetitions; i++ )
+    {
+        benchmark.func( iterations );
+    }
+
+    std::vector<double> times;
+    times.reserve( m_Repetitions );
+
+    for( unsigned int i=0; i<m_Repetitions; i++ )
+    {
+        double startTime = fw::GetSystemTime();
+        benchmark.func( iterations );
+        times.push_back( (fw::GetSystemTime() - startTime) * 1e9 / iterations );
+    }
+
+    std::sort( times.begin(), times.end() );
+
+    double total = 0;
+    for( double time : times )
+        total += time;
+
+    // Nearest rank percentiles.
+    auto percentile = [&times](unsigned int p) { return times[(times.size() * p + 99) / 100 - 1]; };
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = iterations;
+    result.repetitions = m_Repetitions;
+    result.minNs = times.front();
+    result.medianNs = percentile( 50 );
+    result.meanNs = total / times.size();
+    result.p90Ns = percentile( 90 );
+    result.p99Ns = percentile( 99 );
+    result.maxNs = times.back();
+
+    return result;
+}
+
+bool BenchmarkRunner::WriteJSON(const char* filename)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer( buffer );
+
+    writer.StartObject();
+    writer.Key( "repetitions" );        writer.Uint( m_Repetitions );
+    writer.Key( "warmupRepetitions" );  writer.Uint( m_WarmupRepetitions );
+    writer.Key( "minRepetitionMs" );    writer.Double( m_MinRepetitionTime * 1000 );
+
+    writer.Key( "benchmarks" );
+    writer.StartArray();
+    for( const BenchmarkResult& result : m_Results )
+    {
+        writer.StartObject();
+        writer.Key( "name" );           writer.String( result.name.c_str() );
+        writer.Key( "iterations" );     writer.Uint( result.iterations );
+        writer.Key( "repetitions" );    writer.Uint( result.repetitions );
+        writer.Key( "minNs" );          writer.Double( result.minNs );
+        writer.Key( "medianNs" );       writer.Double( result.medianNs );
+        writer.Key( "meanNs" );         writer.Double( result.meanNs );
+        writer.Key( "p90Ns" );          writer.Double( result.p90Ns );
+        writer.Key( "p99Ns" );          writer.Double( result.p99Ns );
+        writer.Key( "maxNs" );          writer.Double( result.maxNs );
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.EndObject();
+
+    if( fw::SaveCompleteFile( filename, (const unsigned char*)buffer.GetString(), buffer.GetSize() ) == false )
+    {
+        printf( "Failed to write %s\n", filename );
+        return false;
+    }
+
+    return true;
+}
+
+bool BenchmarkRunner::WriteCSV(const char* filename)
+{
+    std::ostringstream stream;
+    stream << "name,iterations,repetitions,minNs,medianNs,meanNs,p90Ns,p99Ns,maxNs\n";
+
+    for( const BenchmarkResult& result : m_Results )
+    {
+        stream << result.name << ',' << result.iterations << ',' << result.repetitions << ','
+               << result.minNs << ',' << result.medianNs << ',' << result.meanNs << ','
+               << result.p90Ns << ',' << result.p99Ns << ',' << result.maxNs << '\n';
+    }
+
+    std::string csv = stream.str();
+    if( fw::SaveCompleteFile( filename, (const unsigned char*)csv.c_str(), csv.size() ) == false )
+    {
+        printf( "Failed to write %s\n", filename );
+        return false;
+    }
+
+    return true;
+}
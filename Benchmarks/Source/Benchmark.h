@@ -0,0 +1,102 @@
+#pragma once
+
+#include <functional>
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+// A small benchmark harness for the framework, no window or GL context needed.
+//
+// Each benchmark is a function that runs its work a given number of times. The runner picks
+// that count so one repetition takes at least m_MinRepetitionTime, runs a few warmup
+// repetitions, then times m_Repetitions of them and reports the time per iteration.
+//
+// Checks sit next to the benchmarks for the same code and make sure its results are right,
+// --check runs them instead of the benchmarks.
+
+// Runs the measured work 'iterations' times.
+typedef std::function<void(unsigned int iterations)> BenchmarkFunc;
+
+// Returns false if the check failed, after printing why (see CHECK).
+typedef std::function<bool()> CheckFunc;
+
+// Times are nanoseconds per iteration, over all the timed repetitions.
+struct BenchmarkResult
+{
+    std::string name;
+    unsigned int iterations = 0;    // Per repetition.
+    unsigned int repetitions = 0;
+    double minNs = 0;
+    double medianNs = 0;
+    double meanNs = 0;
+    double p90Ns = 0;
+    double p99Ns = 0;
+    double maxNs = 0;
+};
+
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner();
+
+    void Add(const char* name, BenchmarkFunc func);
+    void AddCheck(const char* name, CheckFunc func);
+
+    // --filter <text> --reps <count> --warmup <count> --min-time <ms> --json <file> --csv <file> --list --check
+    bool ParseCommandLine(int argc, char** argv);
+
+    // Returns the process exit code, non-zero if a check failed.
+    int Run();
+
+protected:
+    struct Benchmark
+    {
+        std::string name;
+        BenchmarkFunc func;
+    };
+
+    struct Check
+    {
+        std::string name;
+        CheckFunc func;
+    };
+
+    int RunChecks();
+    BenchmarkResult Measure(const Benchmark& benchmark);
+
+    bool WriteJSON(const char* filename);
+    bool WriteCSV(const char* filename);
+
+protected:
+    std::vector<Benchmark> m_Benchmarks;
+    std::vector<Check> m_Checks;
+    std::vector<BenchmarkResult> m_Results;
+
+    std::string m_Filter;
+    unsigned int m_Repetitions = 30;
+    unsigned int m_WarmupRepetitions = 3;
+    double m_MinRepetitionTime = 0.002;
+    std::string m_JSONFilename;
+    std::string m_CSVFilename;
+    bool m_ListOnly = false;
+    bool m_RunChecks = false;
+};
+
+// Fails the enclosing check if condition doesn't hold.
+#define CHECK( condition ) \
+    do { if( !(condition) ) { printf( "    %s(%d): %s\n", __FILE__, __LINE__, #condition ); return false; } } while( 0 )
+
+// Keeps the compiler from throwing away work whose result is never used.
+// Also acts as a compiler barrier, so anything in memory is read again after it.
+#if _MSC_VER
+extern const void* volatile g_pBenchmarkSink;
+template<typename Type> inline void DoNotOptimize(const Type& value) { g_pBenchmarkSink = &value; _ReadWriteBarrier(); }
+#else
+template<typename Type> inline void DoNotOptimize(const Type& value) { asm volatile( "" : : "r"( &value ) : "memory" ); }
+#endif
+
+// Each file of benchmarks registers itself from main().
+void RegisterMathBenchmarks(BenchmarkRunner& runner);
+void RegisterRandomBenchmarks(BenchmarkRunner& runner);
+void RegisterManagerBenchmarks(BenchmarkRunner& runner);
+void RegisterCullingBenchmarks(BenchmarkRunner& runner);
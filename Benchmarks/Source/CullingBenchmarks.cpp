@@ -0,0 +1,190 @@
+#include "Framework.h"
+
+#include "Benchmark.h"
+#include "Objects/OcclusionCuller.h"
+
+#include <memory>
+
+using namespace fw;
+
+static const unsigned int c_NumOccluders = 64;
+static const unsigned int c_NumTestedObjects = 1024;
+
+static const vec3 c_CameraPosition( 0, 0, 10 );
+
+static matrix CreateViewProj()
+{
+    matrix view;
+    view.CreateLookAtView( c_CameraPosition, vec3( 0, 1, 0 ), vec3( 0, 0, 0 ) );
+
+    matrix proj;
+    proj.CreatePerspectiveVFoV( 45.0f, 2.0f, 0.01f, 100.0f );
+
+    return proj * view;
+}
+
+static matrix CreateTranslation(vec3 position)
+{
+    matrix world;
+    world.CreateSRT( vec3( 1, 1, 1 ), vec3( 0, 0, 0 ), position );
+    return world;
+}
+
+// A unit cube centered on the origin, the same shape the test bounds describe.
+static void CreateBox(std::vector<vec3>& positions, std::vector<unsigned int>& indices)
+{
+    for( int i=0; i<8; i++ )
+        positions.push_back( vec3( (i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f ) );
+
+    const unsigned int faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+    for( const unsigned int* face : faces )
+    {
+        unsigned int quad[6] = { face[0], face[1], face[2], face[0], face[2], face[3] };
+        indices.insert( indices.end(), quad, quad + 6 );
+    }
+}
+
+struct CullingInputs
+{
+    OcclusionCuller culler;
+    matrix viewProj;
+
+    std::vector<vec3> boxPositions;
+    std::vector<unsigned int> boxIndices;
+
+    std::vector<matrix> occluderTransforms;
+    std::vector<matrix> objectTransforms;
+};
+
+// Walls of boxes scattered in front of the camera, with smaller objects spread out behind and between them.
+static std::shared_ptr<CullingInputs> CreateCullingInputs()
+{
+    std::shared_ptr<CullingInputs> pInputs = std::make_shared<CullingInputs>();
+    Random::Generator random( 0 );
+
+    pInputs->viewProj = CreateViewProj();
+    CreateBox( pInputs->boxPositions, pInputs->boxIndices );
+
+    for( unsigned int i=0; i<c_NumOccluders; i++ )
+    {
+        vec3 scale( random.GetFloat( 2.0f, 6.0f ), random.GetFloat( 2.0f, 6.0f ), 0.5f );
+        vec3 rotation( 0, random.GetFloat( -45.0f, 45.0f ), 0 );
+        vec3 position( random.GetFloat( -20.0f, 20.0f ), random.GetFloat( -5.0f, 5.0f ), random.GetFloat( -30.0f, 0.0f ) );
+
+        matrix world;
+        world.CreateSRT( scale, rotation, position );
+        pInputs->occluderTransforms.push_back( world );
+    }
+
+    for( unsigned int i=0; i<c_NumTestedObjects; i++ )
+    {
+        vec3 position( random.GetFloat( -30.0f, 30.0f ), random.GetFloat( -8.0f, 8.0f ), random.GetFloat( -60.0f, 0.0f ) );
+        pInputs->objectTransforms.push_back( CreateTranslation( position ) );
+    }
+
+    return pInputs;
+}
+
+static void RasterizeOccluders(CullingInputs& inputs)
+{
+    inputs.culler.Begin( inputs.viewProj );
+
+    for( const matrix& world : inputs.occluderTransforms )
+        inputs.culler.RasterizeOccluder( world, inputs.boxPositions, inputs.boxIndices );
+
+    inputs.culler.BuildHierarchy();
+}
+
+static void RegisterOcclusionBenchmarks(BenchmarkRunner& runner)
+{
+    std::shared_ptr<CullingInputs> pInputs = CreateCullingInputs();
+
+    runner.Add( "OcclusionCuller/Rasterize x64", [pInputs](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            RasterizeOccluders( *pInputs );
+            DoNotOptimize( pInputs->culler.GetDepthBuffer( 0 )[0] );
+        }
+    } );
+
+    runner.Add( "OcclusionCuller/IsVisible x1024", [pInputs](unsigned int iterations)
+    {
+        if( iterations == 0 )
+            RasterizeOccluders( *pInputs );
+
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            unsigned int numVisible = 0;
+            for( const matrix& world : pInputs->objectTransforms )
+            {
+                if( pInputs->culler.IsVisible( world, vec3( -0.5f ), vec3( 0.5f ) ) )
+                    numVisible++;
+            }
+            DoNotOptimize( numVisible );
+        }
+    } );
+}
+
+static void RegisterOcclusionChecks(BenchmarkRunner& runner)
+{
+    // A single 4x4 wall at the origin, with the camera 10 units in front of it.
+    runner.AddCheck( "OcclusionCuller/Visibility", []()
+    {
+        std::vector<vec3> wallPositions = { vec3( -2, -2, 0 ), vec3( 2, -2, 0 ), vec3( 2, 2, 0 ), vec3( -2, 2, 0 ) };
+        std::vector<unsigned int> wallIndices = { 0, 1, 2, 0, 2, 3 };
+
+        OcclusionCuller culler;
+        culler.Begin( CreateViewProj() );
+        culler.RasterizeOccluder( CreateTranslation( vec3( 0, 0, 0 ) ), wallPositions, wallIndices );
+        culler.BuildHierarchy();
+
+        CHECK( culler.GetStats().trianglesRasterized == 2 );
+
+        vec3 boundsMin( -0.5f );
+        vec3 boundsMax( 0.5f );
+
+        // Right behind the wall.
+        CHECK( culler.IsVisible( CreateTranslation( vec3( 0, 0, -5 ) ), boundsMin, boundsMax ) == false );
+
+        // Between the camera and the wall.
+        CHECK( culler.IsVisible( CreateTranslation( vec3( 0, 0, 5 ) ), boundsMin, boundsMax ) );
+
+        // Behind the wall's depth, but off to the side of it.
+        CHECK( culler.IsVisible( CreateTranslation( vec3( 6, 0, -5 ) ), boundsMin, boundsMax ) );
+
+        // Half behind the wall, half sticking out past its edge.
+        CHECK( culler.IsVisible( CreateTranslation( vec3( 3, 0, -5 ) ), boundsMin, boundsMax ) );
+
+        // Around the camera, crossing the near plane.
+        CHECK( culler.IsVisible( CreateTranslation( c_CameraPosition ), boundsMin, boundsMax ) );
+
+        CHECK( culler.GetStats().objectsTested == 5 );
+        CHECK( culler.GetStats().objectsCulled == 1 );
+
+        return true;
+    } );
+
+    // Occluder triangles crossing the near plane are skipped instead of clipped, so they can't hide anything.
+    runner.AddCheck( "OcclusionCuller/NearPlaneOccluder", []()
+    {
+        std::vector<vec3> floorPositions = { vec3( -2, -2, -20 ), vec3( 2, -2, -20 ), vec3( 2, 2, 20 ), vec3( -2, 2, 20 ) };
+        std::vector<unsigned int> floorIndices = { 0, 1, 2, 0, 2, 3 };
+
+        OcclusionCuller culler;
+        culler.Begin( CreateViewProj() );
+        culler.RasterizeOccluder( CreateTranslation( vec3( 0, 0, 0 ) ), floorPositions, floorIndices );
+        culler.BuildHierarchy();
+
+        CHECK( culler.GetStats().trianglesRasterized == 0 );
+        CHECK( culler.IsVisible( CreateTranslation( vec3( 0, 0, -30 ) ), vec3( -0.5f ), vec3( 0.5f ) ) );
+
+        return true;
+    } );
+}
+
+void RegisterCullingBenchmarks(BenchmarkRunner& runner)
+{
+    RegisterOcclusionBenchmarks( runner );
+    RegisterOcclusionChecks( runner );
+}
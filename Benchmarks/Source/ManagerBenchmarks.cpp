@@ -0,0 +1,886 @@
+#include "Framework.h"
+
+#include "Benchmark.h"
+
+#include <memory>
+
+using namespace fw;
+
+// The bulk benchmarks below do a whole set per iteration, divide by the count for the cost per element.
+static const unsigned int c_NumComponents = 1024;
+static const unsigned int c_NumEntities = 100000;
+static const unsigned int c_NumSpawned = 10000;
+static const unsigned int c_NumEvents = 256;
+static const unsigned int c_NumListeners = 4;
+static const unsigned int c_NumResources = 256;
+static const unsigned int c_NumJobElements = 1000000;
+static const unsigned int c_NumJobDraws = 10000;
+static const unsigned int c_NumJobLights = 8;
+
+// Past the core count the extra threads just take turns, those runs show what oversubscribing costs.
+static const unsigned int c_JobThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+static const unsigned int c_NumJobThreadCounts = sizeof( c_JobThreadCounts ) / sizeof( c_JobThreadCounts[0] );
+
+struct ComponentInputs
+{
+    ComponentManager manager;
+    std::vector<std::unique_ptr<TransformComponent>> transforms;
+};
+
+// Just enough of a game to hold a scene full of GameObjects.
+class BenchmarkGame : public GameCore
+{
+public:
+    virtual void OnEvent(Event* pEvent) override {}
+    virtual void StartFrame(float deltaTime) override {}
+    virtual void Update(float deltaTime) override {}
+    virtual void Draw() override {}
+};
+
+class BenchmarkScene : public Scene
+{
+public:
+    BenchmarkScene(GameCore* pGame) : Scene( pGame ) {}
+
+    virtual void StartFrame(float deltaTime) override {}
+
+    size_t GetNumObjects() { return m_Objects.GetSize(); }
+    GameObject* GetObjectAt(size_t index) { return m_Objects[index]; }
+};
+
+// Looks at every mesh's world position, like game logic that only reads the scene.
+class MeshPositionSystem : public System
+{
+public:
+    MeshPositionSystem() : System( "MeshPositionSystem" ) { Reads<MeshComponent>(); }
+
+    virtual void Update(ComponentManager* pManager, float deltaTime) override
+    {
+        ForEach<MeshComponent>( pManager, [](MeshComponent* pMesh) { DoNotOptimize( pMesh->GetGameObject()->GetTransform()->GetWorldPosition() ); }, 1024 );
+    }
+};
+
+class CountingListener : public EventListener
+{
+public:
+    virtual void OnEvent(Event* pEvent) override { m_Count++; }
+
+    unsigned int m_Count = 0;
+};
+
+static std::shared_ptr<ComponentInputs> CreateComponents(unsigned int count)
+{
+    std::shared_ptr<ComponentInputs> pInputs = std::make_shared<ComponentInputs>();
+
+    Random::Generator random( 0 );
+    for( unsigned int i=0; i<count; i++ )
+    {
+        vec3 pos( random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ) );
+        vec3 rot( random.GetFloat( -180.0f, 180.0f ), random.GetFloat( -180.0f, 180.0f ), random.GetFloat( -180.0f, 180.0f ) );
+        pInputs->transforms.push_back( std::unique_ptr<TransformComponent>( new TransformComponent( pos, rot, vec3( 1, 1, 1 ) ) ) );
+    }
+
+    return pInputs;
+}
+
+static void AddComponentBenchmarks(BenchmarkRunner& runner, unsigned int count, const char* suffix)
+{
+    std::shared_ptr<ComponentInputs> pInputs = CreateComponents( count );
+
+    runner.Add( ("ComponentManager/AddRemove " + std::string( suffix )).c_str(), [pInputs](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( std::unique_ptr<TransformComponent>& pTransform : pInputs->transforms )
+                pInputs->manager.AddComponent( pTransform.get() );
+
+            for( std::unique_ptr<TransformComponent>& pTransform : pInputs->transforms )
+                pInputs->manager.RemoveComponent( pTransform.get() );
+        }
+    } );
+
+    // The rest run over a manager that holds all of its components.
+    std::shared_ptr<ComponentInputs> pFilled = CreateComponents( count );
+    for( std::unique_ptr<TransformComponent>& pTransform : pFilled->transforms )
+        pFilled->manager.AddComponent( pTransform.get() );
+
+    runner.Add( ("ComponentManager/Iterate " + std::string( suffix )).c_str(), [pFilled](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            vec3 total;
+            for( Component* pComponent : pFilled->manager.GetComponentsOfType( TransformComponent::GetStaticType() ) )
+                total += static_cast<TransformComponent*>( pComponent )->GetPosition();
+            DoNotOptimize( total );
+        }
+    } );
+
+    runner.Add( ("ComponentManager/UpdateTransforms " + std::string( suffix )).c_str(), [pFilled](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( Component* pComponent : pFilled->manager.GetComponentsOfType( TransformComponent::GetStaticType() ) )
+            {
+                TransformComponent* pTransform = static_cast<TransformComponent*>( pComponent );
+                pTransform->SetRotation( pTransform->GetRotation() + vec3( 0, 1, 0 ) );
+                pTransform->UpdateWorldTransform();
+            }
+            DoNotOptimize( pFilled->transforms[0]->GetWorldTransform() );
+        }
+    } );
+}
+
+struct EntityInputs
+{
+    std::unique_ptr<BenchmarkGame> pGame;
+    std::unique_ptr<BenchmarkScene> pScene;
+    std::vector<GameObject*> objects;
+    std::vector<GameObject*> shuffled;
+    bool hasSystems = false;
+
+    // Created on first use, like the resources, the game's ResourceManager needs the data folder.
+    ComponentManager* Get()
+    {
+        if( pScene == nullptr )
+        {
+            pGame.reset( new BenchmarkGame() );
+            pScene.reset( new BenchmarkScene( pGame.get() ) );
+
+            Random::Generator random( 0 );
+            for( unsigned int i=0; i<c_NumEntities; i++ )
+            {
+                vec3 pos( random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ) );
+                GameObject* pObject = new GameObject( pScene.get(), pos, vec3( 0, 0, 0 ) );
+                pObject->AddComponent( new MeshComponent( nullptr, nullptr ) );
+                pScene->AddObject( pObject );
+                objects.push_back( pObject );
+            }
+
+            shuffled = objects;
+            for( unsigned int i=c_NumEntities-1; i>0; i-- )
+                std::swap( shuffled[i], shuffled[random.GetInt( 0, i )] );
+        }
+        return pScene->GetComponentManager();
+    }
+};
+
+struct SpawnInputs
+{
+    std::unique_ptr<BenchmarkGame> pGame;
+    std::unique_ptr<BenchmarkScene> pScene;
+    std::vector<GameObject*> objects;
+
+    BenchmarkScene* Get()
+    {
+        if( pScene == nullptr )
+        {
+            pGame.reset( new BenchmarkGame() );
+            pScene.reset( new BenchmarkScene( pGame.get() ) );
+            objects.resize( c_NumSpawned );
+        }
+        return pScene.get();
+    }
+};
+
+static void RegisterComponentBenchmarks(BenchmarkRunner& runner)
+{
+    AddComponentBenchmarks( runner, c_NumComponents, "x1024" );
+    AddComponentBenchmarks( runner, c_NumEntities, "x100k" );
+
+    // Mesh + transform pairs, the way the draw and occlusion passes walk them.
+    std::shared_ptr<EntityInputs> pEntities = std::make_shared<EntityInputs>();
+
+    runner.Add( "ComponentManager/MeshTransforms x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentPool* pPool = pEntities->Get()->GetPool<MeshComponent>();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            vec3 total;
+            for( TransformComponent* pTransform : pPool->GetTransforms() )
+                total += pTransform->GetPosition();
+            DoNotOptimize( total );
+        }
+    } );
+
+    runner.Add( "ComponentManager/MeshViaGameObject x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentPool* pPool = pEntities->Get()->GetPool<MeshComponent>();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            vec3 total;
+            for( Component* pComponent : pPool->GetComponents() )
+                total += pComponent->GetGameObject()->GetTransform()->GetPosition();
+            DoNotOptimize( total );
+        }
+    } );
+
+    // The same pairs through a cached view, the first call builds the match list.
+    runner.Add( "ComponentManager/View MeshTransform x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentManager* pManager = pEntities->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            vec3 total;
+            for( auto row : pManager->View<MeshComponent, TransformComponent>() )
+                total += std::get<1>( row )->GetPosition();
+            DoNotOptimize( total );
+        }
+    } );
+
+    runner.Add( "ComponentManager/ViewForEach x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentManager* pManager = pEntities->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            pManager->View<MeshComponent, TransformComponent>().ForEach( [](MeshComponent* pMesh, TransformComponent* pTransform)
+            {
+                vec3 pos = pTransform->GetPosition();
+                DoNotOptimize( pos );
+            }, 1024 );
+        }
+    } );
+
+    runner.Add( "ComponentManager/ToggleMeshes x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentManager* pManager = pEntities->Get();
+        ComponentRange<Component> range = pManager->GetComponentsOfType<MeshComponent>();
+        std::vector<Component*> meshes( range.begin(), range.end() );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( Component* pMesh : meshes )
+                pManager->RemoveComponent( pMesh );
+            for( Component* pMesh : meshes )
+                pManager->AddComponent( pMesh );
+        }
+    } );
+
+    // Three lookups on each of the first 1024 objects, like GameObject::SetPosition and the game's per-frame code do.
+    runner.Add( "GameObject/GetComponent x1024", [pEntities](unsigned int iterations)
+    {
+        pEntities->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            unsigned int found = 0;
+            for( unsigned int o=0; o<c_NumComponents; o++ )
+            {
+                GameObject* pObject = pEntities->objects[o];
+                found += pObject->GetComponent<MeshComponent>() != nullptr;
+                found += pObject->GetComponent<PhysicsBodyComponent>() != nullptr;
+                found += pObject->GetComponent<LightComponent>() != nullptr;
+            }
+            DoNotOptimize( found );
+        }
+    } );
+
+    // Every object out of the scene and back in, in no particular order, like a recycle pass over a big pool.
+    runner.Add( "Scene/RemoveAddObjects x100k", [pEntities](unsigned int iterations)
+    {
+        pEntities->Get();
+        BenchmarkScene* pScene = pEntities->pScene.get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( GameObject* pObject : pEntities->shuffled )
+                pScene->RemoveObject( pObject );
+            for( GameObject* pObject : pEntities->shuffled )
+                pScene->AddObject( pObject );
+        }
+    } );
+
+    runner.Add( "GameObject/SetState x100k", [pEntities](unsigned int iterations)
+    {
+        pEntities->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( GameObject* pObject : pEntities->shuffled )
+                pObject->SetState( false );
+            for( GameObject* pObject : pEntities->shuffled )
+                pObject->SetState( true );
+        }
+    } );
+
+    // The same toggles recorded from jobs and applied in one go, the way a system would have to do it.
+    runner.Add( "EntityCommandBuffer/SetState x100k", [pEntities](unsigned int iterations)
+    {
+        pEntities->Get();
+        JobSystem* pJobSystem = pEntities->pGame->GetJobSystem();
+        EntityCommandBuffer* pCommands = pEntities->pScene->GetCommandBuffer();
+        const std::vector<GameObject*>& objects = pEntities->shuffled;
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( bool state : { false, true } )
+            {
+                pJobSystem->ParallelFor( "Record", objects.size(), [pCommands, &objects, state](size_t begin, size_t end)
+                {
+                    for( size_t o=begin; o<end; o++ )
+                        pCommands->SetState( objects[o], state );
+                }, 1024 );
+                pCommands->Playback();
+            }
+        }
+    } );
+
+    // Components held on to by handle instead of pointer, checked before use.
+    runner.Add( "ComponentManager/ResolveHandles x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentManager* pManager = pEntities->Get();
+        std::vector<Handle> handles;
+        for( GameObject* pObject : pEntities->shuffled )
+            handles.push_back( pObject->GetComponent<MeshComponent>()->GetHandle() );
+
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            unsigned int found = 0;
+            for( Handle handle : handles )
+                found += pManager->GetComponent<MeshComponent>( handle ) != nullptr;
+            DoNotOptimize( found );
+        }
+    } );
+
+    // Two read only systems that can run side by side, plus the empty physics one.
+    runner.Add( "ComponentManager/Systems x100k", [pEntities](unsigned int iterations)
+    {
+        ComponentManager* pManager = pEntities->Get();
+        if( pEntities->hasSystems == false )
+        {
+            pManager->AddSystem( new MeshPositionSystem() );
+            pManager->AddSystem( new MeshPositionSystem() );
+            pEntities->hasSystems = true;
+        }
+
+        for( unsigned int i=0; i<iterations; i++ )
+            pManager->Update( 1.0f / 60.0f );
+    } );
+
+    // A burst of short lived objects, like bullets or debris.
+    std::shared_ptr<SpawnInputs> pSpawn = std::make_shared<SpawnInputs>();
+
+    runner.Add( "GameObject/SpawnDestroy x10k", [pSpawn](unsigned int iterations)
+    {
+        BenchmarkScene* pScene = pSpawn->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( unsigned int o=0; o<c_NumSpawned; o++ )
+            {
+                pSpawn->objects[o] = new GameObject( pScene, vec3( 0, 0, 0 ), vec3( 0, 0, 0 ) );
+                pSpawn->objects[o]->AddComponent( new MeshComponent( nullptr, nullptr ) );
+            }
+
+            for( GameObject* pObject : pSpawn->objects )
+                delete pObject;
+        }
+    } );
+
+    // The same burst through the scene's command buffer, objects end up in the scene's list this way.
+    runner.Add( "EntityCommandBuffer/SpawnDestroy x10k", [pSpawn](unsigned int iterations)
+    {
+        BenchmarkScene* pScene = pSpawn->Get();
+        EntityCommandBuffer* pCommands = pScene->GetCommandBuffer();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( unsigned int o=0; o<c_NumSpawned; o++ )
+            {
+                pCommands->CreateObject( [](Scene* pScene)
+                {
+                    GameObject* pObject = new GameObject( pScene, vec3( 0, 0, 0 ), vec3( 0, 0, 0 ) );
+                    pObject->AddComponent( new MeshComponent( nullptr, nullptr ) );
+                    return pObject;
+                } );
+            }
+            pCommands->Playback();
+
+            for( size_t o=0; o<pScene->GetNumObjects(); o++ )
+                pCommands->DestroyObject( pScene->GetObjectAt( o ) );
+            pCommands->Playback();
+        }
+    } );
+}
+
+static GameObject* CreateEmptyObject(Scene* pScene)
+{
+    return new GameObject( pScene, vec3( 0, 0, 0 ), vec3( 0, 0, 0 ) );
+}
+
+// The view's rows are exactly the live objects with both components enabled, each with its own components.
+template<class TypeA, class TypeB> static bool CheckViewRows(ComponentManager* pManager, const std::vector<GameObject*>& objects)
+{
+    size_t numExpected = 0;
+    for( GameObject* pObject : objects )
+    {
+        TypeA* pA = pObject->GetComponent<TypeA>();
+        TypeB* pB = pObject->GetComponent<TypeB>();
+        if( pA && pB && pManager->IsComponentEnabled( pA ) && pManager->IsComponentEnabled( pB ) )
+            numExpected++;
+    }
+
+    ComponentView<TypeA, TypeB> view = pManager->View<TypeA, TypeB>();
+    CHECK( view.size() == numExpected );
+    for( size_t i=0; i<view.size(); i++ )
+    {
+        GameObject* pObject = view.GetGameObject( i );
+        CHECK( std::find( objects.begin(), objects.end(), pObject ) != objects.end() );
+        CHECK( std::get<0>( view[i] ) == pObject->GetComponent<TypeA>() );
+        CHECK( std::get<1>( view[i] ) == pObject->GetComponent<TypeB>() );
+    }
+
+    return true;
+}
+
+static void RegisterManagerChecks(BenchmarkRunner& runner)
+{
+    // Random adds, removes, state changes and deletes, with the view checked against the objects after each round.
+    runner.AddCheck( "ComponentManager/ViewRows", []()
+    {
+        BenchmarkGame game;
+        BenchmarkScene scene( &game );
+        ComponentManager* pManager = scene.GetComponentManager();
+
+        // Asked for up front, so they're kept up to date instead of built from scratch at the end.
+        // The second one doesn't have the transform, so it's still refreshed while the rest of a deleted object goes.
+        pManager->View<MeshComponent, TransformComponent>();
+        pManager->View<MeshComponent, LightComponent>();
+
+        Random::Generator random( 8 );
+        std::vector<GameObject*> objects;
+        for( int round=0; round<50; round++ )
+        {
+            for( int i=0; i<100; i++ )
+            {
+                int action = random.GetInt( 3 );
+                if( action == 0 || objects.empty() )
+                {
+                    GameObject* pObject = new GameObject( &scene, vec3( 0, 0, 0 ), vec3( 0, 0, 0 ) );
+                    pObject->AddComponent( new MeshComponent( nullptr, nullptr ) );
+                    if( random.GetInt( 0, 1 ) == 1 )
+                    {
+                        pObject->AddComponent( new LightComponent( LightType::PointLight, Color4f::White(), 1.0f, 1.0f ) );
+                    }
+                    scene.AddObject( pObject );
+                    objects.push_back( pObject );
+                    continue;
+                }
+
+                size_t index = random.GetInt( (int)objects.size() - 1 );
+                GameObject* pObject = objects[index];
+                MeshComponent* pMesh = pObject->GetComponent<MeshComponent>();
+
+                if( action == 1 && pMesh == nullptr )
+                {
+                    pObject->AddComponent( new MeshComponent( nullptr, nullptr ) );
+                }
+                else if( action == 1 )
+                {
+                    pObject->RemoveComponent( pMesh );
+                    delete pMesh;
+                }
+                else if( action == 2 )
+                {
+                    pObject->SetState( random.GetInt( 0, 1 ) == 1 );
+                }
+                else if( action == 3 )
+                {
+                    scene.RemoveObject( pObject );
+                    delete pObject;
+                    objects[index] = objects.back();
+                    objects.pop_back();
+                }
+            }
+
+            if( !CheckViewRows<MeshComponent, TransformComponent>( pManager, objects ) )
+                return false;
+            if( !CheckViewRows<MeshComponent, LightComponent>( pManager, objects ) )
+                return false;
+        }
+
+        for( GameObject* pObject : objects )
+        {
+            scene.RemoveObject( pObject );
+            delete pObject;
+        }
+        objects.clear();
+        if( !CheckViewRows<MeshComponent, TransformComponent>( pManager, objects ) )
+            return false;
+        if( !CheckViewRows<MeshComponent, LightComponent>( pManager, objects ) )
+            return false;
+
+        return true;
+    } );
+
+    // Creates recording more creates, enough that the list they're recorded into has to grow while it's being played back.
+    runner.AddCheck( "EntityCommandBuffer/NestedCreates", []()
+    {
+        BenchmarkGame game;
+        BenchmarkScene scene( &game );
+        EntityCommandBuffer* pCommands = scene.GetCommandBuffer();
+
+        pCommands->CreateObject( [pCommands](Scene* pScene)
+        {
+            for( int i=0; i<100; i++ )
+            {
+                pCommands->CreateObject( [pCommands](Scene* pScene)
+                {
+                    pCommands->CreateObject( CreateEmptyObject );
+                    return CreateEmptyObject( pScene );
+                } );
+            }
+            return CreateEmptyObject( pScene );
+        } );
+        pCommands->Playback();
+
+        CHECK( scene.GetNumObjects() == 201 );
+        CHECK( pCommands->GetNumPlayedBack() == 201 );
+        CHECK( pCommands->IsEmpty() );
+
+        for( size_t i=0; i<scene.GetNumObjects(); i++ )
+            pCommands->DestroyObject( scene.GetObjectAt( i ) );
+        pCommands->Playback();
+
+        CHECK( scene.GetNumObjects() == 0 );
+        return true;
+    } );
+}
+
+struct HierarchyInputs
+{
+    HierarchyInputs(JobSystem* pJobSystem) : hierarchy( pJobSystem ) {}
+
+    TransformHierarchy hierarchy;
+    std::vector<std::unique_ptr<TransformComponent>> transforms;
+    std::vector<TransformComponent*> roots;
+};
+
+// c_NumEntities transforms, in groups of childrenPerRoot + 1 with the first of each group the parent of the rest.
+static std::shared_ptr<HierarchyInputs> CreateHierarchy(unsigned int childrenPerRoot, JobSystem* pJobSystem = nullptr)
+{
+    std::shared_ptr<HierarchyInputs> pInputs = std::make_shared<HierarchyInputs>( pJobSystem );
+
+    Random::Generator random( 0 );
+    for( unsigned int i=0; i<c_NumEntities; i++ )
+    {
+        vec3 pos( random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ) );
+        TransformComponent* pTransform = new TransformComponent( pos, vec3( 0, 0, 0 ), vec3( 1, 1, 1 ) );
+        pInputs->transforms.push_back( std::unique_ptr<TransformComponent>( pTransform ) );
+
+        if( i % (childrenPerRoot + 1) == 0 )
+            pInputs->roots.push_back( pTransform );
+        else
+            pTransform->SetParent( pInputs->roots.back() );
+
+        pInputs->hierarchy.Add( pTransform );
+    }
+
+    pInputs->hierarchy.Update();
+
+    return pInputs;
+}
+
+// Moves every 'step'th root and updates, each iteration is a frame.
+static void AddHierarchyBenchmark(BenchmarkRunner& runner, const char* name, std::shared_ptr<HierarchyInputs> pInputs, unsigned int step)
+{
+    runner.Add( name, [pInputs, step](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            if( step > 0 )
+            {
+                for( size_t r=0; r<pInputs->roots.size(); r+=step )
+                {
+                    TransformComponent* pRoot = pInputs->roots[r];
+                    pRoot->SetRotation( pRoot->GetRotation() + vec3( 0, 1, 0 ) );
+                }
+            }
+
+            pInputs->hierarchy.Update();
+            DoNotOptimize( pInputs->hierarchy.GetNumRebuilt() );
+        }
+    } );
+}
+
+static void RegisterHierarchyBenchmarks(BenchmarkRunner& runner)
+{
+    std::shared_ptr<HierarchyInputs> pFlat = CreateHierarchy( 0 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/Static x100k", pFlat, 0 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/Move1Percent x100k", pFlat, 100 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/MoveAll x100k", pFlat, 1 );
+
+    // 10k parents with 9 children each, moving a parent rebuilds its children too.
+    std::shared_ptr<HierarchyInputs> pGroups = CreateHierarchy( 9 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/Groups Static x100k", pGroups, 0 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/Groups Move1Percent x100k", pGroups, 100 );
+    AddHierarchyBenchmark( runner, "TransformHierarchy/Groups MoveAll x100k", pGroups, 1 );
+}
+
+static void RegisterHierarchyChecks(BenchmarkRunner& runner)
+{
+    // Parents updated by hand before the hierarchy gets to them still have their children rebuilt,
+    // whether the hierarchy takes the sorted, the single pass or the parallel path.
+    runner.AddCheck( "TransformHierarchy/UpdateWorldTransform", []()
+    {
+        JobSystem jobSystem( 4 );
+
+        // Every 100th root is few enough to sort, every root is enough for one pass, and every 10th with jobs is enough to split.
+        const unsigned int steps[] = { 100, 1, 10 };
+        for( unsigned int step : steps )
+        {
+            std::shared_ptr<HierarchyInputs> pInputs = CreateHierarchy( 1, step == 10 ? &jobSystem : nullptr );
+
+            for( size_t r=0; r<pInputs->roots.size(); r+=step )
+            {
+                TransformComponent* pRoot = pInputs->roots[r];
+                pRoot->SetPosition( pRoot->GetPosition() + vec3( 1, 2, 3 ) );
+                pRoot->SetRotation( pRoot->GetRotation() + vec3( 0, 30, 0 ) );
+                pRoot->UpdateWorldTransform();
+            }
+            pInputs->hierarchy.Update();
+
+            for( TransformComponent* pRoot : pInputs->roots )
+            {
+                for( TransformComponent* pChild : pRoot->GetChildren() )
+                {
+                    TransformComponent local( pChild->GetPosition(), pChild->GetRotation(), pChild->GetScale() );
+                    local.UpdateWorldTransform();
+
+                    matrix expected = pRoot->GetWorldTransform() * local.GetWorldTransform();
+                    CHECK( memcmp( &pChild->GetWorldTransform(), &expected, sizeof( matrix ) ) == 0 );
+                }
+            }
+        }
+
+        return true;
+    } );
+}
+
+// Everything is created on first use, a full run would otherwise start over a hundred threads and copy the data for every thread count.
+struct JobInputs
+{
+    std::unique_ptr<JobSystem> pJobSystems[c_NumJobThreadCounts];
+    std::shared_ptr<HierarchyInputs> pHierarchies[c_NumJobThreadCounts];
+    std::unique_ptr<DrawList> pDrawLists[c_NumJobThreadCounts];
+
+    std::vector<float> values;
+    std::vector<float> results;
+
+    // A small scene for the camera and lights, the draws themselves live outside it.
+    std::unique_ptr<BenchmarkGame> pGame;
+    std::unique_ptr<BenchmarkScene> pScene;
+    Camera* pCamera = nullptr;
+    std::unique_ptr<Material> pMaterial;
+    std::vector<std::unique_ptr<MeshComponent>> meshes;
+    std::vector<std::unique_ptr<TransformComponent>> transforms;
+    std::vector<Component*> meshComponents;
+    std::vector<TransformComponent*> meshTransforms;
+
+    JobSystem* GetJobSystem(unsigned int index)
+    {
+        if( pJobSystems[index] == nullptr )
+            pJobSystems[index].reset( new JobSystem( c_JobThreadCounts[index] ) );
+        return pJobSystems[index].get();
+    }
+
+    void CreateValues()
+    {
+        if( values.empty() )
+        {
+            Random::Generator random( 0 );
+            for( unsigned int i=0; i<c_NumJobElements; i++ )
+                values.push_back( random.GetFloat( 0.0f, 100.0f ) );
+            results.resize( c_NumJobElements );
+        }
+    }
+
+    HierarchyInputs* GetHierarchy(unsigned int index)
+    {
+        if( pHierarchies[index] == nullptr )
+            pHierarchies[index] = CreateHierarchy( 9, GetJobSystem( index ) );
+        return pHierarchies[index].get();
+    }
+
+    DrawList* GetDrawList(unsigned int index)
+    {
+        if( pScene == nullptr )
+        {
+            pGame.reset( new BenchmarkGame() );
+            pScene.reset( new BenchmarkScene( pGame.get() ) );
+
+            pCamera = new Camera( pScene.get(), vec3( 0, 0, -150 ), vec3( 0, 0, 0 ) );
+            pScene->AddObject( pCamera );
+
+            Random::Generator random( 0 );
+            for( unsigned int i=0; i<c_NumJobLights; i++ )
+            {
+                vec3 pos( random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ) );
+                GameObject* pLight = new GameObject( pScene.get(), pos, vec3( 0, 0, 0 ) );
+                pLight->AddComponent( new LightComponent( LightType::PointLight, Color4f::White(), 50.0f, 1.0f ) );
+                pScene->AddObject( pLight );
+            }
+
+            pMaterial.reset( new Material( nullptr, Color4f::White() ) );
+            for( unsigned int i=0; i<c_NumJobDraws; i++ )
+            {
+                vec3 pos( random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ), random.GetFloat( -100.0f, 100.0f ) );
+                transforms.push_back( std::unique_ptr<TransformComponent>( new TransformComponent( pos, vec3( 0, 0, 0 ), vec3( 1, 1, 1 ) ) ) );
+                transforms.back()->UpdateWorldTransform();
+                meshes.push_back( std::unique_ptr<MeshComponent>( new MeshComponent( nullptr, pMaterial.get() ) ) );
+
+                meshComponents.push_back( meshes.back().get() );
+                meshTransforms.push_back( transforms.back().get() );
+            }
+        }
+
+        if( pDrawLists[index] == nullptr )
+            pDrawLists[index].reset( new DrawList( GetJobSystem( index ) ) );
+        return pDrawLists[index].get();
+    }
+};
+
+static void RegisterJobBenchmarks(BenchmarkRunner& runner)
+{
+    std::shared_ptr<JobInputs> pInputs = std::make_shared<JobInputs>();
+
+    for( unsigned int t=0; t<c_NumJobThreadCounts; t++ )
+    {
+        std::string suffix = " threads " + std::to_string( c_JobThreadCounts[t] );
+
+        // Queuing and finishing tiny jobs, the overhead every other job pays.
+        runner.Add( ("JobSystem/Run x1024" + suffix).c_str(), [pInputs, t](unsigned int iterations)
+        {
+            JobSystem* pJobSystem = pInputs->GetJobSystem( t );
+            for( unsigned int i=0; i<iterations; i++ )
+            {
+                JobCounter counter;
+                for( unsigned int j=0; j<c_NumComponents; j++ )
+                    pJobSystem->Run( "Empty", [](){}, &counter );
+                pJobSystem->Wait( &counter );
+            }
+        } );
+
+        runner.Add( ("JobSystem/ParallelFor x1M" + suffix).c_str(), [pInputs, t](unsigned int iterations)
+        {
+            JobSystem* pJobSystem = pInputs->GetJobSystem( t );
+            pInputs->CreateValues();
+            const float* values = pInputs->values.data();
+            float* results = pInputs->results.data();
+            for( unsigned int i=0; i<iterations; i++ )
+            {
+                pJobSystem->ParallelFor( "Sqrt", c_NumJobElements, [values, results](size_t begin, size_t end)
+                {
+                    for( size_t e=begin; e<end; e++ )
+                        results[e] = sqrtf( values[e] ) * 0.5f + 1.0f;
+                } );
+                DoNotOptimize( results[0] );
+            }
+        } );
+
+        runner.Add( ("JobSystem/DrawList x10k" + suffix).c_str(), [pInputs, t](unsigned int iterations)
+        {
+            DrawList* pDrawList = pInputs->GetDrawList( t );
+            LightView lights = pInputs->pScene->GetComponentManager()->View<LightComponent, TransformComponent>();
+            for( unsigned int i=0; i<iterations; i++ )
+            {
+                pDrawList->Build( pInputs->pCamera, pInputs->meshComponents, pInputs->meshTransforms, lights );
+                DoNotOptimize( pDrawList->GetCommands()[0] );
+            }
+        } );
+
+        // Every parent moves, so 100k world matrices are rebuilt a frame.
+        runner.Add( ("JobSystem/TransformHierarchy Groups MoveAll x100k" + suffix).c_str(), [pInputs, t](unsigned int iterations)
+        {
+            HierarchyInputs* pHierarchy = pInputs->GetHierarchy( t );
+            for( unsigned int i=0; i<iterations; i++ )
+            {
+                for( TransformComponent* pRoot : pHierarchy->roots )
+                    pRoot->SetRotation( pRoot->GetRotation() + vec3( 0, 1, 0 ) );
+
+                pHierarchy->hierarchy.Update();
+                DoNotOptimize( pHierarchy->hierarchy.GetNumRebuilt() );
+            }
+        } );
+    }
+}
+
+static void RegisterEventBenchmarks(BenchmarkRunner& runner)
+{
+    std::shared_ptr<EventManager> pManager = std::make_shared<EventManager>();
+    std::shared_ptr<std::vector<CountingListener>> pListeners = std::make_shared<std::vector<CountingListener>>( c_NumListeners );
+
+    for( CountingListener& listener : *pListeners )
+        pManager->RegisterForEvents( InputEvent::GetStaticEventType(), &listener );
+
+    runner.Add( "EventManager/Dispatch x256", [pManager, pListeners](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            for( unsigned int e=0; e<c_NumEvents; e++ )
+                pManager->AddEvent( new InputEvent( DeviceType::Keyboard, InputState::Pressed, e ) );
+
+            pManager->ProcessEvents();
+        }
+        DoNotOptimize( (*pListeners)[0].m_Count );
+    } );
+
+    runner.Add( "EventManager/RegisterUnregister", [pManager](unsigned int iterations)
+    {
+        CountingListener listener;
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            pManager->RegisterForEvents( RemoveFromGameEvent::GetStaticEventType(), &listener );
+            pManager->UnregisterForEvents( RemoveFromGameEvent::GetStaticEventType(), &listener );
+        }
+    } );
+}
+
+struct ResourceInputs
+{
+    std::unique_ptr<ResourceManager> pManager;
+    std::vector<std::string> names;
+
+    // Created on first use, so runs filtered to other benchmarks don't need the data folder.
+    ResourceManager* Get()
+    {
+        if( pManager == nullptr )
+        {
+            pManager.reset( new ResourceManager() );
+            for( unsigned int i=0; i<c_NumResources; i++ )
+            {
+                names.push_back( "Material" + std::to_string( i ) );
+                pManager->CreateMaterial( names.back(), Color4f::White() );
+            }
+        }
+        return pManager.get();
+    }
+};
+
+static void RegisterResourceBenchmarks(BenchmarkRunner& runner)
+{
+    std::shared_ptr<ResourceInputs> pInputs = std::make_shared<ResourceInputs>();
+
+    runner.Add( "ResourceManager/GetMaterial", [pInputs](unsigned int iterations)
+    {
+        ResourceManager* pManager = pInputs->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            Material* pMaterial = pManager->GetMaterial( pInputs->names[i % c_NumResources] );
+            DoNotOptimize( pMaterial );
+        }
+    } );
+
+    runner.Add( "ResourceManager/GetMaterialLiteral", [pInputs](unsigned int iterations)
+    {
+        ResourceManager* pManager = pInputs->Get();
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            Material* pMaterial = pManager->GetMaterial( "Material128" );
+            DoNotOptimize( pMaterial );
+        }
+    } );
+}
+
+void RegisterManagerBenchmarks(BenchmarkRunner& runner)
+{
+    RegisterComponentBenchmarks( runner );
+    RegisterManagerChecks( runner );
+    RegisterHierarchyBenchmarks( runner );
+    RegisterHierarchyChecks( runner );
+    RegisterJobBenchmarks( runner );
+    RegisterEventBenchmarks( runner );
+    RegisterResourceBenchmarks( runner );
+}
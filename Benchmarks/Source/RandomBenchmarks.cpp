@@ -0,0 +1,168 @@
+#include "Framework.h"
+
+#include "Benchmark.h"
+
+#include <limits.h>
+#include <string.h>
+
+using namespace fw;
+
+// Gives the checks the raw numbers and state behind a generator.
+class RawGenerator : public Random::Generator
+{
+public:
+    using Random::Generator::Generator;
+
+    uint32_t Next() { return m_RNGEngine(); }
+    uint64_t GetState() const { return m_RNGEngine.GetState(); }
+};
+
+static void RegisterGeneratorBenchmarks(BenchmarkRunner& runner)
+{
+    runner.Add( "Random/GetFloat", [](unsigned int iterations)
+    {
+        static Random::Generator random( 0 );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            float result = random.GetFloat( -1.0f, 1.0f );
+            DoNotOptimize( result );
+        }
+    } );
+
+    runner.Add( "Random/GetInt", [](unsigned int iterations)
+    {
+        static Random::Generator random( 0 );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            int result = random.GetInt( 0, 99 );
+            DoNotOptimize( result );
+        }
+    } );
+
+    runner.Add( "Random/GlobalGetFloat", [](unsigned int iterations)
+    {
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            float result = Random::GetFloat( -1.0f, 1.0f );
+            DoNotOptimize( result );
+        }
+    } );
+
+    // A whole buffer per iteration, divide by 1024 for the cost per value.
+    runner.Add( "Random/FillFloat x1024", [](unsigned int iterations)
+    {
+        static Random::Generator random( 0 );
+        static std::vector<float> values( 1024 );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            random.Fill( &values[0], values.size(), -1.0f, 1.0f );
+            DoNotOptimize( values[0] );
+        }
+    } );
+
+    runner.Add( "Random/FillInt x1024", [](unsigned int iterations)
+    {
+        static Random::Generator random( 0 );
+        static std::vector<int> values( 1024 );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            random.Fill( &values[0], values.size(), 0, 99 );
+            DoNotOptimize( values[0] );
+        }
+    } );
+
+    runner.Add( "Random/Advance", [](unsigned int iterations)
+    {
+        static Random::Generator random( 0 );
+        for( unsigned int i=0; i<iterations; i++ )
+        {
+            random.Advance( 1000003 );
+            DoNotOptimize( random );
+        }
+    } );
+}
+
+// Fill() runs 8 lanes at once, these make sure it still gives what pulling one number at a time would.
+// The odd counts leave some lanes over at the end.
+static void RegisterGeneratorChecks(BenchmarkRunner& runner)
+{
+    runner.AddCheck( "Random/FillSequence", []()
+    {
+        for( size_t count : { 0, 1, 7, 8, 9, 1000, 1031 } )
+        {
+            RawGenerator filled( 1, 2 );
+            RawGenerator pulled( 1, 2 );
+
+            // The full int range maps the raw numbers straight across.
+            std::vector<int> values( count + 1 );
+            filled.Fill( &values[0], count, INT_MIN, INT_MAX );
+            for( size_t i=0; i<count; i++ )
+                CHECK( (uint32_t)((int64_t)values[i] - INT_MIN) == pulled.Next() );
+
+            CHECK( filled.GetState() == pulled.GetState() );
+        }
+        return true;
+    } );
+
+    runner.AddCheck( "Random/FillAdvance", []()
+    {
+        for( size_t count : { 1, 7, 8, 9, 1000, 1031 } )
+        {
+            RawGenerator filled( 3 );
+            RawGenerator advanced( 3 );
+
+            std::vector<float> values( count );
+            filled.Fill( &values[0], count, -1.0f, 1.0f );
+            advanced.Advance( count );
+
+            CHECK( filled.GetState() == advanced.GetState() );
+        }
+        return true;
+    } );
+
+    // Each piece gets a copy of the generator Advance()'d to its start, the way a job would.
+    runner.AddCheck( "Random/FillSplit", []()
+    {
+        const size_t count = 4099;
+        const size_t splits[] = { 0, 5, 8, 1000, 1003, 4096, count };
+
+        Random::Generator random( 4, 5 );
+        std::vector<float> whole( count );
+        std::vector<float> pieces( count );
+
+        Random::Generator single = random;
+        single.Fill( &whole[0], count, -10.0f, 10.0f );
+
+        for( size_t i=0; i+1<sizeof( splits )/sizeof( splits[0] ); i++ )
+        {
+            Random::Generator piece = random;
+            piece.Advance( splits[i] );
+            piece.Fill( &pieces[splits[i]], splits[i+1] - splits[i], -10.0f, 10.0f );
+        }
+
+        CHECK( memcmp( &whole[0], &pieces[0], count * sizeof( float ) ) == 0 );
+        return true;
+    } );
+
+    // With min bigger than the range, the top numbers would round up to max if they weren't clamped.
+    runner.AddCheck( "Random/FillFloatRange", []()
+    {
+        const float ranges[][2] = { { -1.0f, 1.0f }, { 1.0f, 2.0f }, { 1000.0f, 1000.5f }, { 1.0f, nextafterf( 1.0f, 2.0f ) } };
+        for( const float* range : ranges )
+        {
+            Random::Generator random( 6 );
+            std::vector<float> values( 4096 );
+            random.Fill( &values[0], values.size(), range[0], range[1] );
+
+            for( float value : values )
+                CHECK( value >= range[0] && value < range[1] );
+        }
+        return true;
+    } );
+}
+
+void RegisterRandomBenchmarks(BenchmarkRunner& runner)
+{
+    RegisterGeneratorBenchmarks( runner );
+    RegisterGeneratorChecks( runner );
+}
@@ -0,0 +1,38 @@
+#include "Framework.h"
+
+#include "Benchmark.h"
+
+// Micro benchmarks for the framework, runs without a window or GL context, i.e.
+//     FrameworkBenchmarks --reps 50 --json Results.json
+// or checks the results of the code being benchmarked, i.e.
+//     FrameworkBenchmarks --check --filter OcclusionCuller
+// Run it from the Game folder, the ResourceManager benchmarks load the default shader from Data/.
+// Compare two runs with Benchmarks/compare.py.
+int main(int argc, char** argv)
+{
+    // Fixed seed so every run works on the same data.
+    fw::Random::SetSeed( 0 );
+
+    // Anything that touches GL gets answered by the recorder instead of a driver.
+    fw::GLRecorder::Install( fw::GLBackend::NullShim );
+
+    int result = 1;
+
+    // Scoped so the benchmarks free their resources while the recorder is still installed.
+    {
+        BenchmarkRunner runner;
+        if( runner.ParseCommandLine( argc, argv ) )
+        {
+            RegisterMathBenchmarks( runner );
+            RegisterRandomBenchmarks( runner );
+            RegisterManagerBenchmarks( runner );
+            RegisterCullingBenchmarks( runner );
+
+            result = runner.Run();
+        }
+    }
+
+    fw::GLRecorder::Uninstall();
+
+    return result;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Compares a FrameworkBenchmarks JSON report against a stored baseline.
+
+    python compare.py Baseline.json Results.json --threshold 10
+
+Prints the change of every benchmark found in both files and exits with 1 if any of them
+got slower than the threshold, so it can gate a build. Make the baseline by running
+FrameworkBenchmarks --json Baseline.json on the same machine and build type, and keep it
+with the other baselines in Benchmarks/Baselines/, one file per machine.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        report = json.load(f)
+    return {b["name"]: b for b in report["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flags benchmark regressions against a baseline.")
+    parser.add_argument("baseline", help="JSON report from a known good build")
+    parser.add_argument("current", help="JSON report to check")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="percent slower before a benchmark counts as a regression (default 10)")
+    parser.add_argument("--metric", default="medianNs", choices=["minNs", "medianNs", "meanNs", "p90Ns", "p99Ns"],
+                        help="which statistic to compare (default medianNs)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = []
+
+    print("%-40s %12s %12s %9s" % ("Benchmark", "Baseline ns", "Current ns", "Change"))
+    for name, result in current.items():
+        if name not in baseline:
+            print("%-40s %12s %12.2f %9s" % (name, "-", result[args.metric], "new"))
+            continue
+
+        before = baseline[name][args.metric]
+        after = result[args.metric]
+        change = (after / before - 1) * 100 if before > 0 else 0
+
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+
+        print("%-40s %12.2f %12.2f %+8.1f%%%s" % (name, before, after, change, flag))
+
+    for name in baseline:
+        if name not in current:
+            print("%-40s %12.2f %12s %9s" % (name, baseline[name][args.metric], "-", "missing"))
+
+    if regressions:
+        print("\n%d benchmark(s) more than %.1f%% slower than the baseline." % (len(regressions), args.threshold))
+        return 1
+
+    print("\nNo regressions above %.1f%%." % args.threshold)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
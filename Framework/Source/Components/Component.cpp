@@ -2,8 +2,67 @@
 
 #include "Component.h"
 
+#include <mutex>
+
 namespace fw {
 
+// Function statics, so types can be registered from other files' static initializers.
+struct ComponentTypeRegistry
+{
+    std::mutex mutex;
+    std::vector<std::string> names;
+};
+
+static ComponentTypeRegistry& GetRegistry()
+{
+    static ComponentTypeRegistry registry;
+    return registry;
+}
+
+ComponentTypeID RegisterComponentType(const char* type)
+{
+    ComponentTypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (ComponentTypeID id = 0; id < registry.names.size(); id++)
+    {
+        if (registry.names[id] == type)
+        {
+            return id;
+        }
+    }
+
+    // Raise MaxComponentTypes if this fires, the GameObject bitmask has to grow with it.
+    assert(registry.names.size() < MaxComponentTypes);
+
+    registry.names.push_back(type);
+    return static_cast<ComponentTypeID>(registry.names.size() - 1);
+}
+
+ComponentTypeID FindComponentType(const char* type)
+{
+    ComponentTypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (ComponentTypeID id = 0; id < registry.names.size(); id++)
+    {
+        if (registry.names[id] == type)
+        {
+            return id;
+        }
+    }
+
+    return InvalidComponentTypeID;
+}
+
+std::string GetComponentTypeName(ComponentTypeID typeID)
+{
+    ComponentTypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    return typeID < registry.names.size() ? registry.names[typeID] : "Unknown";
+}
+
 Component::Component()
 {
 }
@@ -1,22 +1,80 @@
 #pragma once
 
+#include "Utility/SlotMap.h"
+
 namespace fw {
 
+class ComponentPool;
 class GameObject;
 
+// Dense integer per component type, used to index the lookup tables in GameObject and ComponentManager.
+typedef unsigned int ComponentTypeID;
+
+static const unsigned int MaxComponentTypes = 32;
+static const ComponentTypeID InvalidComponentTypeID = MaxComponentTypes;
+
+// Hands out IDs by type name, so the same name always gets the same ID, even when the
+// GetStaticType() strings from two modules are different pointers.
+ComponentTypeID RegisterComponentType(const char* type);
+
+// Returns InvalidComponentTypeID for names that were never registered.
+ComponentTypeID FindComponentType(const char* type);
+std::string GetComponentTypeName(ComponentTypeID typeID);
+
+// Debug builds report component types a System touches without declaring them, see System.h.
+#ifndef FW_CHECK_SYSTEM_ACCESS
+#define FW_CHECK_SYSTEM_ACCESS _DEBUG
+#endif
+
+// Does nothing when no system is running on this thread.
+void CheckSystemAccess(ComponentTypeID typeID, bool write);
+
+// Registered the first time it's asked for, after that it's a constant.
+template <class Type> ComponentTypeID GetComponentTypeID()
+{
+    static const ComponentTypeID id = RegisterComponentType(Type::GetStaticType());
+    return id;
+}
+
 class Component
 {
+    friend class ComponentPool;
+    friend class GameObject;
+
 public:
     Component();
     virtual ~Component();
 
     virtual const char* GetType() = 0;
 
+    // Looked up from GetType() on the first call.
+    ComponentTypeID GetTypeID()
+    {
+        if (m_TypeID == InvalidComponentTypeID)
+        {
+            m_TypeID = RegisterComponentType(GetType());
+        }
+        return m_TypeID;
+    }
+
+    // Resolves through ComponentManager::GetComponent() while the component is in its manager.
+    Handle GetHandle() const { return m_Handle; }
+
     GameObject* GetGameObject() { return m_pGameObject; }
     virtual void SetGameObject(GameObject* pGameObject) { m_pGameObject = pGameObject; }
 
 protected:
     GameObject* m_pGameObject = nullptr;
+
+private:
+    ComponentTypeID m_TypeID = InvalidComponentTypeID;
+
+    // Slot in the ComponentManager's pool for this type, -1 while not added.
+    int m_PoolIndex = -1;
+    Handle m_Handle;
+
+    // The GameObject's next component, in the order they were added.
+    Component* m_pNextOnGameObject = nullptr;
 };
 
 } // namespace fw
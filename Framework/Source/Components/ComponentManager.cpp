@@ -2,69 +2,409 @@
 
 #include "ComponentManager.h"
 #include "Component.h"
+#include "Components/LightComponent.h"
 #include "Components/MeshComponent.h"
 #include "Components/TransformComponent.h"
 #include "Components/PhysicsBodyComponent.h"
-#include "Objects/GameObject.h"
+#include "Components/ReflectionProbeComponent.h"
+#include "Components/System.h"
+#include "Objects/Camera.h"
+#include "Objects/DrawList.h"
+#include "Objects/Mesh.h"
+#include "Objects/OcclusionCuller.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Utility.h"
+
+#include <algorithm>
 
 namespace fw {
 
-ComponentManager::ComponentManager()
+ComponentManager::ComponentManager(JobSystem* pJobSystem)
 {
+    m_pJobSystem = pJobSystem;
+    m_pDrawList = new DrawList(pJobSystem);
+    m_pOcclusionCuller = new OcclusionCuller();
+    m_pTransformHierarchy = new TransformHierarchy(pJobSystem);
+
+    AddSystem(new PhysicsBodySystem());
+}
+
+ComponentManager::~ComponentManager()
+{
+    for (System* pSystem : m_Systems)
+    {
+        delete pSystem;
+    }
+    delete[] m_SystemDependenciesLeft;
+
+    for (ViewCache* pView : m_Views)
+    {
+        delete pView;
+    }
+
+    for (ComponentPool* pPool : m_Pools)
+    {
+        delete pPool;
+    }
+
+    delete m_pTransformHierarchy;
+    delete m_pOcclusionCuller;
+    delete m_pDrawList;
 }
 
 void ComponentManager::Update(float deltaTime)
 {
-    for (Component* pComponent : m_Components[PhysicsBodyComponent::GetStaticType()])
+    Update(deltaTime, SystemStage::BeforePhysics);
+    Update(deltaTime, SystemStage::AfterPhysics);
+}
+
+void ComponentManager::Update(float deltaTime, SystemStage stage)
+{
+    if (m_SystemGraphDirty)
     {
-        PhysicsBodyComponent* pPhysicsBody = static_cast<PhysicsBodyComponent*>(pComponent);
-        pPhysicsBody->Update(deltaTime);
+        BuildSystemGraph();
     }
+
+    if (m_pJobSystem == nullptr)
+    {
+        // Dependencies only point forward, so the order they were added in works.
+        for (size_t i = 0; i < m_Systems.size(); i++)
+        {
+            if (m_Systems[i]->GetStage() == stage)
+            {
+                RunSystem(i, deltaTime);
+            }
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < m_Systems.size(); i++)
+    {
+        m_SystemDependenciesLeft[i] = m_SystemNumDependencies[i];
+    }
+
+    // Systems queue the ones waiting on them as they finish, all of them count down the same counter.
+    JobCounter counter;
+    for (size_t i = 0; i < m_Systems.size(); i++)
+    {
+        if (m_Systems[i]->GetStage() == stage && m_SystemNumDependencies[i] == 0)
+        {
+            QueueSystem(i, deltaTime, &counter);
+        }
+    }
+    m_pJobSystem->Wait(&counter);
+}
+
+void ComponentManager::AddSystem(System* pSystem)
+{
+    // Created here, pools can't be created once the systems are running on other threads.
+    for (ComponentTypeID typeID = 0; typeID < MaxComponentTypes; typeID++)
+    {
+        if ((pSystem->GetReadMask() | pSystem->GetWriteMask()) & (1u << typeID))
+        {
+            GetPool(typeID);
+        }
+    }
+
+    m_Systems.push_back(pSystem);
+    m_SystemGraphDirty = true;
+}
+
+void ComponentManager::RemoveSystem(System* pSystem)
+{
+    auto it = std::find(m_Systems.begin(), m_Systems.end(), pSystem);
+    if (it != m_Systems.end())
+    {
+        m_Systems.erase(it);
+        delete pSystem;
+        m_SystemGraphDirty = true;
+    }
+}
+
+void ComponentManager::BuildSystemGraph()
+{
+    size_t numSystems = m_Systems.size();
+
+    m_SystemDependents.assign(numSystems, std::vector<size_t>());
+    m_SystemNumDependencies.assign(numSystems, 0);
+
+    for (size_t i = 0; i < numSystems; i++)
+    {
+        for (size_t j = i + 1; j < numSystems; j++)
+        {
+            // Stages already run one after the other.
+            if (m_Systems[i]->GetStage() == m_Systems[j]->GetStage() && m_Systems[i]->ConflictsWith(m_Systems[j]))
+            {
+                m_SystemDependents[i].push_back(j);
+                m_SystemNumDependencies[j]++;
+            }
+        }
+    }
+
+    delete[] m_SystemDependenciesLeft;
+    m_SystemDependenciesLeft = new std::atomic<int>[numSystems];
+
+    m_SystemGraphDirty = false;
+}
+
+void ComponentManager::RunSystem(size_t index, float deltaTime)
+{
+    SystemScope scope(m_Systems[index]);
+    m_Systems[index]->Update(this, deltaTime);
+}
+
+void ComponentManager::QueueSystem(size_t index, float deltaTime, JobCounter* pCounter)
+{
+    m_pJobSystem->Run(m_Systems[index]->GetName(), [this, index, deltaTime, pCounter]()
+        {
+            RunSystem(index, deltaTime);
+
+            // Queued before this job signals the counter, so the counter can't reach zero early.
+            for (size_t dependent : m_SystemDependents[index])
+            {
+                if (m_SystemDependenciesLeft[dependent].fetch_sub(1) == 1)
+                {
+                    QueueSystem(dependent, deltaTime, pCounter);
+                }
+            }
+        }, pCounter);
 }
 
 void ComponentManager::Draw(Camera* pCamera)
 {
-	for (Component* pComponent : m_Components[TransformComponent::GetStaticType()])
-	{
-		TransformComponent* pTransform = static_cast<TransformComponent*>(pComponent);
-		pTransform->UpdateWorldTransform();
-	}
+    // Only the transforms that moved since last frame, and their children.
+    m_pTransformHierarchy->Update();
 
-    for (Component* pComponent : m_Components[MeshComponent::GetStaticType()])
+    // Refresh a few cubemap faces before the main pass, so reflections are at most a few frames behind.
+    UpdateReflectionProbes(pCamera);
+
+    ComponentPool* pMeshPool = GetPool<MeshComponent>();
+    ComponentRange<Component> meshesToDraw = pMeshPool->GetComponents();
+    ComponentRange<TransformComponent> transformsToDraw = pMeshPool->GetTransforms();
+
+    // Drop meshes hidden behind occluders, only kicks in once the scene has marked something as an occluder.
+    if (m_OcclusionCullingEnabled && RasterizeOccluders(pCamera))
     {
-        MeshComponent* pMeshComponent = static_cast<MeshComponent*>(pComponent);
+        m_VisibleMeshes.clear();
+        m_VisibleTransforms.clear();
 
-        // Create rotation matrix to rotate normals.
-        vec3 rot = pMeshComponent->GetGameObject()->GetTransform()->GetRotation();
-        matrix normalMatrix;
-        normalMatrix.CreateRotation(rot);
+        for (size_t i = 0; i < meshesToDraw.size(); i++)
+        {
+            MeshComponent* pMeshComponent = static_cast<MeshComponent*>(meshesToDraw[i]);
+            TransformComponent* pTransform = transformsToDraw[i];
+            Mesh* pMesh = pMeshComponent->GetMesh();
 
-        // Get the world matrix.
-        const matrix& worldTransform = pMeshComponent->GetGameObject()->GetTransform()->GetWorldTransform();
+            if (pMeshComponent->IsOccluder() || m_pOcclusionCuller->IsVisible(pTransform->GetWorldTransform(), pMesh->GetBoundsMin(), pMesh->GetBoundsMax()))
+            {
+                m_VisibleMeshes.push_back(pMeshComponent);
+                m_VisibleTransforms.push_back(pTransform);
+            }
+        }
 
-        // Draw our mesh.
-        pMeshComponent->Draw(pCamera, worldTransform, normalMatrix);
+        meshesToDraw = m_VisibleMeshes;
+        transformsToDraw = m_VisibleTransforms;
     }
+
+    // Resolve matrices and lights for every mesh (on worker threads for big scenes), then replay them here on the GL thread.
+    m_pDrawList->Build(pCamera, meshesToDraw, transformsToDraw, View<LightComponent, TransformComponent>());
+    m_pDrawList->Submit(pCamera);
+}
+
+bool ComponentManager::RasterizeOccluders(Camera* pCamera)
+{
+    bool hasOccluders = false;
+
+    ComponentPool* pMeshPool = GetPool<MeshComponent>();
+    ComponentRange<Component> meshes = pMeshPool->GetComponents();
+    ComponentRange<TransformComponent> transforms = pMeshPool->GetTransforms();
+
+    for (size_t i = 0; i < meshes.size(); i++)
+    {
+        MeshComponent* pMeshComponent = static_cast<MeshComponent*>(meshes[i]);
+        Mesh* pMesh = pMeshComponent->GetMesh();
+
+        // Large meshes don't keep a CPU copy of their triangles, so they can't occlude anything.
+        if (!pMeshComponent->IsOccluder() || pMesh->GetOccluderPositions().empty())
+            continue;
+
+        if (!hasOccluders)
+        {
+            m_pOcclusionCuller->Begin(pCamera->GetProjecMatrix() * pCamera->GetViewMatrix());
+            hasOccluders = true;
+        }
+
+        m_pOcclusionCuller->RasterizeOccluder(transforms[i]->GetWorldTransform(), pMesh->GetOccluderPositions(), pMesh->GetOccluderIndices());
+    }
+
+    if (hasOccluders)
+    {
+        m_pOcclusionCuller->BuildHierarchy();
+    }
+
+    return hasOccluders;
+}
+
+void ComponentManager::UpdateReflectionProbes(Camera* pCamera)
+{
+    m_ReflectionProbeStats = ReflectionProbeStats();
+
+    ComponentRange<Component> probes = GetPool<ReflectionProbeComponent>()->GetComponents();
+    if (probes.empty())
+        return;
+
+    double startTime = GetSystemTime();
+
+    // Most important first: close to the camera and not refreshed in a while.
+    m_ProbesByPriority.clear();
+    for (Component* pComponent : probes)
+    {
+        ReflectionProbeComponent* pProbe = static_cast<ReflectionProbeComponent*>(pComponent);
+        m_ProbesByPriority.push_back(std::make_pair(pProbe->GetUpdatePriority(pCamera->GetPosition()), pProbe));
+    }
+
+    std::stable_sort(m_ProbesByPriority.begin(), m_ProbesByPriority.end(),
+        [](const std::pair<float, ReflectionProbeComponent*>& a, const std::pair<float, ReflectionProbeComponent*>& b) { return a.first > b.first; });
+
+    m_ReflectionProbeStats.probesConsidered = (unsigned int)m_ProbesByPriority.size();
+
+    if (m_ReflectionProbeFaceBudget > 0)
+    {
+        // The faces are drawn into the probes' own FBOs, put back whatever the scene was rendering to.
+        GLint lastFrameBuffer;
+        GLint lastViewport[4];
+        GLint lastFrontFace;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &lastFrameBuffer);
+        glGetIntegerv(GL_VIEWPORT, lastViewport);
+        glGetIntegerv(GL_FRONT_FACE, &lastFrontFace);
+
+        // The cubemap face views are mirrored, so flip the winding to keep culling consistent.
+        glFrontFace(lastFrontFace == GL_CW ? GL_CCW : GL_CW);
+
+        ComponentPool* pMeshPool = GetPool<MeshComponent>();
+        LightView lights = View<LightComponent, TransformComponent>();
+
+        // With fewer probes than faces in the budget, the top probes get more than one face.
+        int facesLeft = m_ReflectionProbeFaceBudget;
+        for (int pass = 0; pass < ReflectionProbeComponent::NumFaces && facesLeft > 0; pass++)
+        {
+            for (size_t i = 0; i < m_ProbesByPriority.size() && facesLeft > 0; i++)
+            {
+                int numDraws = m_ProbesByPriority[i].second->RenderNextFace(m_pDrawList, pMeshPool->GetComponents(), pMeshPool->GetTransforms(), lights);
+
+                m_ReflectionProbeStats.facesRendered++;
+                m_ReflectionProbeStats.drawsSubmitted += numDraws;
+                facesLeft--;
+            }
+        }
+
+        glFrontFace(lastFrontFace);
+        glBindFramebuffer(GL_FRAMEBUFFER, lastFrameBuffer);
+        glViewport(lastViewport[0], lastViewport[1], lastViewport[2], lastViewport[3]);
+    }
+
+    for (Component* pComponent : probes)
+    {
+        static_cast<ReflectionProbeComponent*>(pComponent)->EndFrame();
+    }
+
+    m_ReflectionProbeStats.updateTimeMs = (GetSystemTime() - startTime) * 1000.0;
+}
+
+ComponentPool* ComponentManager::GetPool(ComponentTypeID typeID)
+{
+    assert(typeID < MaxComponentTypes);
+
+#if FW_CHECK_SYSTEM_ACCESS
+    CheckSystemAccess(typeID, false);
+#endif
+
+    if (m_Pools[typeID] == nullptr)
+    {
+        m_Pools[typeID] = new ComponentPool(typeID);
+    }
+
+    return m_Pools[typeID];
 }
 
 void ComponentManager::AddComponent(Component* pComponent)
 {
-    std::vector<Component*>& list = m_Components[pComponent->GetType()];
+    GetPool(pComponent->GetTypeID())->Add(pComponent);
 
-    // Assert that the component *was not* already in the list.
-    assert(std::find(list.begin(), list.end(), pComponent) == list.end());
+    if (pComponent->GetTypeID() == GetComponentTypeID<TransformComponent>())
+    {
+        m_pTransformHierarchy->Add(static_cast<TransformComponent*>(pComponent));
+    }
 
-    list.push_back( pComponent );
+    RefreshViews(pComponent);
 }
 
 void ComponentManager::RemoveComponent(Component* pComponent)
 {
-    std::vector<Component*>& list = m_Components[pComponent->GetType()];
+    // Before the pool drops it, views find their rows by the transform's handle.
+    RefreshViews(pComponent);
+
+    GetPool(pComponent->GetTypeID())->Remove(pComponent);
+
+    if (pComponent->GetTypeID() == GetComponentTypeID<TransformComponent>())
+    {
+        m_pTransformHierarchy->Remove(static_cast<TransformComponent*>(pComponent));
+    }
+}
+
+void ComponentManager::SetComponentEnabled(Component* pComponent, bool enabled)
+{
+#if FW_CHECK_SYSTEM_ACCESS
+    CheckSystemAccess(pComponent->GetTypeID(), true);
+#endif
+
+    GetPool(pComponent->GetTypeID())->SetEnabled(pComponent, enabled);
+
+    RefreshViews(pComponent);
+}
+
+bool ComponentManager::IsComponentEnabled(Component* pComponent)
+{
+    return GetPool(pComponent->GetTypeID())->IsEnabled(pComponent);
+}
+
+ViewCache* ComponentManager::GetViewCache(const ComponentTypeID* typeIDs, unsigned int numTypes)
+{
+#if FW_CHECK_SYSTEM_ACCESS
+    for (unsigned int i = 0; i < numTypes; i++)
+    {
+        CheckSystemAccess(typeIDs[i], false);
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock(m_ViewMutex);
+
+    for (ViewCache* pView : m_Views)
+    {
+        if (pView->HasTypes(typeIDs, numTypes))
+            return pView;
+    }
+
+    ViewCache* pView = new ViewCache(this, typeIDs, numTypes);
+    m_Views.push_back(pView);
+
+    return pView;
+}
 
-    // Assert that the component *was* in the list.
-    assert(std::find(list.begin(), list.end(), pComponent) != list.end());
+void ComponentManager::RefreshViews(Component* pComponent)
+{
+    // Components that aren't on an object yet get picked up when the object adds them.
+    GameObject* pObject = pComponent->GetGameObject();
+    if (pObject == nullptr)
+        return;
 
-    list.erase(std::remove(list.begin(), list.end(), pComponent), list.end());
+    uint32_t typeBit = 1u << pComponent->GetTypeID();
+    for (ViewCache* pView : m_Views)
+    {
+        if (pView->GetMask() & typeBit)
+        {
+            pView->Refresh(pObject);
+        }
+    }
 }
 
 } // namespace fw
@@ -1,26 +1,127 @@
 #pragma once
 
+#include <mutex>
+
+#include "Components/ComponentPool.h"
+#include "Components/ComponentView.h"
+#include "Components/ReflectionProbeComponent.h"
+#include "Components/TransformHierarchy.h"
+
 namespace fw {
 
 class Camera;
 class Component;
+class JobCounter;
+class DrawList;
+class JobSystem;
+class OcclusionCuller;
+class System;
+class TransformComponent;
+
+// When in the frame a system runs, Scene::Update() steps the physics world between the two.
+enum class SystemStage
+{
+    BeforePhysics,  // Input and anything else that pushes bodies around.
+    AfterPhysics,   // Everything else, including copying the bodies back to their transforms.
+};
 
 class ComponentManager
 {
 public:
-    ComponentManager();
-    virtual ~ComponentManager() {}
+    // Without a job system everything runs on the calling thread.
+    ComponentManager(JobSystem* pJobSystem = nullptr);
+    virtual ~ComponentManager();
 
+    // Runs the systems, spread across the job system when there is one.
+    // The first version runs every stage, one after the other.
     void Update(float deltaTime);
+    void Update(float deltaTime, SystemStage stage);
     void Draw(Camera* pCamera);
 
+    // The manager owns its systems, it starts with a PhysicsBodySystem.
+    void AddSystem(System* pSystem);
+    void RemoveSystem(System* pSystem);
+    const std::vector<System*>& GetSystems() { return m_Systems; }
+
     void AddComponent(Component* pComponent);
     void RemoveComponent(Component* pComponent);
 
-    std::vector<Component*>& GetComponentsOfType(const char* type) { return m_Components[type]; }
+    // Disabled components stay in their pool, and keep their handles, but are left out of GetComponentsOfType(),
+    // systems and drawing. O(1), the pool only moves them across its enabled/disabled line.
+    void SetComponentEnabled(Component* pComponent, bool enabled);
+    bool IsComponentEnabled(Component* pComponent);
+
+    // nullptr once the component has been removed from the manager, SetState(false) included.
+    Component* GetComponent(ComponentTypeID typeID, Handle handle) { return GetPool(typeID)->Get(handle); }
+    template <class Type> Type* GetComponent(Handle handle) { return static_cast<Type*>(GetPool<Type>()->Get(handle)); }
+
+    // Dense list of every enabled component of a type, only good until components are added, removed or toggled.
+    ComponentRange<Component> GetComponentsOfType(const char* type) { return GetPool(type)->GetComponents(); }
+    template <class Type> ComponentRange<Component> GetComponentsOfType() { return GetPool<Type>()->GetComponents(); }
+
+    // Every GameObject with an enabled component of each type, e.g. View<MeshComponent, TransformComponent>().
+    // The match list is built the first time a combination is asked for and kept up to date after that.
+    template <class... Types> ComponentView<Types...> View()
+    {
+        const ComponentTypeID typeIDs[] = { GetComponentTypeID<Types>()... };
+        return ComponentView<Types...>(GetViewCache(typeIDs, sizeof...(Types)));
+    }
+    ViewCache* GetViewCache(const ComponentTypeID* typeIDs, unsigned int numTypes);
+
+    // Creates the pool the first time a type is asked for.
+    ComponentPool* GetPool(ComponentTypeID typeID);
+    ComponentPool* GetPool(const char* type) { return GetPool(RegisterComponentType(type)); }
+    template <class Type> ComponentPool* GetPool() { return GetPool(GetComponentTypeID<Type>()); }
+
+    JobSystem* GetJobSystem() { return m_pJobSystem; }
+    DrawList* GetDrawList() { return m_pDrawList; }
+    OcclusionCuller* GetOcclusionCuller() { return m_pOcclusionCuller; }
+    TransformHierarchy* GetTransformHierarchy() { return m_pTransformHierarchy; }
+
+    void SetOcclusionCullingEnabled(bool enabled) { m_OcclusionCullingEnabled = enabled; }
+
+    // Max number of reflection probe faces rendered per frame, shared by all probes.
+    void SetReflectionProbeFaceBudget(int faces) { m_ReflectionProbeFaceBudget = faces; }
+    const ReflectionProbeStats& GetReflectionProbeStats() { return m_ReflectionProbeStats; }
+
+protected:
+    void BuildSystemGraph();
+    void RunSystem(size_t index, float deltaTime);
+    void RefreshViews(Component* pComponent);
+    void QueueSystem(size_t index, float deltaTime, JobCounter* pCounter);
+
+    bool RasterizeOccluders(Camera* pCamera);
+    void UpdateReflectionProbes(Camera* pCamera);
 
 protected:
-    std::map<const char*, std::vector<Component*>> m_Components;
+    JobSystem* m_pJobSystem = nullptr;
+
+    // Indexed by ComponentTypeID, null until a type is first used.
+    ComponentPool* m_Pools[MaxComponentTypes] = {};
+
+    // Views can be asked for from inside systems, so finding or creating one takes the lock.
+    std::mutex m_ViewMutex;
+    std::vector<ViewCache*> m_Views;
+
+    // Systems in the order they were added, a system depends on every earlier one it conflicts with.
+    std::vector<System*> m_Systems;
+    std::vector<std::vector<size_t>> m_SystemDependents;
+    std::vector<int> m_SystemNumDependencies;
+    std::atomic<int>* m_SystemDependenciesLeft = nullptr;
+    bool m_SystemGraphDirty = false;
+
+    TransformHierarchy* m_pTransformHierarchy = nullptr;
+
+    DrawList* m_pDrawList = nullptr;
+
+    OcclusionCuller* m_pOcclusionCuller = nullptr;
+    bool m_OcclusionCullingEnabled = true;
+    std::vector<Component*> m_VisibleMeshes;
+    std::vector<TransformComponent*> m_VisibleTransforms;
+
+    int m_ReflectionProbeFaceBudget = 1;
+    ReflectionProbeStats m_ReflectionProbeStats;
+    std::vector<std::pair<float, ReflectionProbeComponent*>> m_ProbesByPriority;
 };
 
 } // namespace fw
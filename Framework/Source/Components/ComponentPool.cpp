@@ -0,0 +1,108 @@
+#include "CoreHeaders.h"
+
+#include "ComponentPool.h"
+#include "Component.h"
+#include "Objects/GameObject.h"
+
+namespace fw {
+
+ComponentPool::ComponentPool(ComponentTypeID typeID)
+    : m_TypeID(typeID)
+{
+}
+
+ComponentPool::~ComponentPool()
+{
+    // The components belong to their GameObjects, which may already be gone, so they aren't touched here.
+}
+
+void ComponentPool::Add(Component* pComponent)
+{
+    assert(pComponent->GetTypeID() == m_TypeID);
+
+    // Assert that the component *was not* already in a pool.
+    assert(pComponent->m_PoolIndex == -1);
+
+    GameObject* pGameObject = pComponent->GetGameObject();
+
+    size_t index = m_Components.size();
+    pComponent->m_PoolIndex = static_cast<int>(index);
+    pComponent->m_Handle = m_Handles.Add(pComponent->m_PoolIndex);
+    m_Components.push_back(pComponent);
+    m_Transforms.push_back(pGameObject ? pGameObject->GetTransform() : nullptr);
+
+    // Over the line into the enabled ones.
+    Swap(index, m_NumEnabled);
+    m_NumEnabled++;
+}
+
+void ComponentPool::Remove(Component* pComponent)
+{
+    // Assert that the component *was* in this pool.
+    assert(Contains(pComponent));
+
+    // Disabled first, so the hole is never in the enabled part, then fill it with the last component.
+    SetEnabled(pComponent, false);
+    Swap(pComponent->m_PoolIndex, m_Components.size() - 1);
+
+    m_Components.pop_back();
+    m_Transforms.pop_back();
+    pComponent->m_PoolIndex = -1;
+    m_Handles.Remove(pComponent->m_Handle);
+    pComponent->m_Handle = Handle();
+}
+
+void ComponentPool::SetEnabled(Component* pComponent, bool enabled)
+{
+    assert(Contains(pComponent));
+
+    if (enabled == IsEnabled(pComponent))
+        return;
+
+    // Trade places with whatever is on the other side of the line, then move the line past it.
+    if (enabled)
+    {
+        Swap(pComponent->m_PoolIndex, m_NumEnabled);
+        m_NumEnabled++;
+    }
+    else
+    {
+        Swap(pComponent->m_PoolIndex, m_NumEnabled - 1);
+        m_NumEnabled--;
+    }
+}
+
+bool ComponentPool::IsEnabled(Component* pComponent) const
+{
+    return pComponent->m_PoolIndex >= 0 && pComponent->m_PoolIndex < static_cast<int>(m_NumEnabled);
+}
+
+bool ComponentPool::Contains(Component* pComponent) const
+{
+    int index = pComponent->m_PoolIndex;
+
+    return index >= 0 && index < static_cast<int>(m_Components.size()) && m_Components[index] == pComponent;
+}
+
+Component* ComponentPool::Get(Handle handle) const
+{
+    uint32_t index = m_Handles.Find(handle);
+
+    return index != Handle::InvalidIndex ? m_Components[index] : nullptr;
+}
+
+void ComponentPool::Swap(size_t index1, size_t index2)
+{
+    if (index1 == index2)
+        return;
+
+    std::swap(m_Components[index1], m_Components[index2]);
+    std::swap(m_Transforms[index1], m_Transforms[index2]);
+
+    m_Components[index1]->m_PoolIndex = static_cast<int>(index1);
+    m_Components[index2]->m_PoolIndex = static_cast<int>(index2);
+    m_Handles.SetDenseIndex(m_Components[index1]->m_Handle, static_cast<uint32_t>(index1));
+    m_Handles.SetDenseIndex(m_Components[index2]->m_Handle, static_cast<uint32_t>(index2));
+}
+
+} // namespace fw
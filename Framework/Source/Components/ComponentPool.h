@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Component.h"
+
+namespace fw {
+
+class TransformComponent;
+
+// A run of pool entries, in pool order. Only good until the pool changes.
+// Sized and indexed like the vectors it stands in for, and a vector converts to one.
+template <class Type> class ComponentRange
+{
+public:
+    ComponentRange(Type* const* pFirst, size_t size) : m_pFirst(pFirst), m_Size(size) {}
+    ComponentRange(const std::vector<Type*>& values) : m_pFirst(values.data()), m_Size(values.size()) {}
+
+    size_t size() const { return m_Size; }
+    bool empty() const { return m_Size == 0; }
+
+    Type* operator[](size_t index) const { return m_pFirst[index]; }
+
+    Type* const* begin() const { return m_pFirst; }
+    Type* const* end() const { return m_pFirst + m_Size; }
+
+protected:
+    Type* const* m_pFirst = nullptr;
+    size_t m_Size = 0;
+};
+
+// Every added component of one type, packed with no holes so systems walk it front to back.
+// A sparse set: each component remembers its own slot, so adding, removing and lookups are O(1).
+// Enabled components are kept in front of disabled ones, and enabling or disabling one only swaps it across
+// that line, so GetComponents() is just the enabled ones without a check per element.
+// Components move around as others come, go and change state, hold on to a component's Handle rather than its index.
+class ComponentPool
+{
+public:
+    ComponentPool(ComponentTypeID typeID);
+    virtual ~ComponentPool();
+
+    // Components start out enabled.
+    void Add(Component* pComponent);
+    void Remove(Component* pComponent);
+    bool Contains(Component* pComponent) const;
+
+    void SetEnabled(Component* pComponent, bool enabled);
+    bool IsEnabled(Component* pComponent) const;
+
+    // nullptr once the component has been removed, even if another one took its slot. Disabled ones still resolve.
+    Component* Get(Handle handle) const;
+
+    ComponentTypeID GetTypeID() const { return m_TypeID; }
+    size_t GetSize() const { return m_Components.size(); }
+    size_t GetNumEnabled() const { return m_NumEnabled; }
+    bool IsEmpty() const { return m_Components.empty(); }
+
+    // The enabled components.
+    ComponentRange<Component> GetComponents() const { return ComponentRange<Component>(m_Components.data(), m_NumEnabled); }
+
+    // Enabled ones first, then the disabled ones.
+    ComponentRange<Component> GetAllComponents() const { return ComponentRange<Component>(m_Components); }
+
+    // The transform of each enabled component's GameObject, in the same order as GetComponents().
+    // Saves a trip through the GameObject for every element when a system needs both.
+    ComponentRange<TransformComponent> GetTransforms() const { return ComponentRange<TransformComponent>(m_Transforms.data(), m_NumEnabled); }
+
+protected:
+    void Swap(size_t index1, size_t index2);
+
+protected:
+    ComponentTypeID m_TypeID = InvalidComponentTypeID;
+
+    std::vector<Component*> m_Components;
+    std::vector<TransformComponent*> m_Transforms;
+    size_t m_NumEnabled = 0;
+
+    HandleTable m_Handles;
+};
+
+} // namespace fw
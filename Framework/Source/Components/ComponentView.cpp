@@ -0,0 +1,137 @@
+#include "CoreHeaders.h"
+
+#include "ComponentView.h"
+#include "ComponentManager.h"
+#include "ComponentPool.h"
+#include "System.h"
+#include "Objects/GameObject.h"
+#include "TransformComponent.h"
+#include "Utility/JobSystem.h"
+
+namespace fw {
+
+ViewCache::ViewCache(ComponentManager* pManager, const ComponentTypeID* typeIDs, unsigned int numTypes)
+{
+    assert(numTypes > 0 && numTypes <= MaxTypes);
+
+    m_pManager = pManager;
+    m_NumTypes = numTypes;
+
+    ComponentPool* pSmallestPool = nullptr;
+    for (unsigned int i = 0; i < numTypes; i++)
+    {
+        m_TypeIDs[i] = typeIDs[i];
+        m_pPools[i] = pManager->GetPool(typeIDs[i]);
+        m_Mask |= 1u << typeIDs[i];
+
+        if (pSmallestPool == nullptr || m_pPools[i]->GetNumEnabled() < pSmallestPool->GetNumEnabled())
+        {
+            pSmallestPool = m_pPools[i];
+        }
+    }
+
+    // Every match has an enabled component in each pool, so the smallest one has them all.
+    for (Component* pComponent : pSmallestPool->GetComponents())
+    {
+        if (pComponent->GetGameObject())
+        {
+            Refresh(pComponent->GetGameObject());
+        }
+    }
+}
+
+ViewCache::~ViewCache()
+{
+}
+
+bool ViewCache::HasTypes(const ComponentTypeID* typeIDs, unsigned int numTypes) const
+{
+    if (numTypes != m_NumTypes)
+        return false;
+
+    for (unsigned int i = 0; i < numTypes; i++)
+    {
+        if (typeIDs[i] != m_TypeIDs[i])
+            return false;
+    }
+
+    return true;
+}
+
+void ViewCache::Refresh(GameObject* pObject)
+{
+    Component* row[MaxTypes];
+
+    // Missing a type altogether is the common case, and the mask says so without touching the pools.
+    bool matches = (pObject->GetComponentMask() & m_Mask) == m_Mask;
+    for (unsigned int i = 0; i < m_NumTypes && matches; i++)
+    {
+        row[i] = pObject->GetComponent(m_TypeIDs[i]);
+        matches = m_pPools[i]->Contains(row[i]) && m_pPools[i]->IsEnabled(row[i]);
+    }
+
+    uint32_t key = pObject->GetTransform()->GetHandle().index;
+    uint32_t index = key < m_RowIndices.size() ? m_RowIndices[key] : Handle::InvalidIndex;
+    if (matches)
+    {
+        assert(key != Handle::InvalidIndex);
+
+        if (index == Handle::InvalidIndex)
+        {
+            if (key >= m_RowIndices.size())
+            {
+                m_RowIndices.resize(key + 1, static_cast<uint32_t>(Handle::InvalidIndex));
+            }
+
+            index = static_cast<uint32_t>(m_Objects.size());
+            m_RowIndices[key] = index;
+            m_Objects.push_back(pObject);
+            m_Components.resize(m_Components.size() + m_NumTypes);
+        }
+
+        std::copy(row, row + m_NumTypes, m_Components.begin() + index * m_NumTypes);
+    }
+    else if (index != Handle::InvalidIndex)
+    {
+        m_RowIndices[key] = Handle::InvalidIndex;
+        RemoveRow(index);
+    }
+}
+
+void ViewCache::ForEachChunk(ChunkFunc pFunc, void* pContext, size_t minChunkSize)
+{
+    System* pSystem = System::GetCurrent();
+
+    auto runChunk = [pFunc, pContext, pSystem](size_t begin, size_t end)
+    {
+        SystemScope scope(pSystem);
+        pFunc(pContext, begin, end);
+    };
+
+    JobSystem* pJobSystem = m_pManager->GetJobSystem();
+    if (pJobSystem)
+    {
+        pJobSystem->ParallelFor(pSystem ? pSystem->GetName() : "ComponentView", GetNumRows(), runChunk, minChunkSize);
+    }
+    else
+    {
+        runChunk(0, GetNumRows());
+    }
+}
+
+void ViewCache::RemoveRow(size_t index)
+{
+    // Fill the hole with the last row.
+    size_t last = m_Objects.size() - 1;
+    if (index != last)
+    {
+        m_Objects[index] = m_Objects[last];
+        m_RowIndices[m_Objects[index]->GetTransform()->GetHandle().index] = static_cast<uint32_t>(index);
+        std::copy(m_Components.begin() + last * m_NumTypes, m_Components.end(), m_Components.begin() + index * m_NumTypes);
+    }
+
+    m_Objects.pop_back();
+    m_Components.resize(last * m_NumTypes);
+}
+
+} // namespace fw
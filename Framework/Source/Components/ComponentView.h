@@ -0,0 +1,128 @@
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "Component.h"
+
+namespace fw {
+
+class ComponentManager;
+class ComponentPool;
+
+// The GameObjects that have an enabled component of every one of a set of types, with those components stored
+// side by side, one row per object, in a single array. The ComponentManager keeps it up to date as components
+// are added, removed, enabled and disabled, so walking it never has to look anything up.
+class ViewCache
+{
+public:
+    static const unsigned int MaxTypes = 8;
+
+    typedef void (*ChunkFunc)(void* pContext, size_t begin, size_t end);
+
+    ViewCache(ComponentManager* pManager, const ComponentTypeID* typeIDs, unsigned int numTypes);
+    virtual ~ViewCache();
+
+    bool HasTypes(const ComponentTypeID* typeIDs, unsigned int numTypes) const;
+    uint32_t GetMask() const { return m_Mask; }
+
+    // Adds, updates or drops the object's row, called by the manager when one of its components changes.
+    void Refresh(GameObject* pObject);
+
+    size_t GetNumRows() const { return m_Objects.size(); }
+    Component* const* GetRow(size_t index) const { return &m_Components[index * m_NumTypes]; }
+    GameObject* GetGameObject(size_t index) const { return m_Objects[index]; }
+
+    // Calls pFunc on ranges of rows, spread across the manager's job system. The chunks run as part of
+    // whichever System is running on this thread, so the access checks still know who is asking.
+    void ForEachChunk(ChunkFunc pFunc, void* pContext, size_t minChunkSize);
+
+protected:
+    void RemoveRow(size_t index);
+
+protected:
+    ComponentManager* m_pManager = nullptr;
+
+    ComponentTypeID m_TypeIDs[MaxTypes] = {};
+    ComponentPool* m_pPools[MaxTypes] = {};
+    unsigned int m_NumTypes = 0;
+    uint32_t m_Mask = 0;
+
+    // m_NumTypes components per row, in the order of m_TypeIDs.
+    std::vector<Component*> m_Components;
+    std::vector<GameObject*> m_Objects;
+
+    // Each object's row, indexed by its transform's handle index. Every object adds its transform first and removes it
+    // first, so the index is dense and there whenever the object can match. Handle::InvalidIndex for objects without a row.
+    std::vector<uint32_t> m_RowIndices;
+};
+
+// What ComponentManager::View() returns, a typed look at a ViewCache. Rows come out as tuples,
+// or ForEach() hands each component to func as its own argument. Only good until components change.
+template <class... Types> class ComponentView
+{
+public:
+    typedef std::tuple<Types*...> Row;
+
+    class Iterator
+    {
+    public:
+        Iterator(const ComponentView* pView, size_t index) : m_pView(pView), m_Index(index) {}
+
+        Row operator*() const { return (*m_pView)[m_Index]; }
+        Iterator& operator++() { m_Index++; return *this; }
+        bool operator!=(const Iterator& other) const { return m_Index != other.m_Index; }
+
+    protected:
+        const ComponentView* m_pView;
+        size_t m_Index;
+    };
+
+    ComponentView(ViewCache* pCache) : m_pCache(pCache) {}
+
+    size_t size() const { return m_pCache->GetNumRows(); }
+    bool empty() const { return m_pCache->GetNumRows() == 0; }
+
+    Row operator[](size_t index) const { return MakeRow(m_pCache->GetRow(index), std::index_sequence_for<Types...>()); }
+    GameObject* GetGameObject(size_t index) const { return m_pCache->GetGameObject(index); }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, size()); }
+
+    // Calls func(pComponent1, pComponent2, ...) for every row, in chunks spread across the job system.
+    // func must only write to the components it's given and their GameObject.
+    template <class Func> void ForEach(Func func, size_t minChunkSize = 64) const
+    {
+        struct Context
+        {
+            ViewCache* pCache;
+            Func* pFunc;
+        };
+        Context context = { m_pCache, &func };
+
+        m_pCache->ForEachChunk([](void* pContext, size_t begin, size_t end)
+        {
+            Context* pContextData = static_cast<Context*>(pContext);
+            for (size_t i = begin; i < end; i++)
+            {
+                CallWithRow(*pContextData->pFunc, pContextData->pCache->GetRow(i), std::index_sequence_for<Types...>());
+            }
+        }, &context, minChunkSize);
+    }
+
+protected:
+    template <size_t... Indices> static Row MakeRow(Component* const* pRow, std::index_sequence<Indices...>)
+    {
+        return Row(static_cast<Types*>(pRow[Indices])...);
+    }
+
+    template <class Func, size_t... Indices> static void CallWithRow(Func& func, Component* const* pRow, std::index_sequence<Indices...>)
+    {
+        func(static_cast<Types*>(pRow[Indices])...);
+    }
+
+protected:
+    ViewCache* m_pCache = nullptr;
+};
+
+} // namespace fw
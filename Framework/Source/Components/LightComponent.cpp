@@ -1,6 +1,7 @@
 #include "CoreHeaders.h"
 
 #include "LightComponent.h"
+#include "Utility/SlabAllocator.h"
 
 namespace fw {
 
@@ -19,6 +20,16 @@ LightComponent::~LightComponent()
 
 }
 
+void* LightComponent::operator new(size_t size)
+{
+    return SlabArena::Allocate(GetSlabTypeID<LightComponent>(GetStaticType()), size);
+}
+
+void LightComponent::operator delete(void* p, size_t size)
+{
+    SlabArena::Free(GetSlabTypeID<LightComponent>(GetStaticType()), p, size);
+}
+
 void LightComponent::SetDiffuse(Color4f diffuse)
 {
 	m_light.diffuse = diffuse;
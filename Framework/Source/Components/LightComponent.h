@@ -33,6 +33,10 @@ public:
     LightComponent(LightType type, Color4f color, float radius, float powerFactor, float spotCutoff);
     virtual ~LightComponent();
 
+    // Allocated from the current SlabArena, see Utility/SlabAllocator.h.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
     static const char* GetStaticType() { return "LightingComponent"; }
     virtual const char* GetType() override { return GetStaticType(); }
 
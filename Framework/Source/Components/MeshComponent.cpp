@@ -2,6 +2,7 @@
 
 #include "MeshComponent.h"
 #include "Objects/Mesh.h"
+#include "Utility/SlabAllocator.h"
 
 namespace fw {
 
@@ -13,7 +14,17 @@ MeshComponent::~MeshComponent()
 {
 }
 
-void MeshComponent::Draw(Camera* pCamera, const matrix& worldMat, const matrix& normalMat)
+void* MeshComponent::operator new(size_t size)
+{
+    return SlabArena::Allocate(GetSlabTypeID<MeshComponent>(GetStaticType()), size);
+}
+
+void MeshComponent::operator delete(void* p, size_t size)
+{
+    SlabArena::Free(GetSlabTypeID<MeshComponent>(GetStaticType()), p, size);
+}
+
+void MeshComponent::Draw(Camera* pCamera, const matrix& worldMat, const mat3& normalMat)
 {
 		m_pMesh->Draw(m_pGameObject, pCamera, m_pMaterial, worldMat, normalMat, m_UVScale, m_UVOffset, 0.0f);
 }
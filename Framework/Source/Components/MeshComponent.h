@@ -18,7 +18,11 @@ public:
     MeshComponent(Mesh* pMesh, Material* pMaterial);
     virtual ~MeshComponent();
 
-    void Draw(Camera* pCamera, const matrix& worldMat, const matrix& normalMat);
+    // Allocated from the current SlabArena, see Utility/SlabAllocator.h.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
+    void Draw(Camera* pCamera, const matrix& worldMat, const mat3& normalMat);
 
     static const char* GetStaticType() { return "MeshComponent"; }
     virtual const char* GetType() override { return GetStaticType(); }
@@ -28,6 +32,12 @@ public:
 
 	void SetMaterial(Material* pMaterial) { m_pMaterial = pMaterial;}
 
+    // Occluders are rasterized into the occlusion culler's depth buffer and never culled themselves.
+    void SetOccluder(bool isOccluder) { m_IsOccluder = isOccluder; }
+    bool IsOccluder() { return m_IsOccluder; }
+
+    Mesh* GetMesh() { return m_pMesh; }
+    Material* GetMaterial() { return m_pMaterial; }
     vec2 GetUVScale() { return m_UVScale; }
     vec2 GetUVOffset() { return m_UVOffset; }
 
@@ -37,6 +47,8 @@ protected:
     Material* m_pMaterial = nullptr;
     vec2 m_UVScale = vec2(1, 1);
     vec2 m_UVOffset = vec2(0, 0);
+
+    bool m_IsOccluder = false;
 };
 
 } // namespace fw
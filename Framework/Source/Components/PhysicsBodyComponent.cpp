@@ -1,9 +1,11 @@
 #include "CoreHeaders.h"
 
 #include "PhysicsBodyComponent.h"
+#include "Components/TransformComponent.h"
 #include "Objects/GameObject.h"
 #include "Physics/PhysicsBody.h"
 #include "Physics/PhysicsWorld.h"
+#include "Utility/SlabAllocator.h"
 
 namespace fw {
 
@@ -16,14 +18,34 @@ PhysicsBodyComponent::~PhysicsBodyComponent()
     delete m_pPhysicsBody;
 }
 
+void* PhysicsBodyComponent::operator new(size_t size)
+{
+    return SlabArena::Allocate(GetSlabTypeID<PhysicsBodyComponent>(GetStaticType()), size);
+}
+
+void PhysicsBodyComponent::operator delete(void* p, size_t size)
+{
+    SlabArena::Free(GetSlabTypeID<PhysicsBodyComponent>(GetStaticType()), p, size);
+}
+
 void PhysicsBodyComponent::Update(float deltaTime)
 {
-    TransformComponent* pTransform = m_pGameObject->GetTransform();
+    Update(m_pGameObject->GetTransform());
+}
 
+void PhysicsBodyComponent::Update(TransformComponent* pTransform)
+{
     if (m_pPhysicsBody)
     {
         pTransform->SetPosition(m_pPhysicsBody->GetPosition());
-        pTransform->SetRotation(m_pPhysicsBody->GetRotation());
+        if (m_pPhysicsBody->HasQuaternionRotation())
+        {
+            pTransform->SetRotation(m_pPhysicsBody->GetRotationQuat());
+        }
+        else
+        {
+            pTransform->SetRotation(m_pPhysicsBody->GetRotation());
+        }
     }
 }
 
@@ -72,4 +94,19 @@ void PhysicsBodyComponent::ApplyTorque(const vec3& torque)
     }
 }
 
+PhysicsBodySystem::PhysicsBodySystem() : System("PhysicsBodySystem")
+{
+    Reads<PhysicsBodyComponent>();
+    Writes<TransformComponent>();
+}
+
+void PhysicsBodySystem::Update(ComponentManager* pManager, float deltaTime)
+{
+    // Bodies only copy a few values each, so chunks need a good number of them.
+    pManager->View<PhysicsBodyComponent, TransformComponent>().ForEach([](PhysicsBodyComponent* pPhysicsBody, TransformComponent* pTransform)
+    {
+        pPhysicsBody->Update(pTransform);
+    }, 256);
+}
+
 } // namespace fw
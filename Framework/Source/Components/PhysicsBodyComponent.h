@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.h"
+#include "Components/System.h"
 #include "Math/Vector.h"
 
 namespace fw {
@@ -17,10 +18,15 @@ public:
     PhysicsBodyComponent();
     virtual ~PhysicsBodyComponent();
 
+    // Allocated from the current SlabArena, see Utility/SlabAllocator.h.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
     static const char* GetStaticType() { return "PhysicsBodyComponent"; }
     virtual const char* GetType() override { return GetStaticType(); }
 
     void Update(float deltaTime);
+    void Update(TransformComponent* pTransform);
 
     virtual void CreateBody(PhysicsWorld* pWorld, bool isDynamic, float density);
     virtual void CreateBody(PhysicsWorld* pWorld, bool isDynamic, float radius, float density);
@@ -32,4 +38,13 @@ public:
     virtual void ApplyTorque(const vec3& torque);
 };
 
+// Copies each body's position and rotation from the physics world to its transform, every ComponentManager has one.
+class PhysicsBodySystem : public System
+{
+public:
+    PhysicsBodySystem();
+
+    virtual void Update(ComponentManager* pManager, float deltaTime) override;
+};
+
 } // namespace fw
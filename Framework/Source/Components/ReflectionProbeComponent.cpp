@@ -0,0 +1,182 @@
+#include "CoreHeaders.h"
+
+#include "ReflectionProbeComponent.h"
+#include "Components/MeshComponent.h"
+#include "Objects/Camera.h"
+#include "Objects/DrawList.h"
+#include "Objects/GameObject.h"
+#include "Objects/Material.h"
+#include "Objects/Texture.h"
+#include "Math/FastMath.h"
+
+namespace fw {
+
+// View axes for each face, in GL_TEXTURE_CUBE_MAP_POSITIVE_X + i order.
+// These match the s/t directions GL uses when sampling, so they're a mirror image of a regular camera.
+static const vec3 c_FaceRight[ReflectionProbeComponent::NumFaces] =
+{
+    vec3( 0, 0,-1), vec3( 0, 0, 1), vec3( 1, 0, 0), vec3( 1, 0, 0), vec3( 1, 0, 0), vec3(-1, 0, 0),
+};
+static const vec3 c_FaceUp[ReflectionProbeComponent::NumFaces] =
+{
+    vec3( 0,-1, 0), vec3( 0,-1, 0), vec3( 0, 0, 1), vec3( 0, 0,-1), vec3( 0,-1, 0), vec3( 0,-1, 0),
+};
+static const vec3 c_FaceForward[ReflectionProbeComponent::NumFaces] =
+{
+    vec3( 1, 0, 0), vec3(-1, 0, 0), vec3( 0, 1, 0), vec3( 0,-1, 0), vec3( 0, 0, 1), vec3( 0, 0,-1),
+};
+
+ReflectionProbeComponent::ReflectionProbeComponent(int resolution, bool generateMips) : Component(), m_Resolution(resolution), m_GenerateMips(generateMips)
+{
+    GLuint textureID = 0;
+    glGenTextures( 1, &textureID );
+
+    glActiveTexture( GL_TEXTURE0 );
+    glBindTexture( GL_TEXTURE_CUBE_MAP, textureID );
+
+    for( int i=0; i<NumFaces; i++ )
+    {
+        glTexImage2D( GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGBA, m_Resolution, m_Resolution, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+    }
+
+    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+
+    if( m_GenerateMips )
+    {
+        // Allocate the whole chain up front, it gets refreshed each time the last face is rendered.
+        glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+        glGenerateMipmap( GL_TEXTURE_CUBE_MAP );
+    }
+    else
+    {
+        glTexParameteri( GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    }
+
+    glBindTexture( GL_TEXTURE_CUBE_MAP, 0 );
+
+    m_pCubemap = new Texture( textureID );
+
+    // One depth buffer shared by all faces, they're never rendered at the same time.
+    glGenRenderbuffers( 1, &m_DepthBufferID );
+    glBindRenderbuffer( GL_RENDERBUFFER, m_DepthBufferID );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, m_Resolution, m_Resolution );
+    glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+
+    glGenFramebuffers( 1, &m_FrameBufferID );
+}
+
+ReflectionProbeComponent::~ReflectionProbeComponent()
+{
+    // Give the targets back their original cubemaps.
+    for( size_t i=0; i<m_TargetMaterials.size(); i++ )
+    {
+        m_TargetMaterials[i]->SetCubemap( m_OriginalCubemaps[i] );
+    }
+
+    delete m_pCamera;
+
+    glDeleteFramebuffers( 1, &m_FrameBufferID );
+    glDeleteRenderbuffers( 1, &m_DepthBufferID );
+
+    delete m_pCubemap;
+}
+
+void ReflectionProbeComponent::SetGameObject(GameObject* pGameObject)
+{
+    Component::SetGameObject( pGameObject );
+
+    if( m_pCamera == nullptr )
+    {
+        m_pCamera = new Camera( pGameObject->GetScene(), pGameObject->GetPosition() );
+    }
+}
+
+void ReflectionProbeComponent::AddTargetMaterial(Material* pMaterial)
+{
+    assert( std::find( m_TargetMaterials.begin(), m_TargetMaterials.end(), pMaterial ) == m_TargetMaterials.end() );
+
+    m_TargetMaterials.push_back( pMaterial );
+    m_OriginalCubemaps.push_back( pMaterial->GetCubemap() );
+
+    pMaterial->SetCubemap( m_pCubemap );
+}
+
+float ReflectionProbeComponent::GetUpdatePriority(vec3 cameraPos)
+{
+    // Only used to rank probes, the fast square root is plenty.
+    float distance = fastmath::Distance<fastmath::Precision::Fast>( m_pGameObject->GetTransform()->GetWorldPosition(), cameraPos );
+
+    return (m_FramesSinceUpdate + 1) / (1.0f + distance);
+}
+
+int ReflectionProbeComponent::RenderNextFace(DrawList* pDrawList, const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, const LightView& lights)
+{
+    int face = m_NextFace;
+    vec3 pos = m_pGameObject->GetTransform()->GetWorldPosition();
+
+    matrix viewMatrix;
+    CreateViewMatrix( face, pos, viewMatrix );
+
+    matrix projMatrix;
+    projMatrix.CreatePerspectiveVFoV( 90.f, 1.f, m_NearZ, m_FarZ );
+
+    m_pCamera->GetTransform()->SetPosition( pos );
+    m_pCamera->SetViewMatrix( viewMatrix );
+    m_pCamera->SetProjecMatrix( projMatrix );
+
+    // Skip the probe's own object and anything sampling this cubemap, GL can't read and write the same texture.
+    m_MeshesToDraw.clear();
+    m_TransformsToDraw.clear();
+    for( size_t i=0; i<meshComponents.size(); i++ )
+    {
+        MeshComponent* pMeshComponent = static_cast<MeshComponent*>( meshComponents[i] );
+
+        if( pMeshComponent->GetGameObject() == m_pGameObject || pMeshComponent->GetMaterial()->GetCubemap() == m_pCubemap )
+            continue;
+
+        m_MeshesToDraw.push_back( pMeshComponent );
+        m_TransformsToDraw.push_back( transforms[i] );
+    }
+
+    glBindFramebuffer( GL_FRAMEBUFFER, m_FrameBufferID );
+    glFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, m_pCubemap->GetTextureID(), 0 );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthBufferID );
+
+    glViewport( 0, 0, m_Resolution, m_Resolution );
+    glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+
+    pDrawList->Build( m_pCamera, m_MeshesToDraw, m_TransformsToDraw, lights );
+    pDrawList->Submit( m_pCamera );
+
+    m_NextFace = (m_NextFace + 1) % NumFaces;
+    m_FramesSinceUpdate = 0;
+
+    // Mips are only rebuilt once all 6 faces are up to date.
+    if( m_NextFace == 0 )
+    {
+        m_HasCompleteCubemap = true;
+
+        if( m_GenerateMips )
+        {
+            glBindTexture( GL_TEXTURE_CUBE_MAP, m_pCubemap->GetTextureID() );
+            glGenerateMipmap( GL_TEXTURE_CUBE_MAP );
+            glBindTexture( GL_TEXTURE_CUBE_MAP, 0 );
+        }
+    }
+
+    return static_cast<int>( m_MeshesToDraw.size() );
+}
+
+void ReflectionProbeComponent::CreateViewMatrix(int face, vec3 pos, matrix& viewMatrix)
+{
+    const vec3& right = c_FaceRight[face];
+    const vec3& up = c_FaceUp[face];
+    const vec3& forward = c_FaceForward[face];
+
+    viewMatrix.SetAxesView( right, up, forward, vec3( -right.Dot( pos ), -up.Dot( pos ), -forward.Dot( pos ) ) );
+}
+
+} // namespace fw
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Component.h"
+#include "ComponentPool.h"
+#include "Math/Vector.h"
+#include "Math/Matrix.h"
+#include "Objects/DrawList.h"
+
+namespace fw {
+
+class Camera;
+class Material;
+class Texture;
+class TransformComponent;
+
+struct ReflectionProbeStats
+{
+    unsigned int probesConsidered = 0;
+    unsigned int facesRendered = 0;
+    unsigned int drawsSubmitted = 0;
+    double updateTimeMs = 0;
+};
+
+// Renders the scene around its game object into a low resolution cubemap.
+// Faces are rendered a few at a time by the ComponentManager, so a full refresh is spread over several frames.
+// Materials added as targets sample the probe's cubemap instead of their own until the probe is destroyed.
+class ReflectionProbeComponent : public Component
+{
+public:
+    static const int NumFaces = 6;
+
+public:
+    ReflectionProbeComponent(int resolution = 128, bool generateMips = false);
+    virtual ~ReflectionProbeComponent();
+
+    static const char* GetStaticType() { return "ReflectionProbeComponent"; }
+    virtual const char* GetType() override { return GetStaticType(); }
+
+    virtual void SetGameObject(GameObject* pGameObject) override;
+
+    void AddTargetMaterial(Material* pMaterial);
+
+    // Higher for probes close to the camera and for probes that haven't been refreshed in a while.
+    float GetUpdatePriority(vec3 cameraPos);
+
+    // Renders the next face in line, returns the number of draws submitted.
+    // The transforms are the meshes' own, in the same order.
+    int RenderNextFace(DrawList* pDrawList, const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, const LightView& lights);
+
+    // Called once per frame whether or not a face was rendered.
+    void EndFrame() { m_FramesSinceUpdate++; }
+
+    // Getters.
+    Texture* GetCubemap() { return m_pCubemap; }
+    int GetResolution() { return m_Resolution; }
+    int GetNextFace() { return m_NextFace; }
+    bool HasCompleteCubemap() { return m_HasCompleteCubemap; }
+
+    // Setters.
+    void SetNearFar(float nearZ, float farZ) { m_NearZ = nearZ; m_FarZ = farZ; }
+
+protected:
+    void CreateViewMatrix(int face, vec3 pos, matrix& viewMatrix);
+
+protected:
+    int m_Resolution = 128;
+    bool m_GenerateMips = false;
+
+    Texture* m_pCubemap = nullptr;
+    GLuint m_FrameBufferID = 0;
+    GLuint m_DepthBufferID = 0;
+
+    // Stand-in camera for the probe's point of view, only its matrices and position are used.
+    Camera* m_pCamera = nullptr;
+
+    float m_NearZ = 0.01f;
+    float m_FarZ = 100.f;
+
+    int m_NextFace = 0;
+    unsigned int m_FramesSinceUpdate = 0;
+    bool m_HasCompleteCubemap = false;
+
+    std::vector<Component*> m_MeshesToDraw;
+    std::vector<TransformComponent*> m_TransformsToDraw;
+
+    // Targets and the cubemaps they had before the probe took over.
+    std::vector<Material*> m_TargetMaterials;
+    std::vector<Texture*> m_OriginalCubemaps;
+};
+
+} // namespace fw
@@ -0,0 +1,64 @@
+#include "CoreHeaders.h"
+
+#include "System.h"
+#include "Utility/Utility.h"
+
+namespace fw {
+
+static thread_local System* t_pCurrentSystem = nullptr;
+
+System::System(const char* name, SystemStage stage)
+{
+    m_Name = name;
+    m_Stage = stage;
+}
+
+System::~System()
+{
+}
+
+bool System::ConflictsWith(const System* pOther) const
+{
+    return (m_WriteMask & (pOther->m_ReadMask | pOther->m_WriteMask)) != 0
+        || (pOther->m_WriteMask & (m_ReadMask | m_WriteMask)) != 0;
+}
+
+System* System::GetCurrent()
+{
+    return t_pCurrentSystem;
+}
+
+void System::CheckAccess(ComponentTypeID typeID, bool write)
+{
+    uint32_t bit = 1u << typeID;
+    uint32_t declared = write ? m_WriteMask : (m_ReadMask | m_WriteMask);
+    if (declared & bit)
+        return;
+
+    if (m_ReportedMask.fetch_or(bit) & bit)
+        return;
+
+    OutputMessage("System %s %s %s without declaring it.\n", m_Name, write ? "writes" : "reads", GetComponentTypeName(typeID).c_str());
+}
+
+SystemScope::SystemScope(System* pSystem)
+{
+    m_pPreviousSystem = t_pCurrentSystem;
+    t_pCurrentSystem = pSystem;
+}
+
+SystemScope::~SystemScope()
+{
+    t_pCurrentSystem = m_pPreviousSystem;
+}
+
+void CheckSystemAccess(ComponentTypeID typeID, bool write)
+{
+    System* pSystem = t_pCurrentSystem;
+    if (pSystem)
+    {
+        pSystem->CheckAccess(typeID, write);
+    }
+}
+
+} // namespace fw
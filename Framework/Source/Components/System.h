@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Components/ComponentManager.h"
+#include "Utility/JobSystem.h"
+
+namespace fw {
+
+// Per-frame work over every component of some types. Each system declares in its constructor which component
+// types it reads and writes, and ComponentManager::Update() runs the ones that don't conflict at the same time.
+// Systems that conflict run in the order they were added, and systems only wait on others in the same stage.
+class System
+{
+    friend class ComponentManager;
+
+public:
+    System(const char* name, SystemStage stage = SystemStage::AfterPhysics);
+    virtual ~System();
+
+    virtual void Update(ComponentManager* pManager, float deltaTime) = 0;
+
+    const char* GetName() const { return m_Name; }
+    SystemStage GetStage() const { return m_Stage; }
+    uint32_t GetReadMask() const { return m_ReadMask; }
+    uint32_t GetWriteMask() const { return m_WriteMask; }
+
+    // True when one of them writes a type the other reads or writes.
+    bool ConflictsWith(const System* pOther) const;
+
+    // The system running on this thread, null outside of System::Update().
+    static System* GetCurrent();
+
+    // Reports undeclared accesses from the running system, once per system and type. Needs FW_CHECK_SYSTEM_ACCESS.
+    void CheckAccess(ComponentTypeID typeID, bool write);
+
+protected:
+    template <class Type> void Reads() { m_ReadMask |= 1u << GetComponentTypeID<Type>(); }
+    template <class Type> void Writes() { m_WriteMask |= 1u << GetComponentTypeID<Type>(); }
+
+    // Calls func(pComponent) on every enabled component of the type, in chunks spread across the manager's job system.
+    // func must only write to the component it's given and its own GameObject.
+    template <class Type, class Func> void ForEach(ComponentManager* pManager, Func func, size_t minChunkSize = 64);
+
+protected:
+    const char* m_Name = nullptr;
+    SystemStage m_Stage = SystemStage::AfterPhysics;
+
+    uint32_t m_ReadMask = 0;
+    uint32_t m_WriteMask = 0;
+
+    // Types already reported by CheckAccess(), chunks of one system can report from several threads.
+    std::atomic<uint32_t> m_ReportedMask{ 0 };
+};
+
+// Makes a system the current one on this thread for as long as it's in scope.
+class SystemScope
+{
+public:
+    SystemScope(System* pSystem);
+    ~SystemScope();
+
+protected:
+    System* m_pPreviousSystem = nullptr;
+};
+
+template <class Type, class Func> void System::ForEach(ComponentManager* pManager, Func func, size_t minChunkSize)
+{
+    ComponentRange<Component> components = pManager->GetPool<Type>()->GetComponents();
+
+    auto updateRange = [this, components, &func](size_t begin, size_t end)
+    {
+        // Chunks can be picked up by any worker, which doesn't know which system it's running for.
+        SystemScope scope(this);
+        for (size_t i = begin; i < end; i++)
+        {
+            func(static_cast<Type*>(components[i]));
+        }
+    };
+
+    if (pManager->GetJobSystem())
+    {
+        pManager->GetJobSystem()->ParallelFor(m_Name, components.size(), updateRange, minChunkSize);
+    }
+    else
+    {
+        updateRange(0, components.size());
+    }
+}
+
+} // namespace fw
@@ -1,7 +1,11 @@
 #include "CoreHeaders.h"
 
 #include "TransformComponent.h"
+#include "TransformHierarchy.h"
 #include "Objects/Mesh.h"
+#include "Utility/SlabAllocator.h"
+
+#include <algorithm>
 
 namespace fw {
 
@@ -11,10 +15,117 @@ TransformComponent::TransformComponent(vec3 pos, vec3 rot, vec3 scale) :m_positi
 
 TransformComponent::~TransformComponent()
 {
+	if (m_pHierarchy)
+	{
+		m_pHierarchy->Remove(this);
+	}
+
+	// Orphans become roots and keep their local values.
+	for (TransformComponent* pChild : m_Children)
+	{
+		pChild->m_pParent = nullptr;
+		pChild->MarkDirty();
+	}
+
+	SetParent(nullptr);
+}
+
+void* TransformComponent::operator new(size_t size)
+{
+    return SlabArena::Allocate(GetSlabTypeID<TransformComponent>(GetStaticType()), size);
+}
+
+void TransformComponent::operator delete(void* p, size_t size)
+{
+    SlabArena::Free(GetSlabTypeID<TransformComponent>(GetStaticType()), p, size);
 }
 
 void TransformComponent::UpdateWorldTransform()
 {
-	m_worldTransform.CreateSRT(m_scale, m_rotation, m_position);
+	if (!m_isDirty)
+		return;
+
+	RebuildWorldTransform();
+
+	// It's clean now, so the hierarchy would skip it, the children have to be listed themselves.
+	for (TransformComponent* pChild : m_Children)
+	{
+		pChild->MarkDirty();
+	}
+}
+
+void TransformComponent::SetParent(TransformComponent* pParent)
+{
+	if (pParent == m_pParent)
+		return;
+
+	// No loops.
+	assert(pParent != this && (pParent == nullptr || !pParent->IsDescendantOf(this)));
+
+	if (m_pParent)
+	{
+		std::vector<TransformComponent*>& siblings = m_pParent->m_Children;
+		siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+	}
+
+	m_pParent = pParent;
+
+	if (m_pParent)
+	{
+		m_pParent->m_Children.push_back(this);
+	}
+
+	MarkDirty();
+
+	if (m_pHierarchy)
+	{
+		m_pHierarchy->OnParentChanged(this);
+	}
+}
+
+bool TransformComponent::IsDescendantOf(const TransformComponent* pTransform) const
+{
+	for (const TransformComponent* pAncestor = m_pParent; pAncestor != nullptr; pAncestor = pAncestor->m_pParent)
+	{
+		if (pAncestor == pTransform)
+			return true;
+	}
+
+	return false;
+}
+
+void TransformComponent::NotifyHierarchy()
+{
+	m_pHierarchy->OnDirty(this);
+}
+
+void TransformComponent::RebuildWorldTransform()
+{
+	matrix rotation;
+	if (m_useQuaternion)
+	{
+		m_worldTransform.CreateSRT(m_scale, m_rotationQuat, m_position, rotation);
+	}
+	else
+	{
+		m_worldTransform.CreateSRT(m_scale, m_rotation, m_position, rotation);
+	}
+
+	// The inverse transpose of rotation * scale is rotation * 1/scale, which is just the rotation when scale is uniform.
+	m_normalMatrix = mat3(rotation);
+	bool uniformScale = fequal(m_scale.x, m_scale.y) && fequal(m_scale.y, m_scale.z);
+	if (!uniformScale && m_scale.x != 0 && m_scale.y != 0 && m_scale.z != 0)
+	{
+		m_normalMatrix.ScaleColumns(vec3(1 / m_scale.x, 1 / m_scale.y, 1 / m_scale.z));
+	}
+
+	// The inverse transpose of a product is the product of the inverse transposes.
+	if (m_pParent)
+	{
+		m_worldTransform = m_pParent->m_worldTransform * m_worldTransform;
+		m_normalMatrix = m_pParent->m_normalMatrix * m_normalMatrix;
+	}
+
+	m_isDirty = false;
 }
 } // namespace fw
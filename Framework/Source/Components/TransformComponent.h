@@ -3,34 +3,92 @@
 #include "Component.h"
 #include "Math/Vector.h"
 #include "Math/Matrix.h"
+#include "Math/Quaternion.h"
 
 namespace fw {
 
+class TransformHierarchy;
+
+// Position, rotation and scale are local, relative to the parent if there is one.
 class TransformComponent : public Component
 {
+    friend class TransformHierarchy;
+
 protected:
 	matrix m_worldTransform;
+	mat3 m_normalMatrix; // Inverse transpose of the world transform's 3x3, used to rotate normals.
 	vec3 m_position;
 	vec3 m_rotation;
 	vec3 m_scale;
 
+	// Set by SetRotation(quat), the Euler angles are ignored until SetRotation(vec3) is called again.
+	quat m_rotationQuat;
+	bool m_useQuaternion = false;
+
+	// Set by any change, UpdateWorldTransform() does nothing until then.
+	bool m_isDirty = true;
+
+	TransformComponent* m_pParent = nullptr;
+	std::vector<TransformComponent*> m_Children;
+
+	// Set while a ComponentManager holds this transform, it's told whenever this gets dirty.
+	TransformHierarchy* m_pHierarchy = nullptr;
+	int m_HierarchyIndex = -1;
+	int m_DirtyList = 0; // Which of the hierarchy's per-thread dirty lists it's on.
+	int m_DirtyIndex = -1; // Slot in that list, -1 when not on it.
+
 public:
 	TransformComponent(vec3 pos, vec3 rot, vec3 scale);
     virtual ~TransformComponent();
 
+    // Allocated from the current SlabArena, see Utility/SlabAllocator.h.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
     static const char* GetStaticType() { return "TransformComponent"; }
     virtual const char* GetType() override { return GetStaticType(); }
 
+	// Rebuilds the world matrix if anything changed, the parent's world matrix has to be up to date. Children are flagged to follow.
+	// Transforms in a ComponentManager are updated by its TransformHierarchy, in the right order.
 	void UpdateWorldTransform();
 	const matrix& GetWorldTransform() const { return m_worldTransform; };
+	const mat3& GetNormalMatrix() const { return m_normalMatrix; };
+	vec3 GetWorldPosition() const { return m_worldTransform.GetTranslation(); }
+
+	// Local values are kept, so the transform moves with its new parent from where it is relative to it.
+	void SetParent(TransformComponent* pParent);
+	TransformComponent* GetParent() { return m_pParent; }
+	const std::vector<TransformComponent*>& GetChildren() { return m_Children; }
+	bool IsDescendantOf(const TransformComponent* pTransform) const;
 
 	vec3 GetPosition() { return m_position; }
-	vec3 GetRotation() { return m_rotation; }
+	vec3 GetRotation() { return m_useQuaternion ? m_rotationQuat.GetEulerAngles() : m_rotation; }
+	quat GetRotationQuat() { return m_useQuaternion ? m_rotationQuat : quat::CreateEuler(m_rotation); }
+	bool IsUsingQuaternion() { return m_useQuaternion; }
 	vec3 GetScale() { return m_scale; }
 
-	void SetPosition(vec3 pos) { m_position = pos; }
-	void SetRotation(vec3 rot) { m_rotation = rot; }
-	void SetScale(vec3 scale) { m_scale = scale; }
+	void SetPosition(vec3 pos) { m_position = pos; MarkDirty(); }
+	void SetRotation(vec3 rot) { m_rotation = rot; m_useQuaternion = false; MarkDirty(); }
+	void SetRotation(const quat& rot) { m_rotationQuat = rot; m_useQuaternion = true; MarkDirty(); }
+	void SetScale(vec3 scale) { m_scale = scale; MarkDirty(); }
+
+	bool IsDirty() const { return m_isDirty; }
+	void MarkDirty()
+	{
+#if FW_CHECK_SYSTEM_ACCESS
+		CheckSystemAccess(GetComponentTypeID<TransformComponent>(), true);
+#endif
+		if (!m_isDirty)
+		{
+			m_isDirty = true;
+			if (m_pHierarchy)
+				NotifyHierarchy();
+		}
+	}
+
+protected:
+	void NotifyHierarchy();
+	void RebuildWorldTransform();
 };
 
 } // namespace fw
@@ -0,0 +1,256 @@
+#include "CoreHeaders.h"
+
+#include "TransformHierarchy.h"
+#include "TransformComponent.h"
+
+#include <algorithm>
+
+namespace fw {
+
+// Below this many moved transforms the jobs cost more than they save.
+static const size_t c_MinDirtyNodesForJobs = 1024;
+
+TransformHierarchy::TransformHierarchy(JobSystem* pJobSystem)
+{
+    m_pJobSystem = pJobSystem;
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+    // Transforms take themselves out when they're deleted, so anything left is still alive.
+    for (TransformComponent* pTransform : m_Nodes)
+    {
+        if (pTransform)
+        {
+            pTransform->m_pHierarchy = nullptr;
+            pTransform->m_HierarchyIndex = -1;
+        }
+    }
+}
+
+void TransformHierarchy::Add(TransformComponent* pTransform)
+{
+    assert(pTransform->m_pHierarchy == nullptr);
+
+    // The parent, if it's here, is already further up the list.
+    pTransform->m_pHierarchy = this;
+    pTransform->m_HierarchyIndex = static_cast<int>(m_Nodes.size());
+    m_Nodes.push_back(pTransform);
+
+    // Children added before their parent have to move down below it.
+    for (TransformComponent* pChild : pTransform->m_Children)
+    {
+        if (pChild->m_pHierarchy == this)
+        {
+            MoveSubtreeToBack(pChild);
+        }
+    }
+    CompactIfSparse();
+
+    if (pTransform->m_isDirty)
+    {
+        OnDirty(pTransform);
+    }
+}
+
+void TransformHierarchy::Remove(TransformComponent* pTransform)
+{
+    assert(pTransform->m_pHierarchy == this);
+
+    // Cleared rather than erased, so removing lots of new transforms isn't quadratic.
+    if (pTransform->m_DirtyIndex >= 0)
+    {
+        m_ThreadDirtyNodes[pTransform->m_DirtyList][pTransform->m_DirtyIndex] = nullptr;
+        pTransform->m_DirtyIndex = -1;
+    }
+
+    m_Nodes[pTransform->m_HierarchyIndex] = nullptr;
+    m_NumRemoved++;
+
+    pTransform->m_pHierarchy = nullptr;
+    pTransform->m_HierarchyIndex = -1;
+
+    CompactIfSparse();
+}
+
+void TransformHierarchy::Update()
+{
+    m_NumRebuilt = 0;
+
+    GatherDirtyNodes();
+    if (m_DirtyNodes.empty())
+        return;
+
+    if (m_pJobSystem && m_pJobSystem->GetNumThreads() > 1 && m_DirtyNodes.size() >= c_MinDirtyNodesForJobs)
+    {
+        UpdateInParallel();
+    }
+    else if (m_DirtyNodes.size() * 4 < GetSize())
+    {
+        // A few movers, sorted so parents go first and rebuild their children along with them.
+        std::sort(m_DirtyNodes.begin(), m_DirtyNodes.end(),
+            [](const TransformComponent* a, const TransformComponent* b) { return a->m_HierarchyIndex < b->m_HierarchyIndex; });
+
+        for (TransformComponent* pTransform : m_DirtyNodes)
+        {
+            // Already done if an ancestor was dirty too.
+            if (pTransform->m_isDirty)
+            {
+                m_NumRebuilt += RebuildSubtree(pTransform);
+            }
+        }
+    }
+    else
+    {
+        // Lots of movers, one pass down the list. A rebuilt transform flags its children, which come later.
+        for (TransformComponent* pTransform : m_Nodes)
+        {
+            if (pTransform == nullptr || !pTransform->m_isDirty)
+                continue;
+
+            pTransform->RebuildWorldTransform();
+            m_NumRebuilt++;
+
+            for (TransformComponent* pChild : pTransform->m_Children)
+            {
+                if (pChild->m_pHierarchy == this)
+                {
+                    pChild->m_isDirty = true;
+                }
+                else
+                {
+                    m_NumRebuilt += RebuildSubtree(pChild);
+                }
+            }
+        }
+    }
+
+    m_DirtyNodes.clear();
+}
+
+void TransformHierarchy::GatherDirtyNodes()
+{
+    m_DirtyNodes.clear();
+
+    for (std::vector<TransformComponent*>& dirtyNodes : m_ThreadDirtyNodes)
+    {
+        for (TransformComponent* pTransform : dirtyNodes)
+        {
+            if (pTransform)
+            {
+                pTransform->m_DirtyIndex = -1;
+                m_DirtyNodes.push_back(pTransform);
+            }
+        }
+        dirtyNodes.clear();
+    }
+}
+
+void TransformHierarchy::UpdateInParallel()
+{
+    // Subtrees of the roots don't overlap, so each one can be rebuilt top down on any thread.
+    m_DirtyRoots.clear();
+    for (TransformComponent* pTransform : m_DirtyNodes)
+    {
+        bool hasDirtyAncestor = false;
+        for (TransformComponent* pAncestor = pTransform->m_pParent; pAncestor != nullptr && !hasDirtyAncestor; pAncestor = pAncestor->m_pParent)
+        {
+            hasDirtyAncestor = pAncestor->m_pHierarchy == this && pAncestor->m_isDirty;
+        }
+
+        if (!hasDirtyAncestor)
+        {
+            m_DirtyRoots.push_back(pTransform);
+        }
+    }
+
+    std::atomic<unsigned int> numRebuilt{ 0 };
+    m_pJobSystem->ParallelFor("TransformHierarchy::Update", m_DirtyRoots.size(), [this, &numRebuilt](size_t begin, size_t end)
+        {
+            unsigned int count = 0;
+            for (size_t i = begin; i < end; i++)
+            {
+                count += RebuildSubtree(m_DirtyRoots[i]);
+            }
+            numRebuilt += count;
+        }, 256);
+
+    m_NumRebuilt = numRebuilt;
+}
+
+void TransformHierarchy::OnDirty(TransformComponent* pTransform)
+{
+    // Still listed if UpdateWorldTransform() cleaned it since.
+    if (pTransform->m_DirtyIndex >= 0)
+        return;
+
+    std::vector<TransformComponent*>& dirtyNodes = m_ThreadDirtyNodes[JobSystem::GetCurrentWorkerIndex()];
+    pTransform->m_DirtyList = static_cast<int>(JobSystem::GetCurrentWorkerIndex());
+    pTransform->m_DirtyIndex = static_cast<int>(dirtyNodes.size());
+    dirtyNodes.push_back(pTransform);
+}
+
+void TransformHierarchy::OnParentChanged(TransformComponent* pTransform)
+{
+    TransformComponent* pParent = pTransform->m_pParent;
+
+    if (pParent && pParent->m_pHierarchy == this && pParent->m_HierarchyIndex > pTransform->m_HierarchyIndex)
+    {
+        MoveSubtreeToBack(pTransform);
+        CompactIfSparse();
+    }
+}
+
+unsigned int TransformHierarchy::RebuildSubtree(TransformComponent* pTransform)
+{
+    pTransform->RebuildWorldTransform();
+    unsigned int count = 1;
+
+    for (TransformComponent* pChild : pTransform->m_Children)
+    {
+        count += RebuildSubtree(pChild);
+    }
+
+    return count;
+}
+
+void TransformHierarchy::MoveSubtreeToBack(TransformComponent* pTransform)
+{
+    // Depth first, so each one is appended after its parent.
+    m_Nodes[pTransform->m_HierarchyIndex] = nullptr;
+    m_NumRemoved++;
+
+    pTransform->m_HierarchyIndex = static_cast<int>(m_Nodes.size());
+    m_Nodes.push_back(pTransform);
+
+    for (TransformComponent* pChild : pTransform->m_Children)
+    {
+        if (pChild->m_pHierarchy == this)
+        {
+            MoveSubtreeToBack(pChild);
+        }
+    }
+}
+
+void TransformHierarchy::CompactIfSparse()
+{
+    // Holes are cheap to skip, only close them once they're half the list.
+    if (m_NumRemoved <= 64 || m_NumRemoved * 2 <= m_Nodes.size())
+        return;
+
+    // Keeps the order, so parents still come first.
+    size_t count = 0;
+    for (TransformComponent* pTransform : m_Nodes)
+    {
+        if (pTransform)
+        {
+            pTransform->m_HierarchyIndex = static_cast<int>(count);
+            m_Nodes[count++] = pTransform;
+        }
+    }
+
+    m_Nodes.resize(count);
+    m_NumRemoved = 0;
+}
+
+} // namespace fw
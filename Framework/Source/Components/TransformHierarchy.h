@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Utility/JobSystem.h"
+
+namespace fw {
+
+class TransformComponent;
+
+// Every transform in a ComponentManager, kept in an order where parents always come before their children.
+// Transforms report themselves when they change, so Update() only touches what moved and whatever is under it,
+// a scene that doesn't move costs nothing. Each thread has its own dirty list, so jobs can move transforms at
+// the same time as long as no two touch the same one.
+class TransformHierarchy
+{
+    friend class TransformComponent;
+
+public:
+    TransformHierarchy(JobSystem* pJobSystem = nullptr);
+    virtual ~TransformHierarchy();
+
+    void Add(TransformComponent* pTransform);
+    void Remove(TransformComponent* pTransform);
+
+    // Rebuilds the world matrices of dirty transforms and their children, spread across the job system when lots moved.
+    void Update();
+
+    // World matrices rebuilt by the last Update().
+    unsigned int GetNumRebuilt() const { return m_NumRebuilt; }
+    size_t GetSize() const { return m_Nodes.size() - m_NumRemoved; }
+
+protected:
+    void OnDirty(TransformComponent* pTransform);
+    void OnParentChanged(TransformComponent* pTransform);
+
+    void GatherDirtyNodes();
+    void UpdateInParallel();
+
+    unsigned int RebuildSubtree(TransformComponent* pTransform);
+    void MoveSubtreeToBack(TransformComponent* pTransform);
+    void CompactIfSparse();
+
+protected:
+    JobSystem* m_pJobSystem = nullptr;
+
+    // Parents before children, with nullptr left behind by removals and moves until they're compacted.
+    std::vector<TransformComponent*> m_Nodes;
+    size_t m_NumRemoved = 0;
+
+    // Indexed by JobSystem::GetCurrentWorkerIndex(), gathered into m_DirtyNodes by Update().
+    std::vector<TransformComponent*> m_ThreadDirtyNodes[JobSystem::MaxWorkers];
+    std::vector<TransformComponent*> m_DirtyNodes;
+
+    // Dirty transforms without a dirty ancestor, their subtrees don't overlap.
+    std::vector<TransformComponent*> m_DirtyRoots;
+
+    unsigned int m_NumRebuilt = 0;
+};
+
+} // namespace fw
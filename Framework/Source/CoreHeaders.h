@@ -8,9 +8,11 @@
 // Has to be included before Windows.h otherwise has issues with min/max defines.
 #include "../Libraries/pcg-cpp/include/pcg_random.hpp"
 
+#if _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #include <windowsx.h>
+#endif
 
 #include <assert.h>
 #include <malloc.h>
@@ -25,9 +27,18 @@
 #include <queue>
 #include <string>
 
+// Everything outside of Windows builds without a window, see FWCore.h.
+#if _WIN32
 #include <GL/GL.h>
 #include "GL/glext.h"
 #include "GL/wglext.h"
+#else
+#include <GL/gl.h>
+#include "GL/glext.h"
+#include "Utility/Portability.h"
+#endif
 
 #include "GL/GLExtensions.h"
+#if _WIN32
 #include "GL/WGLExtensions.h"
+#endif
@@ -14,9 +14,12 @@
 #include "Events/Event.h"
 #include "Events/EventManager.h"
 #include "GL/GLExtensions.h"
+#include "GL/GLRecorder.h"
 #include "GL/WGLExtensions.h"
 #include "GL/MyGLContext.h"
 #include "Math/Vector.h"
+#include "Utility/FrameBenchmark.h"
+#include "Utility/JobSystem.h"
 #include "Utility/Utility.h"
 
 namespace fw {
@@ -28,8 +31,9 @@ namespace fw {
 
 // Public methods
 
-FWCore::FWCore(int width, int height)
+FWCore::FWCore(int width, int height, GLBackend backend)
 {
+    m_Backend = backend;
     m_pEventManager = new EventManager();
 
     Init( width, height );
@@ -47,6 +51,13 @@ bool FWCore::Init(int width, int height)
     m_WindowWidth = width;
     m_WindowHeight = height;
 
+    // Headless, no window or context, every extension call is answered by the recorder.
+    if( m_Backend == GLBackend::NullShim )
+    {
+        GLRecorder::Install( GLBackend::NullShim );
+        return true;
+    }
+
     // Create Our OpenGL Window.
     if( !CreateGLWindow( "OpenGL Window", width, height, 32, 0, 24, 8, 1, m_FullscreenMode ) )
     {
@@ -58,6 +69,10 @@ bool FWCore::Init(int width, int height)
     OpenGL_InitExtensions();
     WGL_InitExtensions();
 
+    // Wrap the driver's entry points so calls can be counted.
+    if( m_Backend == GLBackend::Recording )
+        GLRecorder::Install( GLBackend::Recording );
+
     return true;
 }
 
@@ -92,6 +107,7 @@ int FWCore::Run(GameCore& game)
             game.StartFrame( deltaTime );
             m_pEventManager->ProcessEvents();
             game.Update( deltaTime );
+            game.GetJobSystem()->RunMainThreadJobs();
             game.Draw();
 
             SwapBuffers();
@@ -109,8 +125,30 @@ int FWCore::Run(GameCore& game)
     return static_cast<int>( message.wParam );
 }
 
+int FWCore::RunBenchmark(GameCore& game, const BenchmarkSettings& settings)
+{
+    return RunFrameBenchmark( game, m_pEventManager, m_Backend, settings, [this]()
+    {
+        // Keep the window responsive, but don't let input drive the run.
+        MSG message;
+        while( m_hWnd && PeekMessage( &message, nullptr, 0, 0, PM_REMOVE ) )
+        {
+            if( message.message == WM_QUIT )
+                return false;
+
+            TranslateMessage( &message );
+            DispatchMessage( &message );
+        }
+
+        SwapBuffers();
+        return true;
+    } );
+}
+
 void FWCore::Shutdown()
 {
+    GLRecorder::Uninstall();
+
     KillGLWindow( true );
     PostQuitMessage(0);
 }
@@ -192,7 +230,8 @@ void FWCore::GetMouseCoordinates(int* mx, int* my)
 
 void FWCore::SwapBuffers()
 {
-    ::SwapBuffers( m_hDeviceContext );
+    if( m_hDeviceContext )
+        ::SwapBuffers( m_hDeviceContext );
 }
 
 // Protected methods.
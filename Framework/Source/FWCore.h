@@ -1,19 +1,26 @@
 #pragma once
 
+#include "GL/GLRecorder.h"
+#include "Utility/FrameBenchmark.h"
+
 namespace fw {
 
 class EventManager;
 class GameCore;
 class MyGLContext;
 
+// The window, GL context and input, on Windows.
+// Elsewhere there's no window (see FWCoreHeadless.cpp), only the NullShim backend and RunBenchmark() are available.
 class FWCore
 {
 public:
-    FWCore(int width, int height);
+    FWCore(int width, int height, GLBackend backend = GLBackend::Native);
     virtual ~FWCore();
 
     bool Init(int width, int height);
     int Run(GameCore& game);
+    // See RunFrameBenchmark(), swaps buffers between frames when there's a window.
+    int RunBenchmark(GameCore& game, const BenchmarkSettings& settings);
     void Shutdown();
 
     void SetWindowSize(int width, int height);
@@ -32,26 +39,34 @@ public:
     void SwapBuffers();
 
     EventManager* GetEventManager() { return m_pEventManager; }
+    GLBackend GetBackend() { return m_Backend; }
+    bool IsHeadless() { return m_Backend == GLBackend::NullShim; }
 
 protected:
     void ResizeWindow(int width, int height);
+#if _WIN32
     bool CreateGLWindow(char* title, int width, int height, unsigned char colorBits, unsigned char alphaBits, unsigned char zBits, unsigned char stencilBits, unsigned char multisampleSize, bool fullscreenflag);
     bool FailAndCleanup(const char* pMessage);
     void KillGLWindow(bool destroyInstance);
 
     static LRESULT CALLBACK WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam);
+#endif
 
 protected:
     bool m_EscapeKeyWillQuit = true;
 
+    GLBackend m_Backend = GLBackend::Native;
+
     int m_WindowWidth = -1;
     int m_WindowHeight = -1;
 
+#if _WIN32
     HWND m_hWnd = nullptr;
     HGLRC m_hRenderingContext = nullptr;
     HDC m_hDeviceContext = nullptr;
     HINSTANCE m_hInstance = nullptr;
     MyGLContext* m_pMyGLContext = nullptr;
+#endif
 
     EventManager* m_pEventManager = nullptr;
 
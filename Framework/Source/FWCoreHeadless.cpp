@@ -0,0 +1,108 @@
+#include "CoreHeaders.h"
+
+#include "FWCore.h"
+#include "GameCore.h"
+#include "Events/EventManager.h"
+#include "GL/GLRecorder.h"
+#include "Utility/FrameBenchmark.h"
+#include "Utility/Utility.h"
+
+namespace fw {
+
+// FWCore for builds outside of Windows, i.e. build machines running scenes with RunBenchmark().
+// There's no window, context or input, every GL call is answered by the recorder's null shim.
+
+// Public methods
+
+FWCore::FWCore(int width, int height, GLBackend backend)
+{
+    m_Backend = backend;
+    m_pEventManager = new EventManager();
+
+    Init( width, height );
+}
+
+FWCore::~FWCore()
+{
+    delete m_pEventManager;
+}
+
+bool FWCore::Init(int width, int height)
+{
+    m_WindowWidth = width;
+    m_WindowHeight = height;
+
+    if( m_Backend != GLBackend::NullShim )
+    {
+        OutputMessage( "FWCore: No window outside of Windows, using the NullShim backend.\n" );
+        m_Backend = GLBackend::NullShim;
+    }
+
+    GLRecorder::Install( GLBackend::NullShim );
+
+    return true;
+}
+
+int FWCore::Run(GameCore&)
+{
+    OutputMessage( "FWCore: Run() needs a window, use RunBenchmark() outside of Windows.\n" );
+    return 1;
+}
+
+int FWCore::RunBenchmark(GameCore& game, const BenchmarkSettings& settings)
+{
+    return RunFrameBenchmark( game, m_pEventManager, m_Backend, settings );
+}
+
+void FWCore::Shutdown()
+{
+    GLRecorder::Uninstall();
+}
+
+void FWCore::SetWindowSize(int width, int height)
+{
+    ResizeWindow( width, height );
+}
+
+void FWCore::SetWindowTitle(char*)
+{
+}
+
+void FWCore::SetIcon(char*)
+{
+}
+
+bool FWCore::IsKeyDown(int value)
+{
+    assert( value >= 0 && value < 256 );
+    return m_KeyStates[value];
+}
+
+bool FWCore::IsMouseButtonDown(int id)
+{
+    assert( id >= 0 && id < 3 );
+    return m_MouseButtonStates[id];
+}
+
+void FWCore::GetMouseCoordinates(int* mx, int* my)
+{
+    *mx = 0;
+    *my = 0;
+}
+
+void FWCore::SwapBuffers()
+{
+}
+
+// Protected methods.
+
+void FWCore::ResizeWindow(int width, int height)
+{
+    if( height <= 0 ) height = 1;
+    if( width <= 0 ) width = 1;
+
+    m_WindowWidth = width;
+    m_WindowHeight = height;
+}
+
+} // namespace fw
@@ -13,18 +13,31 @@
 #include "FWCore.h"
 #include "GameCore.h"
 #include "Components/ComponentManager.h"
+#include "Components/ComponentPool.h"
+#include "Components/ComponentView.h"
+#include "Components/System.h"
 #include "Components/MeshComponent.h"
 #include "Components/TransformComponent.h"
+#include "Components/TransformHierarchy.h"
 #include "Components/PhysicsBodyComponent.h"
 #include "Components/LightComponent.h"
+#include "Components/ReflectionProbeComponent.h"
 #include "Events/Event.h"
 #include "Events/EventManager.h"
+#include "GL/GLRecorder.h"
+#include "Math/BatchTransform.h"
+#include "Math/FastMath.h"
 #include "Math/Matrix.h"
+#include "Math/Quaternion.h"
 #include "Math/Random.h"
+#include "Math/SoAArray.h"
 #include "Math/Vector.h"
 #include "Objects/Camera.h"
+#include "Objects/DrawList.h"
+#include "Objects/EntityCommandBuffer.h"
 #include "Objects/GameObject.h"
 #include "Objects/Mesh.h"
+#include "Objects/OcclusionCuller.h"
 #include "Objects/ResourceManager.h"
 #include "Objects/Scene.h"
 #include "Objects/ShaderProgram.h"
@@ -37,4 +50,8 @@
 #include "Physics/Bullet/PhysicsWorldBullet.h"
 #include "Physics/Bullet/PhysicsBodyBullet.h"
 #include "UI/ImGuiManager.h"
+#include "Utility/FrameBenchmark.h"
+#include "Utility/JobSystem.h"
+#include "Utility/SlabAllocator.h"
+#include "Utility/SlotMap.h"
 #include "Utility/Utility.h"
@@ -10,6 +10,12 @@
 #include "CoreHeaders.h"
 #include "GLExtensions.h"
 
+#if !_WIN32
+// Outside of Windows there's no context and no libGL, GLNullDriver.cpp defines this and it returns nullptr.
+extern "C" void (*glXGetProcAddressARB(const GLubyte* procName))();
+#define wglGetProcAddress( name ) glXGetProcAddressARB( (const GLubyte*)name )
+#endif
+
 #pragma warning( push )
 #pragma warning( disable : 4191 ) // Unsafe conversion from 'type of expression' to 'type required'.
 
@@ -33,6 +39,7 @@ PFNGLUNIFORM2IVPROC                 glUniform2iv = nullptr;
 PFNGLUNIFORM3IVPROC                 glUniform3iv = nullptr;
 PFNGLUNIFORM4IVPROC                 glUniform4iv = nullptr;
 
+PFNGLUNIFORMMATRIX3FVPROC           glUniformMatrix3fv = nullptr;
 PFNGLUNIFORMMATRIX4FVPROC           glUniformMatrix4fv = nullptr;
 PFNGLVERTEXATTRIB1FPROC             glVertexAttrib1f = nullptr;
 PFNGLVERTEXATTRIB2FPROC             glVertexAttrib2f = nullptr;
@@ -99,6 +106,13 @@ PFNGLBINDVERTEXARRAYPROC            glBindVertexArray = nullptr;
 
 PFNGLGENERATEMIPMAPPROC             glGenerateMipmap = nullptr;
 
+PFNGLMAPBUFFERRANGEPROC             glMapBufferRange = nullptr;
+PFNGLUNMAPBUFFERPROC                glUnmapBuffer = nullptr;
+
+PFNGLFENCESYNCPROC                  glFenceSync = nullptr;
+PFNGLCLIENTWAITSYNCPROC             glClientWaitSync = nullptr;
+PFNGLDELETESYNCPROC                 glDeleteSync = nullptr;
+
 PFNGLDRAWARRAYSINSTANCEDPROC        glDrawArraysInstanced = nullptr;      //(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 PFNGLDRAWELEMENTSINSTANCEDPROC      glDrawElementsInstanced = nullptr;    //(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
 PFNGLVERTEXATTRIBDIVISORPROC        glVertexAttribDivisor = nullptr;      //(GLuint index, GLuint divisor);
@@ -126,6 +140,7 @@ void OpenGL_InitExtensions()
     glUniform2fv                    = (PFNGLUNIFORM2FVPROC)                 wglGetProcAddress( "glUniform2fv" );
     glUniform3fv                    = (PFNGLUNIFORM3FVPROC)                 wglGetProcAddress( "glUniform3fv" );
     glUniform4fv                    = (PFNGLUNIFORM4FVPROC)                 wglGetProcAddress( "glUniform4fv" );
+    glUniformMatrix3fv              = (PFNGLUNIFORMMATRIX3FVPROC)           wglGetProcAddress( "glUniformMatrix3fv" );
     glUniformMatrix4fv              = (PFNGLUNIFORMMATRIX4FVPROC)           wglGetProcAddress( "glUniformMatrix4fv" );
     glVertexAttrib1f                = (PFNGLVERTEXATTRIB1FPROC)             wglGetProcAddress( "glVertexAttrib1f" );
     glVertexAttrib2f                = (PFNGLVERTEXATTRIB2FPROC)             wglGetProcAddress( "glVertexAttrib2f" );
@@ -223,6 +238,13 @@ void OpenGL_InitExtensions()
 
     glGenerateMipmap                = (PFNGLGENERATEMIPMAPPROC)             wglGetProcAddress( "glGenerateMipmap" );
 
+    glMapBufferRange                = (PFNGLMAPBUFFERRANGEPROC)             wglGetProcAddress( "glMapBufferRange" );
+    glUnmapBuffer                   = (PFNGLUNMAPBUFFERPROC)                wglGetProcAddress( "glUnmapBuffer" );
+
+    glFenceSync                     = (PFNGLFENCESYNCPROC)                  wglGetProcAddress( "glFenceSync" );
+    glClientWaitSync                = (PFNGLCLIENTWAITSYNCPROC)             wglGetProcAddress( "glClientWaitSync" );
+    glDeleteSync                    = (PFNGLDELETESYNCPROC)                 wglGetProcAddress( "glDeleteSync" );
+
     glDrawArraysInstanced           = (PFNGLDRAWARRAYSINSTANCEDPROC)        wglGetProcAddress( "glDrawArraysInstanced" );
     glDrawElementsInstanced         = (PFNGLDRAWELEMENTSINSTANCEDPROC)      wglGetProcAddress( "glDrawElementsInstanced" );
     glVertexAttribDivisor           = (PFNGLVERTEXATTRIBDIVISORPROC)        wglGetProcAddress( "glVertexAttribDivisor" );
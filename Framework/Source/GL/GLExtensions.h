@@ -9,7 +9,16 @@
 
 #pragma once
 
+#if _WIN32
 #include <GL/GL.h>
+#else
+#include <GL/gl.h>
+
+// Mesa's gl.h already declares these as functions, the pointers below get their own names.
+#define glTexImage3D        fw_glTexImage3D
+#define glActiveTexture     fw_glActiveTexture
+#define glBlendColor        fw_glBlendColor
+#endif
 #include "glext.h"
 
 void OpenGL_InitExtensions();
@@ -34,6 +43,7 @@ extern PFNGLUNIFORM2IVPROC                  glUniform2iv;
 extern PFNGLUNIFORM3IVPROC                  glUniform3iv;
 extern PFNGLUNIFORM4IVPROC                  glUniform4iv;
 
+extern PFNGLUNIFORMMATRIX3FVPROC            glUniformMatrix3fv;
 extern PFNGLUNIFORMMATRIX4FVPROC            glUniformMatrix4fv;
 extern PFNGLVERTEXATTRIB1FPROC              glVertexAttrib1f;
 extern PFNGLVERTEXATTRIB2FPROC              glVertexAttrib2f;
@@ -101,6 +111,13 @@ extern PFNGLBINDVERTEXARRAYPROC             glBindVertexArray;
 
 extern PFNGLGENERATEMIPMAPPROC              glGenerateMipmap;
 
+extern PFNGLMAPBUFFERRANGEPROC              glMapBufferRange;
+extern PFNGLUNMAPBUFFERPROC                 glUnmapBuffer;
+
+extern PFNGLFENCESYNCPROC                   glFenceSync;
+extern PFNGLCLIENTWAITSYNCPROC              glClientWaitSync;
+extern PFNGLDELETESYNCPROC                  glDeleteSync;
+
 extern PFNGLDRAWARRAYSINSTANCEDPROC         glDrawArraysInstanced;      //(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 extern PFNGLDRAWELEMENTSINSTANCEDPROC       glDrawElementsInstanced;    //(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
 extern PFNGLVERTEXATTRIBDIVISORPROC         glVertexAttribDivisor;      //(GLuint index, GLuint divisor);
@@ -0,0 +1,59 @@
+#include "CoreHeaders.h"
+
+// The core GL 1.1 entry points the framework calls, for builds outside of Windows.
+// There's no context there, so these stand in for libGL the way GLRecorder's NullShim stands in for the extensions.
+// They do nothing except hand out texture names and answer queries, so FBOs and textures can be created headless.
+
+static GLuint s_NextTextureName = 1;
+
+extern "C" {
+
+void (*glXGetProcAddressARB(const GLubyte*))()
+{
+    // Extensions are never loaded without a context, GLRecorder::Install() fills them in.
+    return nullptr;
+}
+
+void GLAPIENTRY glGenTextures(GLsizei n, GLuint* textures)
+{
+    for( GLsizei i=0; i<n; i++ )
+        textures[i] = s_NextTextureName++;
+}
+
+void GLAPIENTRY glGetIntegerv(GLenum pname, GLint* params)
+{
+    switch( pname )
+    {
+    case GL_MAX_RENDERBUFFER_SIZE:  params[0] = 16384; break;
+    case GL_POLYGON_MODE:           params[0] = params[1] = GL_FILL; break;
+    case GL_VIEWPORT:
+    case GL_SCISSOR_BOX:            params[0] = params[1] = params[2] = params[3] = 0; break;
+    default:                        params[0] = 0; break;
+    }
+}
+
+GLboolean GLAPIENTRY glIsEnabled(GLenum) { return GL_FALSE; }
+
+void GLAPIENTRY glDeleteTextures(GLsizei, const GLuint*) {}
+void GLAPIENTRY glBindTexture(GLenum, GLuint) {}
+void GLAPIENTRY glTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const GLvoid*) {}
+void GLAPIENTRY glTexParameteri(GLenum, GLenum, GLint) {}
+void GLAPIENTRY glReadBuffer(GLenum) {}
+void GLAPIENTRY glReadPixels(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, GLvoid*) {}
+
+void GLAPIENTRY glDrawArrays(GLenum, GLint, GLsizei) {}
+void GLAPIENTRY glDrawElements(GLenum, GLsizei, GLenum, const GLvoid*) {}
+
+void GLAPIENTRY glClear(GLbitfield) {}
+void GLAPIENTRY glClearColor(GLclampf, GLclampf, GLclampf, GLclampf) {}
+void GLAPIENTRY glViewport(GLint, GLint, GLsizei, GLsizei) {}
+void GLAPIENTRY glScissor(GLint, GLint, GLsizei, GLsizei) {}
+void GLAPIENTRY glEnable(GLenum) {}
+void GLAPIENTRY glDisable(GLenum) {}
+void GLAPIENTRY glBlendFunc(GLenum, GLenum) {}
+void GLAPIENTRY glDepthMask(GLboolean) {}
+void GLAPIENTRY glFrontFace(GLenum) {}
+void GLAPIENTRY glPolygonMode(GLenum, GLenum) {}
+void GLAPIENTRY glPointSize(GLfloat) {}
+
+} // extern "C"
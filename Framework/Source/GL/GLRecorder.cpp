@@ -0,0 +1,759 @@
+#include "CoreHeaders.h"
+
+#include "GLRecorder.h"
+#include "Utility/Utility.h"
+
+namespace fw {
+namespace GLRecorder {
+
+// Every extension entry point the recorder intercepts.
+// Anything not listed here keeps calling the driver (or stays nullptr in NullShim mode).
+#define GLRECORDER_ENTRYPOINTS( X ) \
+    X( PFNGLCREATESHADERPROC,               glCreateShader ) \
+    X( PFNGLSHADERSOURCEPROC,               glShaderSource ) \
+    X( PFNGLCOMPILESHADERPROC,              glCompileShader ) \
+    X( PFNGLGETSHADERIVPROC,                glGetShaderiv ) \
+    X( PFNGLGETSHADERINFOLOGPROC,           glGetShaderInfoLog ) \
+    X( PFNGLCREATEPROGRAMPROC,              glCreateProgram ) \
+    X( PFNGLATTACHSHADERPROC,               glAttachShader ) \
+    X( PFNGLDETACHSHADERPROC,               glDetachShader ) \
+    X( PFNGLLINKPROGRAMPROC,                glLinkProgram ) \
+    X( PFNGLGETPROGRAMIVPROC,               glGetProgramiv ) \
+    X( PFNGLGETPROGRAMINFOLOGPROC,          glGetProgramInfoLog ) \
+    X( PFNGLDELETESHADERPROC,               glDeleteShader ) \
+    X( PFNGLDELETEPROGRAMPROC,              glDeleteProgram ) \
+    X( PFNGLUSEPROGRAMPROC,                 glUseProgram ) \
+    X( PFNGLGETUNIFORMLOCATIONPROC,         glGetUniformLocation ) \
+    X( PFNGLGETATTRIBLOCATIONPROC,          glGetAttribLocation ) \
+    X( PFNGLUNIFORM1IPROC,                  glUniform1i ) \
+    X( PFNGLUNIFORM1IVPROC,                 glUniform1iv ) \
+    X( PFNGLUNIFORM1FPROC,                  glUniform1f ) \
+    X( PFNGLUNIFORM2FPROC,                  glUniform2f ) \
+    X( PFNGLUNIFORM3FPROC,                  glUniform3f ) \
+    X( PFNGLUNIFORM4FPROC,                  glUniform4f ) \
+    X( PFNGLUNIFORM1FVPROC,                 glUniform1fv ) \
+    X( PFNGLUNIFORM2FVPROC,                 glUniform2fv ) \
+    X( PFNGLUNIFORM3FVPROC,                 glUniform3fv ) \
+    X( PFNGLUNIFORM4FVPROC,                 glUniform4fv ) \
+    X( PFNGLUNIFORMMATRIX3FVPROC,           glUniformMatrix3fv ) \
+    X( PFNGLUNIFORMMATRIX4FVPROC,           glUniformMatrix4fv ) \
+    X( PFNGLENABLEVERTEXATTRIBARRAYPROC,    glEnableVertexAttribArray ) \
+    X( PFNGLDISABLEVERTEXATTRIBARRAYPROC,   glDisableVertexAttribArray ) \
+    X( PFNGLVERTEXATTRIBPOINTERPROC,        glVertexAttribPointer ) \
+    X( PFNGLGENBUFFERSPROC,                 glGenBuffers ) \
+    X( PFNGLDELETEBUFFERSPROC,              glDeleteBuffers ) \
+    X( PFNGLBINDBUFFERPROC,                 glBindBuffer ) \
+    X( PFNGLBUFFERDATAPROC,                 glBufferData ) \
+    X( PFNGLBUFFERSUBDATAPROC,              glBufferSubData ) \
+    X( PFNGLMAPBUFFERRANGEPROC,             glMapBufferRange ) \
+    X( PFNGLUNMAPBUFFERPROC,                glUnmapBuffer ) \
+    X( PFNGLGENVERTEXARRAYSPROC,            glGenVertexArrays ) \
+    X( PFNGLDELETEVERTEXARRAYSPROC,         glDeleteVertexArrays ) \
+    X( PFNGLBINDVERTEXARRAYPROC,            glBindVertexArray ) \
+    X( PFNGLGENFRAMEBUFFERSPROC,            glGenFramebuffers ) \
+    X( PFNGLDELETEFRAMEBUFFERSPROC,         glDeleteFramebuffers ) \
+    X( PFNGLBINDFRAMEBUFFERPROC,            glBindFramebuffer ) \
+    X( PFNGLFRAMEBUFFERTEXTURE2DPROC,       glFramebufferTexture2D ) \
+    X( PFNGLCHECKFRAMEBUFFERSTATUSPROC,     glCheckFramebufferStatus ) \
+    X( PFNGLDRAWBUFFERSPROC,                glDrawBuffers ) \
+    X( PFNGLGENRENDERBUFFERSPROC,           glGenRenderbuffers ) \
+    X( PFNGLDELETERENDERBUFFERSPROC,        glDeleteRenderbuffers ) \
+    X( PFNGLBINDRENDERBUFFERPROC,           glBindRenderbuffer ) \
+    X( PFNGLRENDERBUFFERSTORAGEPROC,        glRenderbufferStorage ) \
+    X( PFNGLFRAMEBUFFERRENDERBUFFERPROC,    glFramebufferRenderbuffer ) \
+    X( PFNGLACTIVETEXTUREPROC,              glActiveTexture ) \
+    X( PFNGLGENERATEMIPMAPPROC,             glGenerateMipmap ) \
+    X( PFNGLBLENDFUNCSEPARATEPROC,          glBlendFuncSeparate ) \
+    X( PFNGLDRAWARRAYSINSTANCEDPROC,        glDrawArraysInstanced ) \
+    X( PFNGLDRAWELEMENTSINSTANCEDPROC,      glDrawElementsInstanced ) \
+    X( PFNGLFENCESYNCPROC,                  glFenceSync ) \
+    X( PFNGLCLIENTWAITSYNCPROC,             glClientWaitSync ) \
+    X( PFNGLDELETESYNCPROC,                 glDeleteSync )
+
+#define GLRECORDER_DECLARE_POINTER( type, name ) type name = nullptr;
+
+struct EntryPoints
+{
+    GLRECORDER_ENTRYPOINTS( GLRECORDER_DECLARE_POINTER )
+};
+
+// s_Saved holds whatever was in the globals before Install, s_Driver is what the wrappers forward to.
+static EntryPoints s_Saved;
+static EntryPoints s_Driver;
+
+static bool s_Installed = false;
+static GLBackend s_Backend = GLBackend::Native;
+
+static GLRecorderStats s_FrameStats;
+static GLRecorderStats s_TotalStats;
+static std::vector<std::string> s_ValidationMessages;
+
+// Tracked state, used to spot redundant changes and invalid usage.
+static GLuint s_CurrentProgram = 0;
+static GLuint s_ArrayBuffer = 0;
+static GLuint s_ElementArrayBuffer = 0;
+static GLuint s_VertexArray = 0;
+static GLuint s_Framebuffer = 0;
+static GLenum s_ActiveTexture = GL_TEXTURE0;
+static GLenum s_MappedTarget = 0;
+
+// Fake object names handed out by the shim.
+static GLuint s_NextShimName = 1;
+
+// What the shim hands out for glMapBufferRange, zeroed on every map.
+static std::vector<unsigned char> s_ShimMapping;
+
+static void Count(unsigned int GLRecorderStats::* pStat, unsigned int amount = 1)
+{
+    s_FrameStats.*pStat += amount;
+    s_TotalStats.*pStat += amount;
+}
+
+static void ReportError(const char* message)
+{
+    Count( &GLRecorderStats::validationErrors );
+
+    if( std::find( s_ValidationMessages.begin(), s_ValidationMessages.end(), message ) == s_ValidationMessages.end() )
+    {
+        s_ValidationMessages.push_back( message );
+        OutputMessage( "GLRecorder: %s\n", message );
+    }
+}
+
+static void GenShimNames(GLsizei n, GLuint* names)
+{
+    for( GLsizei i=0; i<n; i++ )
+        names[i] = s_NextShimName++;
+}
+
+static void ValidateUniformUpload()
+{
+    Count( &GLRecorderStats::uniformUploads );
+
+    if( s_CurrentProgram == 0 )
+        ReportError( "Uniform uploaded with no program bound." );
+}
+
+static void ValidateDraw()
+{
+    if( s_CurrentProgram == 0 )
+        ReportError( "Draw call issued with no program bound." );
+}
+
+// Forward to the driver if there is one. Used for calls that don't return a value.
+#define GLRECORDER_FORWARD( name, ... ) \
+    Count( &GLRecorderStats::glCalls ); \
+    if( s_Driver.name ) \
+        s_Driver.name( __VA_ARGS__ );
+
+// Shaders and programs.
+
+static GLuint APIENTRY Recorded_glCreateShader(GLenum type)
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glCreateShader ? s_Driver.glCreateShader( type ) : s_NextShimName++;
+}
+
+static void APIENTRY Recorded_glShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+{
+    GLRECORDER_FORWARD( glShaderSource, shader, count, string, length );
+}
+
+static void APIENTRY Recorded_glCompileShader(GLuint shader)
+{
+    GLRECORDER_FORWARD( glCompileShader, shader );
+}
+
+static void APIENTRY Recorded_glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGetShaderiv )
+        s_Driver.glGetShaderiv( shader, pname, params );
+    else
+        *params = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+static void APIENTRY Recorded_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGetShaderInfoLog )
+    {
+        s_Driver.glGetShaderInfoLog( shader, bufSize, length, infoLog );
+    }
+    else
+    {
+        if( length )
+            *length = 0;
+        if( bufSize > 0 )
+            infoLog[0] = 0;
+    }
+}
+
+static GLuint APIENTRY Recorded_glCreateProgram()
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glCreateProgram ? s_Driver.glCreateProgram() : s_NextShimName++;
+}
+
+static void APIENTRY Recorded_glAttachShader(GLuint program, GLuint shader)
+{
+    GLRECORDER_FORWARD( glAttachShader, program, shader );
+}
+
+static void APIENTRY Recorded_glDetachShader(GLuint program, GLuint shader)
+{
+    GLRECORDER_FORWARD( glDetachShader, program, shader );
+}
+
+static void APIENTRY Recorded_glLinkProgram(GLuint program)
+{
+    GLRECORDER_FORWARD( glLinkProgram, program );
+}
+
+static void APIENTRY Recorded_glGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGetProgramiv )
+        s_Driver.glGetProgramiv( program, pname, params );
+    else
+        *params = (pname == GL_LINK_STATUS) ? GL_TRUE : 0;
+}
+
+static void APIENTRY Recorded_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGetProgramInfoLog )
+    {
+        s_Driver.glGetProgramInfoLog( program, bufSize, length, infoLog );
+    }
+    else
+    {
+        if( length )
+            *length = 0;
+        if( bufSize > 0 )
+            infoLog[0] = 0;
+    }
+}
+
+static void APIENTRY Recorded_glDeleteShader(GLuint shader)
+{
+    GLRECORDER_FORWARD( glDeleteShader, shader );
+}
+
+static void APIENTRY Recorded_glDeleteProgram(GLuint program)
+{
+    if( program != 0 && program == s_CurrentProgram )
+        s_CurrentProgram = 0;
+
+    GLRECORDER_FORWARD( glDeleteProgram, program );
+}
+
+static void APIENTRY Recorded_glUseProgram(GLuint program)
+{
+    if( program == s_CurrentProgram )
+        Count( &GLRecorderStats::redundantStateChanges );
+    else
+        Count( &GLRecorderStats::programChanges );
+
+    s_CurrentProgram = program;
+
+    GLRECORDER_FORWARD( glUseProgram, program );
+}
+
+static GLint APIENTRY Recorded_glGetUniformLocation(GLuint program, const GLchar* name)
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glGetUniformLocation ? s_Driver.glGetUniformLocation( program, name ) : 0;
+}
+
+static GLint APIENTRY Recorded_glGetAttribLocation(GLuint program, const GLchar* name)
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glGetAttribLocation ? s_Driver.glGetAttribLocation( program, name ) : 0;
+}
+
+// Uniforms.
+
+static void APIENTRY Recorded_glUniform1i(GLint location, GLint v0)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform1i, location, v0 );
+}
+
+static void APIENTRY Recorded_glUniform1iv(GLint location, GLsizei count, const GLint* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform1iv, location, count, value );
+}
+
+static void APIENTRY Recorded_glUniform1f(GLint location, GLfloat v0)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform1f, location, v0 );
+}
+
+static void APIENTRY Recorded_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform2f, location, v0, v1 );
+}
+
+static void APIENTRY Recorded_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform3f, location, v0, v1, v2 );
+}
+
+static void APIENTRY Recorded_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform4f, location, v0, v1, v2, v3 );
+}
+
+static void APIENTRY Recorded_glUniform1fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform1fv, location, count, value );
+}
+
+static void APIENTRY Recorded_glUniform2fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform2fv, location, count, value );
+}
+
+static void APIENTRY Recorded_glUniform3fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform3fv, location, count, value );
+}
+
+static void APIENTRY Recorded_glUniform4fv(GLint location, GLsizei count, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniform4fv, location, count, value );
+}
+
+static void APIENTRY Recorded_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniformMatrix3fv, location, count, transpose, value );
+}
+
+static void APIENTRY Recorded_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+    ValidateUniformUpload();
+    GLRECORDER_FORWARD( glUniformMatrix4fv, location, count, transpose, value );
+}
+
+// Vertex attributes.
+
+static void APIENTRY Recorded_glEnableVertexAttribArray(GLuint index)
+{
+    GLRECORDER_FORWARD( glEnableVertexAttribArray, index );
+}
+
+static void APIENTRY Recorded_glDisableVertexAttribArray(GLuint index)
+{
+    GLRECORDER_FORWARD( glDisableVertexAttribArray, index );
+}
+
+static void APIENTRY Recorded_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+    if( s_ArrayBuffer == 0 )
+        ReportError( "glVertexAttribPointer called with no GL_ARRAY_BUFFER bound." );
+
+    GLRECORDER_FORWARD( glVertexAttribPointer, index, size, type, normalized, stride, pointer );
+}
+
+// Buffers.
+
+static void APIENTRY Recorded_glGenBuffers(GLsizei n, GLuint* buffers)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGenBuffers )
+        s_Driver.glGenBuffers( n, buffers );
+    else
+        GenShimNames( n, buffers );
+}
+
+static void APIENTRY Recorded_glDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for( GLsizei i=0; i<n; i++ )
+    {
+        if( buffers[i] == s_ArrayBuffer )
+            s_ArrayBuffer = 0;
+        if( buffers[i] == s_ElementArrayBuffer )
+            s_ElementArrayBuffer = 0;
+    }
+
+    GLRECORDER_FORWARD( glDeleteBuffers, n, buffers );
+}
+
+static void APIENTRY Recorded_glBindBuffer(GLenum target, GLuint buffer)
+{
+    GLuint* pBound = nullptr;
+    if( target == GL_ARRAY_BUFFER )
+        pBound = &s_ArrayBuffer;
+    else if( target == GL_ELEMENT_ARRAY_BUFFER )
+        pBound = &s_ElementArrayBuffer;
+
+    if( pBound && *pBound == buffer )
+    {
+        Count( &GLRecorderStats::redundantStateChanges );
+    }
+    else
+    {
+        Count( &GLRecorderStats::bufferBinds );
+        if( pBound )
+            *pBound = buffer;
+    }
+
+    GLRECORDER_FORWARD( glBindBuffer, target, buffer );
+}
+
+static void APIENTRY Recorded_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    if( (target == GL_ARRAY_BUFFER && s_ArrayBuffer == 0) || (target == GL_ELEMENT_ARRAY_BUFFER && s_ElementArrayBuffer == 0) )
+        ReportError( "glBufferData called with no buffer bound to the target." );
+
+    Count( &GLRecorderStats::bufferUploadBytes, static_cast<unsigned int>( size ) );
+
+    GLRECORDER_FORWARD( glBufferData, target, size, data, usage );
+}
+
+static void APIENTRY Recorded_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    Count( &GLRecorderStats::bufferUploadBytes, static_cast<unsigned int>( size ) );
+
+    GLRECORDER_FORWARD( glBufferSubData, target, offset, size, data );
+}
+
+static void* APIENTRY Recorded_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    Count( &GLRecorderStats::glCalls );
+
+    if( s_MappedTarget == target )
+        ReportError( "glMapBufferRange called on a target that's already mapped." );
+    s_MappedTarget = target;
+
+    if( s_Driver.glMapBufferRange )
+        return s_Driver.glMapBufferRange( target, offset, length, access );
+
+    s_ShimMapping.assign( static_cast<size_t>( length ), 0 );
+    return s_ShimMapping.empty() ? nullptr : &s_ShimMapping[0];
+}
+
+static GLboolean APIENTRY Recorded_glUnmapBuffer(GLenum target)
+{
+    Count( &GLRecorderStats::glCalls );
+
+    if( s_MappedTarget != target )
+        ReportError( "glUnmapBuffer called on a target that isn't mapped." );
+    s_MappedTarget = 0;
+
+    return s_Driver.glUnmapBuffer ? s_Driver.glUnmapBuffer( target ) : GL_TRUE;
+}
+
+// Vertex array objects.
+
+static void APIENTRY Recorded_glGenVertexArrays(GLsizei n, GLuint* arrays)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGenVertexArrays )
+        s_Driver.glGenVertexArrays( n, arrays );
+    else
+        GenShimNames( n, arrays );
+}
+
+static void APIENTRY Recorded_glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+    for( GLsizei i=0; i<n; i++ )
+    {
+        if( arrays[i] == s_VertexArray )
+            s_VertexArray = 0;
+    }
+
+    GLRECORDER_FORWARD( glDeleteVertexArrays, n, arrays );
+}
+
+static void APIENTRY Recorded_glBindVertexArray(GLuint array)
+{
+    if( array == s_VertexArray )
+        Count( &GLRecorderStats::redundantStateChanges );
+
+    s_VertexArray = array;
+
+    GLRECORDER_FORWARD( glBindVertexArray, array );
+}
+
+// Framebuffers and renderbuffers.
+
+static void APIENTRY Recorded_glGenFramebuffers(GLsizei n, GLuint* framebuffers)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGenFramebuffers )
+        s_Driver.glGenFramebuffers( n, framebuffers );
+    else
+        GenShimNames( n, framebuffers );
+}
+
+static void APIENTRY Recorded_glDeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+{
+    for( GLsizei i=0; i<n; i++ )
+    {
+        if( framebuffers[i] == s_Framebuffer )
+            s_Framebuffer = 0;
+    }
+
+    GLRECORDER_FORWARD( glDeleteFramebuffers, n, framebuffers );
+}
+
+static void APIENTRY Recorded_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    if( framebuffer == s_Framebuffer )
+        Count( &GLRecorderStats::redundantStateChanges );
+    else
+        Count( &GLRecorderStats::framebufferBinds );
+
+    s_Framebuffer = framebuffer;
+
+    GLRECORDER_FORWARD( glBindFramebuffer, target, framebuffer );
+}
+
+static void APIENTRY Recorded_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    if( s_Framebuffer == 0 )
+        ReportError( "glFramebufferTexture2D called with the default framebuffer bound." );
+
+    GLRECORDER_FORWARD( glFramebufferTexture2D, target, attachment, textarget, texture, level );
+}
+
+static GLenum APIENTRY Recorded_glCheckFramebufferStatus(GLenum target)
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glCheckFramebufferStatus ? s_Driver.glCheckFramebufferStatus( target ) : GL_FRAMEBUFFER_COMPLETE;
+}
+
+static void APIENTRY Recorded_glDrawBuffers(GLsizei n, const GLenum* bufs)
+{
+    GLRECORDER_FORWARD( glDrawBuffers, n, bufs );
+}
+
+static void APIENTRY Recorded_glGenRenderbuffers(GLsizei n, GLuint* renderbuffers)
+{
+    Count( &GLRecorderStats::glCalls );
+    if( s_Driver.glGenRenderbuffers )
+        s_Driver.glGenRenderbuffers( n, renderbuffers );
+    else
+        GenShimNames( n, renderbuffers );
+}
+
+static void APIENTRY Recorded_glDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+{
+    GLRECORDER_FORWARD( glDeleteRenderbuffers, n, renderbuffers );
+}
+
+static void APIENTRY Recorded_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    GLRECORDER_FORWARD( glBindRenderbuffer, target, renderbuffer );
+}
+
+static void APIENTRY Recorded_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    GLRECORDER_FORWARD( glRenderbufferStorage, target, internalformat, width, height );
+}
+
+static void APIENTRY Recorded_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    if( s_Framebuffer == 0 )
+        ReportError( "glFramebufferRenderbuffer called with the default framebuffer bound." );
+
+    GLRECORDER_FORWARD( glFramebufferRenderbuffer, target, attachment, renderbuffertarget, renderbuffer );
+}
+
+// Textures and blending.
+
+static void APIENTRY Recorded_glActiveTexture(GLenum texture)
+{
+    if( texture == s_ActiveTexture )
+        Count( &GLRecorderStats::redundantStateChanges );
+    else
+        Count( &GLRecorderStats::textureUnitChanges );
+
+    s_ActiveTexture = texture;
+
+    GLRECORDER_FORWARD( glActiveTexture, texture );
+}
+
+static void APIENTRY Recorded_glGenerateMipmap(GLenum target)
+{
+    GLRECORDER_FORWARD( glGenerateMipmap, target );
+}
+
+static void APIENTRY Recorded_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    GLRECORDER_FORWARD( glBlendFuncSeparate, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
+}
+
+// Instanced draws go through extension pointers, so they can be counted here directly.
+
+static void APIENTRY Recorded_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    ValidateDraw();
+    Count( &GLRecorderStats::drawCalls );
+    Count( &GLRecorderStats::indicesSubmitted, static_cast<unsigned int>( count * instancecount ) );
+
+    GLRECORDER_FORWARD( glDrawArraysInstanced, mode, first, count, instancecount );
+}
+
+static void APIENTRY Recorded_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount)
+{
+    ValidateDraw();
+    Count( &GLRecorderStats::drawCalls );
+    Count( &GLRecorderStats::indicesSubmitted, static_cast<unsigned int>( count * instancecount ) );
+
+    GLRECORDER_FORWARD( glDrawElementsInstanced, mode, count, type, indices, instancecount );
+}
+
+// Sync objects, the shim's fences are signaled as soon as they're created.
+
+static GLsync APIENTRY Recorded_glFenceSync(GLenum condition, GLbitfield flags)
+{
+    Count( &GLRecorderStats::glCalls );
+    return s_Driver.glFenceSync ? s_Driver.glFenceSync( condition, flags ) : reinterpret_cast<GLsync>( static_cast<uintptr_t>( s_NextShimName++ ) );
+}
+
+static GLenum APIENTRY Recorded_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    Count( &GLRecorderStats::glCalls );
+
+    if( sync == 0 )
+        ReportError( "glClientWaitSync called without a fence." );
+
+    return s_Driver.glClientWaitSync ? s_Driver.glClientWaitSync( sync, flags, timeout ) : GL_ALREADY_SIGNALED;
+}
+
+static void APIENTRY Recorded_glDeleteSync(GLsync sync)
+{
+    GLRECORDER_FORWARD( glDeleteSync, sync );
+}
+
+#undef GLRECORDER_FORWARD
+
+// Public interface.
+
+void Install(GLBackend backend)
+{
+    assert( s_Installed == false );
+
+    s_Backend = backend;
+    if( backend == GLBackend::Native )
+        return;
+
+#define GLRECORDER_INSTALL( type, name ) \
+    s_Saved.name = ::name; \
+    s_Driver.name = (backend == GLBackend::NullShim) ? nullptr : ::name; \
+    ::name = Recorded_##name;
+
+    GLRECORDER_ENTRYPOINTS( GLRECORDER_INSTALL )
+
+#undef GLRECORDER_INSTALL
+
+    s_CurrentProgram = 0;
+    s_ArrayBuffer = 0;
+    s_ElementArrayBuffer = 0;
+    s_VertexArray = 0;
+    s_Framebuffer = 0;
+    s_ActiveTexture = GL_TEXTURE0;
+    s_MappedTarget = 0;
+
+    s_FrameStats = GLRecorderStats();
+    s_TotalStats = GLRecorderStats();
+    s_ValidationMessages.clear();
+
+    s_Installed = true;
+}
+
+void Uninstall()
+{
+    if( s_Installed == false )
+        return;
+
+#define GLRECORDER_UNINSTALL( type, name ) \
+    ::name = s_Saved.name;
+
+    GLRECORDER_ENTRYPOINTS( GLRECORDER_UNINSTALL )
+
+#undef GLRECORDER_UNINSTALL
+
+    s_Saved = EntryPoints();
+    s_Driver = EntryPoints();
+
+    s_Installed = false;
+}
+
+bool IsInstalled()
+{
+    return s_Installed;
+}
+
+GLBackend GetBackend()
+{
+    return s_Backend;
+}
+
+static unsigned int CountPrimitives(GLenum mode, int count)
+{
+    switch( mode )
+    {
+    case GL_POINTS:         return count;
+    case GL_LINES:          return count / 2;
+    case GL_LINE_STRIP:     return count > 1 ? count - 1 : 0;
+    case GL_LINE_LOOP:      return count > 1 ? count : 0;
+    case GL_TRIANGLES:      return count / 3;
+    case GL_TRIANGLE_STRIP:
+    case GL_TRIANGLE_FAN:   return count > 2 ? count - 2 : 0;
+    }
+
+    return 0;
+}
+
+void RecordDraw(GLenum mode, int count)
+{
+    if( s_Installed == false )
+        return;
+
+    ValidateDraw();
+
+    Count( &GLRecorderStats::glCalls );
+    Count( &GLRecorderStats::drawCalls );
+    Count( &GLRecorderStats::indicesSubmitted, static_cast<unsigned int>( count ) );
+    Count( &GLRecorderStats::primitivesSubmitted, CountPrimitives( mode, count ) );
+}
+
+void ResetFrameStats()
+{
+    s_FrameStats = GLRecorderStats();
+}
+
+const GLRecorderStats& GetFrameStats()
+{
+    return s_FrameStats;
+}
+
+const GLRecorderStats& GetTotalStats()
+{
+    return s_TotalStats;
+}
+
+const std::vector<std::string>& GetValidationMessages()
+{
+    return s_ValidationMessages;
+}
+
+#undef GLRECORDER_DECLARE_POINTER
+#undef GLRECORDER_ENTRYPOINTS
+
+} // namespace GLRecorder
+} // namespace fw
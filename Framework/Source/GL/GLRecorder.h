@@ -0,0 +1,52 @@
+#pragma once
+
+namespace fw {
+
+// Which GL implementation sits behind the entry points in GLExtensions.h.
+enum class GLBackend
+{
+    Native,     // Real WGL context, extension pointers go straight to the driver.
+    Recording,  // Real WGL context, extension calls are counted/validated then forwarded to the driver.
+    NullShim,   // No window or context, extension calls are counted/validated and answered by the recorder.
+};
+
+struct GLRecorderStats
+{
+    unsigned int glCalls = 0;
+    unsigned int drawCalls = 0;
+    unsigned int indicesSubmitted = 0;
+    unsigned int primitivesSubmitted = 0;  // Points, lines or triangles, depending on each draw's mode.
+    unsigned int programChanges = 0;
+    unsigned int bufferBinds = 0;
+    unsigned int framebufferBinds = 0;
+    unsigned int textureUnitChanges = 0;
+    unsigned int uniformUploads = 0;
+    unsigned int bufferUploadBytes = 0;
+    unsigned int redundantStateChanges = 0;
+    unsigned int validationErrors = 0;
+};
+
+namespace GLRecorder {
+
+// Swaps the extension pointers for recording wrappers.
+// Must be called after OpenGL_InitExtensions() when backend is Recording.
+// With NullShim the wrappers never forward, so no context is required.
+void Install(GLBackend backend);
+void Uninstall();
+
+bool IsInstalled();
+GLBackend GetBackend();
+
+// glDrawArrays/glDrawElements are GL 1.1 entry points exported directly by opengl32.lib,
+//     so they can't be swapped out. Call sites report their draws here instead.
+void RecordDraw(GLenum mode, int count);
+
+void ResetFrameStats();
+const GLRecorderStats& GetFrameStats();
+const GLRecorderStats& GetTotalStats();
+
+// Unique usage errors found so far, i.e. uniform uploads or draws without a bound program.
+const std::vector<std::string>& GetValidationMessages();
+
+} // namespace GLRecorder
+} // namespace fw
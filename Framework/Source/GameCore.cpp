@@ -1,14 +1,17 @@
 #include "CoreHeaders.h"
 #include "GameCore.h"
 #include "Objects/ResourceManager.h"
+#include "Utility/JobSystem.h"
 
 namespace fw {
 GameCore::GameCore()
 {
 	m_pResourceManager = new ResourceManager();
+	m_pJobSystem = new JobSystem();
 }
 GameCore::~GameCore()
 {
 	delete m_pResourceManager;
+	delete m_pJobSystem;
 }
 } // namespace fw
@@ -5,12 +5,14 @@
 namespace fw {
 
 class Event;
+class JobSystem;
 class ResourceManager;
 
 class GameCore : public EventListener
 {
 protected:
 	ResourceManager* m_pResourceManager = nullptr;
+	JobSystem* m_pJobSystem = nullptr;
 public:
 	GameCore();
 	virtual ~GameCore();
@@ -20,6 +22,7 @@ public:
     virtual void Draw() = 0;
 
 	ResourceManager* GetResourceManager() { return m_pResourceManager; }
+	JobSystem* GetJobSystem() { return m_pJobSystem; }
 };
 
 } // namespace fw
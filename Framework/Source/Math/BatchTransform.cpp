@@ -0,0 +1,228 @@
+#include "CoreHeaders.h"
+
+#include "BatchTransform.h"
+#include "SIMD.h"
+
+namespace fw {
+
+static_assert( sizeof(vec3) == 12, "The AoS kernels load vec3 arrays as packed floats." );
+static_assert( sizeof(vec4) == 16, "The AoS kernels load vec4 arrays as packed floats." );
+
+// Matrix elements splatted across all 4 lanes, so 4 values can go through it at once.
+struct SplatMatrix
+{
+    simd::float4 m11, m12, m13, m14;
+    simd::float4 m21, m22, m23, m24;
+    simd::float4 m31, m32, m33, m34;
+    simd::float4 m41, m42, m43, m44;
+
+    SplatMatrix(const matrix& mat)
+    {
+        m11 = simd::Splat( mat.m11 ); m12 = simd::Splat( mat.m12 ); m13 = simd::Splat( mat.m13 ); m14 = simd::Splat( mat.m14 );
+        m21 = simd::Splat( mat.m21 ); m22 = simd::Splat( mat.m22 ); m23 = simd::Splat( mat.m23 ); m24 = simd::Splat( mat.m24 );
+        m31 = simd::Splat( mat.m31 ); m32 = simd::Splat( mat.m32 ); m33 = simd::Splat( mat.m33 ); m34 = simd::Splat( mat.m34 );
+        m41 = simd::Splat( mat.m41 ); m42 = simd::Splat( mat.m42 ); m43 = simd::Splat( mat.m43 ); m44 = simd::Splat( mat.m44 );
+    }
+};
+
+// 4 packed vec3s (12 floats) to and from one register per component.
+static inline void LoadVec3x4(const vec3* pIn, simd::float4& x, simd::float4& y, simd::float4& z)
+{
+    const float* p = &pIn->x;
+    simd::float4 a0 = simd::Load( p );     // x0 y0 z0 x1
+    simd::float4 a1 = simd::Load( p + 4 ); // y1 z1 x2 y2
+    simd::float4 a2 = simd::Load( p + 8 ); // z2 x3 y3 z3
+
+    x = simd::Shuffle<0,3,0,2>( a0, simd::Shuffle<2,2,1,1>( a1, a2 ) );
+    y = simd::Shuffle<0,2,0,2>( simd::Shuffle<1,1,0,0>( a0, a1 ), simd::Shuffle<3,3,2,2>( a1, a2 ) );
+    z = simd::Shuffle<0,2,0,3>( simd::Shuffle<2,2,1,1>( a0, a1 ), a2 );
+}
+
+static inline void StoreVec3x4(vec3* pOut, simd::float4 x, simd::float4 y, simd::float4 z)
+{
+    float* p = &pOut->x;
+    simd::Store( p,     simd::Shuffle<0,2,0,2>( simd::Shuffle<0,0,0,0>( x, y ), simd::Shuffle<0,0,1,1>( z, x ) ) );
+    simd::Store( p + 4, simd::Shuffle<0,2,0,2>( simd::Shuffle<1,1,1,1>( y, z ), simd::Shuffle<2,2,2,2>( x, y ) ) );
+    simd::Store( p + 8, simd::Shuffle<0,2,0,2>( simd::Shuffle<2,2,3,3>( z, x ), simd::Shuffle<3,3,3,3>( y, z ) ) );
+}
+
+static inline simd::float4 Row(simd::float4 mx, simd::float4 my, simd::float4 mz, simd::float4 x, simd::float4 y, simd::float4 z)
+{
+    return simd::Add( simd::Add( simd::Mul( mx, x ), simd::Mul( my, y ) ), simd::Mul( mz, z ) );
+}
+
+void TransformPoints(const matrix& mat, const vec3* pIn, vec3* pOut, size_t count)
+{
+    SplatMatrix m( mat );
+
+    size_t i = 0;
+    for( ; i+4<=count; i+=4 )
+    {
+        simd::float4 x, y, z;
+        LoadVec3x4( pIn + i, x, y, z );
+
+        simd::float4 rx = simd::Add( Row( m.m11, m.m21, m.m31, x, y, z ), m.m41 );
+        simd::float4 ry = simd::Add( Row( m.m12, m.m22, m.m32, x, y, z ), m.m42 );
+        simd::float4 rz = simd::Add( Row( m.m13, m.m23, m.m33, x, y, z ), m.m43 );
+
+        StoreVec3x4( pOut + i, rx, ry, rz );
+    }
+
+    for( ; i<count; i++ )
+    {
+        vec3 p = pIn[i];
+        pOut[i] = vec3( mat.m11 * p.x + mat.m21 * p.y + mat.m31 * p.z + mat.m41,
+                        mat.m12 * p.x + mat.m22 * p.y + mat.m32 * p.z + mat.m42,
+                        mat.m13 * p.x + mat.m23 * p.y + mat.m33 * p.z + mat.m43 );
+    }
+}
+
+void TransformPoints(const matrix& mat, const vec3* pIn, vec4* pOut, size_t count)
+{
+    // One point per register, the columns are loaded once.
+    simd::float4 c0 = simd::Load( &mat.m11 );
+    simd::float4 c1 = simd::Load( &mat.m21 );
+    simd::float4 c2 = simd::Load( &mat.m31 );
+    simd::float4 c3 = simd::Load( &mat.m41 );
+
+    for( size_t i=0; i<count; i++ )
+    {
+        vec3 p = pIn[i];
+
+        simd::float4 result = simd::Mul( c0, simd::Splat( p.x ) );
+        result = simd::Add( result, simd::Mul( c1, simd::Splat( p.y ) ) );
+        result = simd::Add( result, simd::Mul( c2, simd::Splat( p.z ) ) );
+        result = simd::Add( result, c3 );
+
+        simd::Store( &pOut[i].x, result );
+    }
+}
+
+void TransformDirections(const matrix& mat, const vec3* pIn, vec3* pOut, size_t count)
+{
+    SplatMatrix m( mat );
+
+    size_t i = 0;
+    for( ; i+4<=count; i+=4 )
+    {
+        simd::float4 x, y, z;
+        LoadVec3x4( pIn + i, x, y, z );
+
+        StoreVec3x4( pOut + i, Row( m.m11, m.m21, m.m31, x, y, z ), Row( m.m12, m.m22, m.m32, x, y, z ), Row( m.m13, m.m23, m.m33, x, y, z ) );
+    }
+
+    for( ; i<count; i++ )
+    {
+        vec3 d = pIn[i];
+        pOut[i] = vec3( mat.m11 * d.x + mat.m21 * d.y + mat.m31 * d.z,
+                        mat.m12 * d.x + mat.m22 * d.y + mat.m32 * d.z,
+                        mat.m13 * d.x + mat.m23 * d.y + mat.m33 * d.z );
+    }
+}
+
+void TransformVec4s(const matrix& mat, const vec4* pIn, vec4* pOut, size_t count)
+{
+    simd::float4 c0 = simd::Load( &mat.m11 );
+    simd::float4 c1 = simd::Load( &mat.m21 );
+    simd::float4 c2 = simd::Load( &mat.m31 );
+    simd::float4 c3 = simd::Load( &mat.m41 );
+
+    for( size_t i=0; i<count; i++ )
+    {
+        simd::float4 v = simd::Load( &pIn[i].x );
+
+        simd::float4 result = simd::Mul( c0, simd::SplatLane<0>( v ) );
+        result = simd::Add( result, simd::Mul( c1, simd::SplatLane<1>( v ) ) );
+        result = simd::Add( result, simd::Mul( c2, simd::SplatLane<2>( v ) ) );
+        result = simd::Add( result, simd::Mul( c3, simd::SplatLane<3>( v ) ) );
+
+        simd::Store( &pOut[i].x, result );
+    }
+}
+
+void TransformPointsSoA(const matrix& mat, const float* pX, const float* pY, const float* pZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+    SplatMatrix m( mat );
+
+    size_t i = 0;
+    for( ; i+4<=count; i+=4 )
+    {
+        simd::float4 x = simd::Load( pX + i );
+        simd::float4 y = simd::Load( pY + i );
+        simd::float4 z = simd::Load( pZ + i );
+
+        simd::Store( pOutX + i, simd::Add( Row( m.m11, m.m21, m.m31, x, y, z ), m.m41 ) );
+        simd::Store( pOutY + i, simd::Add( Row( m.m12, m.m22, m.m32, x, y, z ), m.m42 ) );
+        simd::Store( pOutZ + i, simd::Add( Row( m.m13, m.m23, m.m33, x, y, z ), m.m43 ) );
+    }
+
+    for( ; i<count; i++ )
+    {
+        float x = pX[i], y = pY[i], z = pZ[i];
+        pOutX[i] = mat.m11 * x + mat.m21 * y + mat.m31 * z + mat.m41;
+        pOutY[i] = mat.m12 * x + mat.m22 * y + mat.m32 * z + mat.m42;
+        pOutZ[i] = mat.m13 * x + mat.m23 * y + mat.m33 * z + mat.m43;
+    }
+}
+
+void TransformDirectionsSoA(const matrix& mat, const float* pX, const float* pY, const float* pZ, float* pOutX, float* pOutY, float* pOutZ, size_t count)
+{
+    SplatMatrix m( mat );
+
+    size_t i = 0;
+    for( ; i+4<=count; i+=4 )
+    {
+        simd::float4 x = simd::Load( pX + i );
+        simd::float4 y = simd::Load( pY + i );
+        simd::float4 z = simd::Load( pZ + i );
+
+        simd::Store( pOutX + i, Row( m.m11, m.m21, m.m31, x, y, z ) );
+        simd::Store( pOutY + i, Row( m.m12, m.m22, m.m32, x, y, z ) );
+        simd::Store( pOutZ + i, Row( m.m13, m.m23, m.m33, x, y, z ) );
+    }
+
+    for( ; i<count; i++ )
+    {
+        float x = pX[i], y = pY[i], z = pZ[i];
+        pOutX[i] = mat.m11 * x + mat.m21 * y + mat.m31 * z;
+        pOutY[i] = mat.m12 * x + mat.m22 * y + mat.m32 * z;
+        pOutZ[i] = mat.m13 * x + mat.m23 * y + mat.m33 * z;
+    }
+}
+
+void MultiplyMatrices(const matrix& mat, const matrix* pIn, matrix* pOut, size_t count)
+{
+    simd::float4 c0 = simd::Load( &mat.m11 );
+    simd::float4 c1 = simd::Load( &mat.m21 );
+    simd::float4 c2 = simd::Load( &mat.m31 );
+    simd::float4 c3 = simd::Load( &mat.m41 );
+
+    for( size_t i=0; i<count; i++ )
+    {
+        const float* pOther = &pIn[i].m11;
+        float* pResult = &pOut[i].m11;
+
+        // Load all of the input first so it's safe to write over it.
+        simd::float4 columns[4] = { simd::Load( pOther ), simd::Load( pOther + 4 ), simd::Load( pOther + 8 ), simd::Load( pOther + 12 ) };
+
+        for( int j=0; j<4; j++ )
+        {
+            simd::float4 result = simd::Mul( c0, simd::SplatLane<0>( columns[j] ) );
+            result = simd::Add( result, simd::Mul( c1, simd::SplatLane<1>( columns[j] ) ) );
+            result = simd::Add( result, simd::Mul( c2, simd::SplatLane<2>( columns[j] ) ) );
+            result = simd::Add( result, simd::Mul( c3, simd::SplatLane<3>( columns[j] ) ) );
+
+            simd::Store( pResult + j*4, result );
+        }
+    }
+}
+
+void CreateSRTs(const vec3* pScales, const vec3* pRotations, const vec3* pPositions, matrix* pOut, size_t count)
+{
+    for( size_t i=0; i<count; i++ )
+    {
+        pOut[i].CreateSRT( pScales[i], pRotations[i], pPositions[i] );
+    }
+}
+
+} // namespace fw
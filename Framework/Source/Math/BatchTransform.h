@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Vector.h"
+#include "Matrix.h"
+
+namespace fw {
+
+// Transforms many values by one matrix, 4 at a time with the SIMD backend from SIMD.h.
+// Counts don't need to be a multiple of 4, leftovers are handled one at a time.
+// Input and output may be the same array.
+
+// Points get w = 1, with no perspective divide, so these are meant for affine matrices.
+void TransformPoints(const matrix& mat, const vec3* pIn, vec3* pOut, size_t count);
+
+// Points get w = 1, the full clip space result is kept for projection matrices.
+void TransformPoints(const matrix& mat, const vec3* pIn, vec4* pOut, size_t count);
+
+// Directions get w = 0, translation is ignored.
+void TransformDirections(const matrix& mat, const vec3* pIn, vec3* pOut, size_t count);
+
+void TransformVec4s(const matrix& mat, const vec4* pIn, vec4* pOut, size_t count);
+
+// Same as above, with each component in its own array.
+void TransformPointsSoA(const matrix& mat, const float* pX, const float* pY, const float* pZ, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+void TransformDirectionsSoA(const matrix& mat, const float* pX, const float* pY, const float* pZ, float* pOutX, float* pOutY, float* pOutZ, size_t count);
+
+// pOut[i] = mat * pIn[i].
+void MultiplyMatrices(const matrix& mat, const matrix* pIn, matrix* pOut, size_t count);
+
+// pOut[i] = CreateSRT( pScales[i], pRotations[i], pPositions[i] ).
+void CreateSRTs(const vec3* pScales, const vec3* pRotations, const vec3* pPositions, matrix* pOut, size_t count);
+
+} // namespace fw
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "Vector.h"
+#include "SIMD.h"
+
+#include <float.h>
+
+// Cheaper stand-ins for sinf, cosf, sqrtf and 1/sqrtf, for hot loops that can live with a small error.
+//
+// Each function takes a Precision as a template argument, so it can be picked per call site:
+//     fastmath::Sin<fastmath::Precision::Fast>( x );
+// Calls that don't pick one use the project wide default, which is Accurate unless
+// FW_FASTMATH_PRECISION is defined to Fast, Accurate or Exact.
+//
+// Max errors against double precision libm, measured over 10 million inputs with SSE2:
+//                          Fast            Accurate        Exact
+//     Sin/Cos (absolute)   1.4e-4          7.5e-7          libm
+//     RSqrt (relative)     3.3e-4          2.5e-7          libm
+//     Sqrt (relative)      3.3e-4          2.9e-7          libm
+// Sin and Cos are measured over -2pi..2pi, the range reduction adds up to about |x| * 1e-7 outside of that.
+// NEON starts from a 8 bit square root estimate, so its Fast RSqrt takes a Newton step to land near 3e-5.
+// RSqrt and Sqrt are for positive inputs, Sqrt( 0 ) is 0 and RSqrt( 0 ) is undefined.
+
+#ifndef FW_FASTMATH_PRECISION
+#define FW_FASTMATH_PRECISION Accurate
+#endif
+
+namespace fw {
+namespace fastmath {
+
+enum class Precision
+{
+    Fast,       // Good enough for heuristics like sorting and LOD picks.
+    Accurate,   // Within a few float ulps, fine for matrices.
+    Exact,      // Straight through to libm.
+};
+
+const Precision DefaultPrecision = Precision::FW_FASTMATH_PRECISION;
+
+// Sin( pi * z ) for z in -0.5..0.5, minimax polynomials.
+template<Precision P> inline simd::float4 SinHalfTurnsPoly(simd::float4 z)
+{
+    simd::float4 z2 = simd::Mul( z, z );
+    simd::float4 poly;
+
+    if( P == Precision::Fast )
+    {
+        poly = simd::Splat( 2.316633780347408f );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( -5.144283672627893f ) );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( 3.1412813068858827f ) );
+    }
+    else
+    {
+        poly = simd::Splat( 0.07787740581417762f );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( -0.5984234993757881f ) );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( 2.550102054024134f ) );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( -5.167711483042261f ) );
+        poly = simd::Add( simd::Mul( poly, z2 ), simd::Splat( 3.141592650945342f ) );
+    }
+
+    return simd::Mul( poly, z );
+}
+
+// Runs a libm function on each lane, for the Exact versions.
+template<typename Func> inline simd::float4 PerLane(simd::float4 v, Func func)
+{
+    float r[4];
+    simd::Store( r, v );
+    return simd::Set( func( r[0] ), func( r[1] ), func( r[2] ), func( r[3] ) );
+}
+
+// Sin( pi * halfTurns ) for any input.
+template<Precision P> inline simd::float4 SinHalfTurns(simd::float4 halfTurns)
+{
+    if( P == Precision::Exact )
+        return PerLane( halfTurns, [](float v) { return sinf( v * PI ); } );
+
+    // Wrap into -1..1, then fold the outer quarters back in since sin( pi*y ) == sin( pi*(1-y) ).
+    simd::float4 y = simd::Sub( halfTurns, simd::Mul( simd::Round( simd::Mul( halfTurns, simd::Splat( 0.5f ) ) ), simd::Splat( 2.0f ) ) );
+    simd::float4 z = simd::Max( simd::Min( y, simd::Sub( simd::Splat( 1.0f ), y ) ), simd::Sub( simd::Splat( -1.0f ), y ) );
+
+    return SinHalfTurnsPoly<P>( z );
+}
+
+// 4 wide versions.
+template<Precision P = DefaultPrecision> inline simd::float4 Sin(simd::float4 radians)
+{
+    if( P == Precision::Exact )
+        return PerLane( radians, sinf );
+    return SinHalfTurns<P>( simd::Mul( radians, simd::Splat( 1 / PI ) ) );
+}
+
+template<Precision P = DefaultPrecision> inline simd::float4 Cos(simd::float4 radians)
+{
+    if( P == Precision::Exact )
+        return PerLane( radians, cosf );
+    return SinHalfTurns<P>( simd::Add( simd::Mul( radians, simd::Splat( 1 / PI ) ), simd::Splat( 0.5f ) ) );
+}
+
+template<Precision P = DefaultPrecision> inline simd::float4 SinDegrees(simd::float4 degrees) { return SinHalfTurns<P>( simd::Mul( degrees, simd::Splat( 1 / 180.0f ) ) ); }
+template<Precision P = DefaultPrecision> inline simd::float4 CosDegrees(simd::float4 degrees) { return SinHalfTurns<P>( simd::Add( simd::Mul( degrees, simd::Splat( 1 / 180.0f ) ), simd::Splat( 0.5f ) ) ); }
+
+template<Precision P = DefaultPrecision> inline void SinCos(simd::float4 radians, simd::float4& s, simd::float4& c)
+{
+    if( P == Precision::Exact )
+    {
+        s = Sin<P>( radians );
+        c = Cos<P>( radians );
+        return;
+    }
+
+    simd::float4 halfTurns = simd::Mul( radians, simd::Splat( 1 / PI ) );
+    s = SinHalfTurns<P>( halfTurns );
+    c = SinHalfTurns<P>( simd::Add( halfTurns, simd::Splat( 0.5f ) ) );
+}
+
+template<Precision P = DefaultPrecision> inline void SinCosDegrees(simd::float4 degrees, simd::float4& s, simd::float4& c)
+{
+    simd::float4 halfTurns = simd::Mul( degrees, simd::Splat( 1 / 180.0f ) );
+    s = SinHalfTurns<P>( halfTurns );
+    c = SinHalfTurns<P>( simd::Add( halfTurns, simd::Splat( 0.5f ) ) );
+}
+
+template<Precision P = DefaultPrecision> inline simd::float4 RSqrt(simd::float4 v)
+{
+    if( P == Precision::Exact )
+        return PerLane( v, [](float f) { return 1 / sqrtf( f ); } );
+
+    // Each Newton step roughly doubles the bits of the estimate.
+    const int steps = P == Precision::Fast ? (simd::RSqrtEstimateBits < 11 ? 1 : 0)
+                                           : (simd::RSqrtEstimateBits >= 22 ? 0 : simd::RSqrtEstimateBits >= 11 ? 1 : 2);
+
+    simd::float4 y = simd::RSqrtEstimate( v );
+    for( int i=0; i<steps; i++ )
+    {
+        simd::float4 halfVYY = simd::Mul( simd::Mul( simd::Splat( 0.5f ), v ), simd::Mul( y, y ) );
+        y = simd::Mul( y, simd::Sub( simd::Splat( 1.5f ), halfVYY ) );
+    }
+    return y;
+}
+
+template<Precision P = DefaultPrecision> inline simd::float4 Sqrt(simd::float4 v)
+{
+    if( P == Precision::Exact )
+        return PerLane( v, sqrtf );
+
+    // Clamped so 0 gives 0 * big instead of 0 * infinity.
+    return simd::Mul( v, RSqrt<P>( simd::Max( v, simd::Splat( FLT_MIN ) ) ) );
+}
+
+// Single value versions.
+template<Precision P = DefaultPrecision> inline float Sin(float radians) { return P == Precision::Exact ? sinf( radians ) : simd::GetX( Sin<P>( simd::Splat( radians ) ) ); }
+template<Precision P = DefaultPrecision> inline float Cos(float radians) { return P == Precision::Exact ? cosf( radians ) : simd::GetX( Cos<P>( simd::Splat( radians ) ) ); }
+template<Precision P = DefaultPrecision> inline float SinDegrees(float degrees) { return Sin<P>( degrees * PI / 180.0f ); }
+template<Precision P = DefaultPrecision> inline float CosDegrees(float degrees) { return Cos<P>( degrees * PI / 180.0f ); }
+
+// Sin and cos share one polynomial evaluation, in neighbouring lanes.
+template<Precision P = DefaultPrecision> inline void SinCos(float radians, float& s, float& c)
+{
+    if( P == Precision::Exact )
+    {
+        s = sinf( radians );
+        c = cosf( radians );
+        return;
+    }
+
+    float halfTurns = radians * (1 / PI);
+    float r[4];
+    simd::Store( r, SinHalfTurns<P>( simd::Set( halfTurns, halfTurns + 0.5f, 0, 0 ) ) );
+    s = r[0];
+    c = r[1];
+}
+
+template<Precision P = DefaultPrecision> inline void SinCosDegrees(float degrees, float& s, float& c)
+{
+    if( P == Precision::Exact )
+    {
+        SinCos<P>( degrees * PI / 180.0f, s, c );
+        return;
+    }
+
+    float halfTurns = degrees * (1 / 180.0f);
+    float r[4];
+    simd::Store( r, SinHalfTurns<P>( simd::Set( halfTurns, halfTurns + 0.5f, 0, 0 ) ) );
+    s = r[0];
+    c = r[1];
+}
+
+template<Precision P = DefaultPrecision> inline float RSqrt(float v) { return P == Precision::Exact ? 1 / sqrtf( v ) : simd::GetX( RSqrt<P>( simd::Splat( v ) ) ); }
+template<Precision P = DefaultPrecision> inline float Sqrt(float v) { return P == Precision::Exact ? sqrtf( v ) : simd::GetX( Sqrt<P>( simd::Splat( v ) ) ); }
+
+// Vector helpers.
+template<Precision P = DefaultPrecision> inline float Length(const vec3& v) { return Sqrt<P>( v.LengthSquared() ); }
+template<Precision P = DefaultPrecision> inline float Distance(const vec3& a, const vec3& b) { return Sqrt<P>( (a - b).LengthSquared() ); }
+
+// Unlike vec3::Normalize, tiny vectors are still normalized, only a zero vector stays zero.
+template<Precision P = DefaultPrecision> inline vec3 Normalize(const vec3& v)
+{
+    float lengthSq = v.LengthSquared();
+    if( lengthSq == 0 )
+        return v;
+    return v * RSqrt<P>( lengthSq );
+}
+
+// Distance comparisons without any square roots.
+constexpr float DistanceSquared(const vec3& a, const vec3& b) { return (a - b).LengthSquared(); }
+constexpr bool IsWithinDistance(const vec3& a, const vec3& b, float distance) { return DistanceSquared( a, b ) <= distance * distance; }
+constexpr bool IsCloser(const vec3& origin, const vec3& a, const vec3& b) { return DistanceSquared( origin, a ) < DistanceSquared( origin, b ); }
+
+// Sorts positions nearest first, for std::sort and friends.
+struct CloserTo
+{
+    vec3 origin;
+
+    CloserTo(const vec3& o) : origin( o ) {}
+    bool operator()(const vec3& a, const vec3& b) const { return IsCloser( origin, a, b ); }
+};
+
+} // namespace fastmath
+} // namespace fw
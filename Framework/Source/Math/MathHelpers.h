@@ -13,24 +13,25 @@ namespace fw {
 
 #define PI 3.1415926535897932384626433832795f
 
-const float FEQUALEPSILON = 0.00001f;
+constexpr float FEQUALEPSILON = 0.00001f;
 
-inline bool fequal(const float a, const float b, const float epsilon = FEQUALEPSILON)
+// Written without fabs so they can be used in constant expressions, NaNs still compare as not equal.
+constexpr bool fequal(const float a, const float b, const float epsilon = FEQUALEPSILON)
 {
-    return fabs(a - b) <= epsilon;
+    return a - b <= epsilon && b - a <= epsilon;
 }
 
-inline bool fnotequal(const float a, const float b, const float epsilon = FEQUALEPSILON)
+constexpr bool fnotequal(const float a, const float b, const float epsilon = FEQUALEPSILON)
 {
-    return fabs(a - b) > epsilon;
+    return a - b > epsilon || b - a > epsilon;
 }
 
-inline float degreesToRads(const float number)
+constexpr float degreesToRads(const float number)
 {
     return number * PI / 180.0f;
 }
 
-inline float radsToDegrees(const float number)
+constexpr float radsToDegrees(const float number)
 {
     return number * 180.0f / PI;
 }
@@ -51,7 +52,7 @@ template <class MyType> void MyClamp(MyType& value, MyType min, MyType max)
         value = max;
 }
 
-template <class MyType> MyType MyClamp_Return(MyType value, MyType min, MyType max)
+template <class MyType> constexpr MyType MyClamp_Return(MyType value, MyType min, MyType max)
 {
     MyType temp = value;
 
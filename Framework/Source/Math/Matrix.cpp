@@ -8,16 +8,12 @@
 // 3. This notice may not be removed or altered from any source distribution.
 
 #include "CoreHeaders.h"
-#include "matrix.h"
+#include "Matrix.h"
+#include "Quaternion.h"
+#include "FastMath.h"
 
 namespace fw {
 
-void matrix::SetIdentity()
-{
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = m41 = m42 = m43 = 0;
-    m11 = m22 = m33 = m44 = 1;
-}
-
 void matrix::SetAxesView(const vec3& right, const vec3& up, const vec3& at, const vec3& pos)
 {
     m11 = right.x; m21 = right.y; m31 = right.z; m41 = pos.x;
@@ -48,74 +44,116 @@ void matrix::SetTranslation(float x, float y, float z)
     m43 = z;
 }
 
-void matrix::CreateScale(float scale)
+// Rotation part of roll (z), then pitch (x), then yaw (y), the same as 3 calls to Rotate() in that order.
+// Written out in closed form, so it's one sin/cos pair per axis and no matrix multiplies.
+// Can also be filled from a quaternion, which needs no trig at all.
+struct Rotation3x3
 {
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = m41 = m42 = m43 = 0;
-    m11 = m22 = m33 = scale;
-    m44 = 1;
-}
+    float r11, r12, r13; // First column.
+    float r21, r22, r23;
+    float r31, r32, r33;
+
+    Rotation3x3(vec3 eulerdegrees)
+    {
+        // All 3 axes in one go.
+        float s[4], c[4];
+        simd::float4 sines, cosines;
+        fastmath::SinCosDegrees( simd::Set( eulerdegrees.x, eulerdegrees.y, eulerdegrees.z, 0 ), sines, cosines );
+        simd::Store( s, sines );
+        simd::Store( c, cosines );
+
+        float sx = s[0], cx = c[0];
+        float sy = s[1], cy = c[1];
+        float sz = s[2], cz = c[2];
+
+        r11 = cy * cz - sy * sx * sz;
+        r12 = -cx * sz;
+        r13 = sy * cz + cy * sx * sz;
+
+        r21 = cy * sz + sy * sx * cz;
+        r22 = cx * cz;
+        r23 = sy * sz - cy * sx * cz;
+
+        r31 = -sy * cx;
+        r32 = sx;
+        r33 = cy * cx;
+    }
+
+    Rotation3x3(const quat& q)
+    {
+        float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        r11 = 1 - 2 * (yy + zz);
+        r12 = 2 * (xy + wz);
+        r13 = 2 * (xz - wy);
+
+        r21 = 2 * (xy - wz);
+        r22 = 1 - 2 * (xx + zz);
+        r23 = 2 * (yz + wx);
 
-void matrix::CreateScale(float x, float y, float z)
+        r31 = 2 * (xz + wy);
+        r32 = 2 * (yz - wx);
+        r33 = 1 - 2 * (xx + yy);
+    }
+};
+
+// Scaling first only scales each column of the rotation.
+static void SetSRT(matrix& mat, const Rotation3x3& r, vec3 scale, vec3 pos)
 {
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = m41 = m42 = m43 = 0;
-    m11 = x;
-    m22 = y;
-    m33 = z;
-    m44 = 1;
+    mat.m11 = r.r11 * scale.x; mat.m21 = r.r21 * scale.y; mat.m31 = r.r31 * scale.z; mat.m41 = pos.x;
+    mat.m12 = r.r12 * scale.x; mat.m22 = r.r22 * scale.y; mat.m32 = r.r32 * scale.z; mat.m42 = pos.y;
+    mat.m13 = r.r13 * scale.x; mat.m23 = r.r23 * scale.y; mat.m33 = r.r33 * scale.z; mat.m43 = pos.z;
+    mat.m14 = 0;               mat.m24 = 0;               mat.m34 = 0;               mat.m44 = 1;
 }
 
-void matrix::CreateScale(vec3 scale)
+static void SetRotation(matrix& mat, const Rotation3x3& r)
 {
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = m41 = m42 = m43 = 0;
-    m11 = scale.x;
-    m22 = scale.y;
-    m33 = scale.z;
-    m44 = 1;
+    mat.m11 = r.r11; mat.m21 = r.r21; mat.m31 = r.r31; mat.m41 = 0;
+    mat.m12 = r.r12; mat.m22 = r.r22; mat.m32 = r.r32; mat.m42 = 0;
+    mat.m13 = r.r13; mat.m23 = r.r23; mat.m33 = r.r33; mat.m43 = 0;
+    mat.m14 = 0;     mat.m24 = 0;     mat.m34 = 0;     mat.m44 = 1;
 }
 
 void matrix::CreateRotation(vec3 eulerdegrees)
 {
-    SetIdentity();
-    Rotate(eulerdegrees.z, 0, 0, 1); // roll
-    Rotate(eulerdegrees.x, 1, 0, 0); // pitch
-    Rotate(eulerdegrees.y, 0, 1, 0); // yaw
+    SetRotation( *this, Rotation3x3( eulerdegrees ) );
 }
 
-void matrix::CreateTranslation(float x, float y, float z)
+void matrix::CreateRotation(const quat& rot)
 {
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = 0;
-    m11 = m22 = m33 = m44 = 1;
-    m41 = x;
-    m42 = y;
-    m43 = z;
+    SetRotation( *this, Rotation3x3( rot ) );
 }
 
-void matrix::CreateTranslation(vec3 pos)
+void matrix::CreateSRT(float scale, vec3 rot, vec3 pos)
 {
-    m12 = m13 = m14 = m21 = m23 = m24 = m31 = m32 = m34 = 0;
-    m11 = m22 = m33 = m44 = 1;
-    m41 = pos.x;
-    m42 = pos.y;
-    m43 = pos.z;
+    CreateSRT(vec3(scale, scale, scale), rot, pos);
 }
 
-void matrix::CreateSRT(float scale, vec3 rot, vec3 pos)
+void matrix::CreateSRT(vec3 scale, vec3 rot, vec3 pos)
 {
-    SetIdentity();
-    Scale(scale);
-    Rotate(rot.z, 0, 0, 1); // roll
-    Rotate(rot.x, 1, 0, 0); // pitch
-    Rotate(rot.y, 0, 1, 0); // yaw
-    Translate(pos.x, pos.y, pos.z);
+    SetSRT( *this, Rotation3x3( rot ), scale, pos );
 }
 
-void matrix::CreateSRT(vec3 scale, vec3 rot, vec3 pos)
+void matrix::CreateSRT(vec3 scale, vec3 rot, vec3 pos, matrix& rotationMat)
+{
+    // Same sin/cos results, no need to compute them twice.
+    Rotation3x3 r( rot );
+    SetSRT( *this, r, scale, pos );
+    SetRotation( rotationMat, r );
+}
+
+void matrix::CreateSRT(vec3 scale, const quat& rot, vec3 pos)
 {
-    CreateScale(scale.x, scale.y, scale.z);
-    Rotate(rot.z, 0, 0, 1); // roll
-    Rotate(rot.x, 1, 0, 0); // pitch
-    Rotate(rot.y, 0, 1, 0); // yaw
-    Translate(pos.x, pos.y, pos.z);
+    SetSRT( *this, Rotation3x3( rot ), scale, pos );
+}
+
+void matrix::CreateSRT(vec3 scale, const quat& rot, vec3 pos, matrix& rotationMat)
+{
+    Rotation3x3 r( rot );
+    SetSRT( *this, r, scale, pos );
+    SetRotation( rotationMat, r );
 }
 
 void matrix::Scale(float scale)
@@ -144,8 +182,7 @@ void matrix::Rotate(float angle, float x, float y, float z)
     float sinAngle, cosAngle;
     float mag = sqrtf(x * x + y * y + z * z);
 
-    sinAngle = sinf(angle * PI / 180.0f);
-    cosAngle = cosf(angle * PI / 180.0f);
+    fastmath::SinCosDegrees( angle, sinAngle, cosAngle );
     if( mag > 0.0f )
     {
         float xx, yy, zz, xy, yz, zx, xs, ys, zs;
@@ -269,33 +306,6 @@ void matrix::CreatePerspectiveHFoV(float horfovdegrees, float aspect, float near
     CreateFrustum(-frustumRight, frustumRight, -frustumTop, frustumTop, nearZ, farZ);
 }
 
-void matrix::CreateOrtho(float left, float right, float bottom, float top, float nearZ, float farZ)
-{
-    float deltaX = (right - left);
-    float deltaY = (top - bottom);
-    float deltaZ = (farZ - nearZ);
-
-    assert((deltaX != 0.0f) && (deltaY != 0.0f) && (deltaZ != 0.0f));
-
-    m11 = 2.0f / deltaX;
-    m12 = m13 = m14 = 0;
-
-    m22 = 2.0f / deltaY;
-    m21 = m23 = m24 = 0;
-
-#if MYFW_RIGHTHANDED
-    m33 = -2.0f / deltaZ;
-#else
-    m33 = 2.0f / deltaZ;
-#endif
-    m31 = m32 = m34 = 0;
-
-    m41 = -(right + left) / deltaX;
-    m42 = -(top + bottom) / deltaY;
-    m43 = -(farZ + nearZ) / deltaZ;
-    m44 = 1;
-}
-
 void matrix::CreateLookAtView(const vec3& eye, const vec3& up, const vec3& at)
 {
 #if MYFW_RIGHTHANDED
@@ -399,4 +409,147 @@ vec3 matrix::GetAt()
     return vec3(m31, m32, m33);
 }
 
+// 2x2 matrix helpers for Inverse(), each float4 holds a 2x2 block as (a b c d) for | a b |
+//                                                                                  | c d |
+static inline simd::float4 Mat2Mul(simd::float4 a, simd::float4 b)
+{
+    return simd::Add( simd::Mul( a, simd::Swizzle<0,3,0,3>( b ) ),
+                      simd::Mul( simd::Swizzle<1,0,3,2>( a ), simd::Swizzle<2,1,2,1>( b ) ) );
+}
+
+// Adjugate of a, times b.
+static inline simd::float4 Mat2AdjMul(simd::float4 a, simd::float4 b)
+{
+    return simd::Sub( simd::Mul( simd::Swizzle<3,3,0,0>( a ), b ),
+                      simd::Mul( simd::Swizzle<1,1,2,2>( a ), simd::Swizzle<2,3,0,1>( b ) ) );
+}
+
+// a, times the adjugate of b.
+static inline simd::float4 Mat2MulAdj(simd::float4 a, simd::float4 b)
+{
+    return simd::Sub( simd::Mul( a, simd::Swizzle<3,0,3,0>( b ) ),
+                      simd::Mul( simd::Swizzle<1,0,3,2>( a ), simd::Swizzle<2,1,2,1>( b ) ) );
+}
+
+bool matrix::Inverse(float tolerance)
+{
+    // Block inverse on the four 2x2 sub matrices | A B |
+    //                                            | C D |
+    // Works on the transpose as stored, which is fine since inverse(transpose(M)) == transpose(inverse(M)).
+    simd::float4 c0 = simd::Load( &m11 );
+    simd::float4 c1 = simd::Load( &m21 );
+    simd::float4 c2 = simd::Load( &m31 );
+    simd::float4 c3 = simd::Load( &m41 );
+
+    simd::float4 A = simd::Shuffle<0,1,0,1>( c0, c1 );
+    simd::float4 B = simd::Shuffle<2,3,2,3>( c0, c1 );
+    simd::float4 C = simd::Shuffle<0,1,0,1>( c2, c3 );
+    simd::float4 D = simd::Shuffle<2,3,2,3>( c2, c3 );
+
+    // Determinants of the sub matrices as (|A| |B| |C| |D|).
+    simd::float4 detSub = simd::Sub( simd::Mul( simd::Shuffle<0,2,0,2>( c0, c2 ), simd::Shuffle<1,3,1,3>( c1, c3 ) ),
+                                     simd::Mul( simd::Shuffle<1,3,1,3>( c0, c2 ), simd::Shuffle<0,2,0,2>( c1, c3 ) ) );
+    simd::float4 detA = simd::SplatLane<0>( detSub );
+    simd::float4 detB = simd::SplatLane<1>( detSub );
+    simd::float4 detC = simd::SplatLane<2>( detSub );
+    simd::float4 detD = simd::SplatLane<3>( detSub );
+
+    simd::float4 D_C = Mat2AdjMul( D, C );
+    simd::float4 A_B = Mat2AdjMul( A, B );
+
+    // Adjugates of the inverse's blocks | X Y |
+    //                                   | Z W |
+    simd::float4 X_ = simd::Sub( simd::Mul( detD, A ), Mat2Mul( B, D_C ) );
+    simd::float4 W_ = simd::Sub( simd::Mul( detA, D ), Mat2Mul( C, A_B ) );
+    simd::float4 Y_ = simd::Sub( simd::Mul( detB, C ), Mat2MulAdj( D, A_B ) );
+    simd::float4 Z_ = simd::Sub( simd::Mul( detC, B ), Mat2MulAdj( A, D_C ) );
+
+    // |M| = |A|*|D| + |B|*|C| - trace((A#B)(D#C)).
+    simd::float4 trace = simd::HorizontalAdd( simd::Mul( A_B, simd::Swizzle<0,2,1,3>( D_C ) ) );
+    simd::float4 detM = simd::Sub( simd::Add( simd::Mul( detA, detD ), simd::Mul( detB, detC ) ), trace );
+
+    // If determinant equals 0, there is no inverse.
+    if( fabs( simd::GetX( detM ) ) <= tolerance )
+        return false;
+
+    simd::float4 rDetM = simd::Div( simd::Set( 1, -1, -1, 1 ), detM );
+
+    X_ = simd::Mul( X_, rDetM );
+    Y_ = simd::Mul( Y_, rDetM );
+    Z_ = simd::Mul( Z_, rDetM );
+    W_ = simd::Mul( W_, rDetM );
+
+    // Undo the adjugates and put the blocks back into columns.
+    simd::Store( &m11, simd::Shuffle<3,1,3,1>( X_, Y_ ) );
+    simd::Store( &m21, simd::Shuffle<2,0,2,0>( X_, Y_ ) );
+    simd::Store( &m31, simd::Shuffle<3,1,3,1>( Z_, W_ ) );
+    simd::Store( &m41, simd::Shuffle<2,0,2,0>( Z_, W_ ) );
+
+    return true;
+}
+
+void matrix::InverseAffine()
+{
+    // For axes scaled by s, the inverse's rows are the axes divided by s^2.
+    simd::float4 c0 = simd::Load( &m11 );
+    simd::float4 c1 = simd::Load( &m21 );
+    simd::float4 c2 = simd::Load( &m31 );
+    simd::float4 c3 = simd::Zero();
+
+    simd::float4 translation = simd::Load( &m41 );
+
+    simd::Transpose( c0, c1, c2, c3 );
+
+    simd::float4 sizeSq = simd::Add( simd::Add( simd::Mul( c0, c0 ), simd::Mul( c1, c1 ) ), simd::Mul( c2, c2 ) );
+
+    float sizes[4];
+    simd::Store( sizes, sizeSq );
+    for( int i=0; i<4; i++ )
+    {
+        if( sizes[i] < 1.0e-8f )
+            sizes[i] = 1;
+    }
+
+    simd::float4 rSizeSq = simd::Div( simd::Splat( 1 ), simd::Load( sizes ) );
+
+    c0 = simd::Mul( c0, rSizeSq );
+    c1 = simd::Mul( c1, rSizeSq );
+    c2 = simd::Mul( c2, rSizeSq );
+
+    simd::float4 newTranslation = simd::Mul( c0, simd::SplatLane<0>( translation ) );
+    newTranslation = simd::Add( newTranslation, simd::Mul( c1, simd::SplatLane<1>( translation ) ) );
+    newTranslation = simd::Add( newTranslation, simd::Mul( c2, simd::SplatLane<2>( translation ) ) );
+    newTranslation = simd::Sub( simd::Set( 0, 0, 0, 1 ), newTranslation );
+
+    simd::Store( &m11, c0 );
+    simd::Store( &m21, c1 );
+    simd::Store( &m31, c2 );
+    simd::Store( &m41, newTranslation );
+}
+
+// Compile time checks, these fail the build if the math types stop being usable in constant expressions.
+static_assert( vec3( 1, 2, 3 ).Cross( vec3( 4, 5, 6 ) ) == vec3( -3, 6, -3 ), "vec3 should work in constant expressions." );
+static_assert( (vec2( 1, 2 ) * 2.0f + vec2( 1, 1 )).Dot( vec2( 1, 1 ) ) == 8.0f, "vec2 should work in constant expressions." );
+static_assert( vec4( vec3( 1, 2, 3 ), 4.0f ).WithW( 1.0f ).Dot( vec4( 1 ) ) == 7.0f, "vec4 should work in constant expressions." );
+static_assert( ivec2( 3, 4 ) * 2 == ivec2( 6, 8 ), "ivec2 should work in constant expressions." );
+
+static_assert( matrix::MakeIdentity().m44 == 1 && matrix::MakeIdentity().m41 == 0, "MakeIdentity" );
+static_assert( matrix::MakeScale( vec3( 2, 3, 4 ) ).m33 == 4, "MakeScale" );
+static_assert( matrix::MakeTranslation( vec3( 2, 3, 4 ) ).GetTranslation() == vec3( 2, 3, 4 ), "MakeTranslation" );
+
+// A 2 unit ortho box is the identity, apart from the z flip for right handed.
+static_assert( matrix::MakeOrtho( -1, 1, -1, 1, -1, 1 ).m11 == 1 && matrix::MakeOrtho( -1, 1, -1, 1, -1, 1 ).m43 == 0, "MakeOrtho" );
+static_assert( matrix::MakeOrtho( 0, 20, 0, 10, 0, 1 ).m41 == -1 && matrix::MakeOrtho( 0, 20, 0, 10, 0, 1 ).m22 == 0.2f, "MakeOrtho" );
+
+constexpr matrix CreateScaleAndTranslation()
+{
+    matrix mat = matrix::MakeIdentity();
+    mat.CreateScale( 2.0f );
+    mat.m41 = 5;
+    return mat;
+}
+static_assert( CreateScaleAndTranslation().m22 == 2 && CreateScaleAndTranslation().m41 == 5, "matrix Create functions should work in constant expressions." );
+
+static_assert( mat3( matrix::MakeScale( vec3( 2, 3, 4 ) ) ) * vec3( 1, 1, 1 ) == vec3( 2, 3, 4 ), "mat3 should take the top left of a matrix." );
+
 } // namespace fw
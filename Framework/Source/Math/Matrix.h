@@ -10,15 +10,19 @@
 #pragma once
 
 #include "Vector.h"
+#include "SIMD.h"
 
 namespace fw {
 
+class quat;
+
 // Values are stored column major.
 // m11 m21 m31 m41       Sx  0  0 Tx
 // m12 m22 m32 m42  --\   0 Sy  0 Ty
 // m13 m23 m33 m43  --/   0  0 Sz Tz
 // m14 m24 m34 m44        0  0  0  1
-class matrix
+// Each column is 4 contiguous floats, which is what the SIMD paths load and store.
+class alignas(16) matrix
 {
 public:
     float m11, m12, m13, m14, m21, m22, m23, m24, m31, m32, m33, m34, m41, m42, m43, m44;
@@ -30,7 +34,7 @@ public:
     //    , m12(up.x),    m22(up.y),    m32(up.z),    m42(pos.y),
     //    , m13(at.x),    m23(at.y),    m33(at.z),    m43(pos.z),
     //    , m14(0),       m24(0),       m34(0),       m44(1)      {}
-    matrix(float v11, float v12, float v13, float v14,
+    constexpr matrix(float v11, float v12, float v13, float v14,
         float v21, float v22, float v23, float v24,
         float v31, float v32, float v33, float v34,
         float v41, float v42, float v43, float v44)
@@ -48,6 +52,52 @@ public:
     //    , m13(o.m13), m23(o.m23), m33(o.m33), m43(o.m43)
     //    , m14(o.m14), m24(o.m24), m34(o.m34), m44(o.m44) {}
 
+    // Make functions return a new matrix and can be used in constant expressions,
+    // so fixed matrices can be built at compile time.
+    static constexpr matrix MakeIdentity()
+    {
+        return matrix( 1, 0, 0, 0,
+                       0, 1, 0, 0,
+                       0, 0, 1, 0,
+                       0, 0, 0, 1 );
+    }
+
+    static constexpr matrix MakeScale(vec3 scale)
+    {
+        return matrix( scale.x, 0, 0, 0,
+                       0, scale.y, 0, 0,
+                       0, 0, scale.z, 0,
+                       0, 0, 0, 1 );
+    }
+
+    static constexpr matrix MakeTranslation(vec3 pos)
+    {
+        return matrix( 1, 0, 0, 0,
+                       0, 1, 0, 0,
+                       0, 0, 1, 0,
+                       pos.x, pos.y, pos.z, 1 );
+    }
+
+    static constexpr matrix MakeOrtho(float left, float right, float bottom, float top, float nearZ, float farZ)
+    {
+        float deltaX = (right - left);
+        float deltaY = (top - bottom);
+        float deltaZ = (farZ - nearZ);
+
+        assert((deltaX != 0.0f) && (deltaY != 0.0f) && (deltaZ != 0.0f));
+
+#if MYFW_RIGHTHANDED
+        float scaleZ = -2.0f / deltaZ;
+#else
+        float scaleZ = 2.0f / deltaZ;
+#endif
+
+        return matrix( 2.0f / deltaX, 0, 0, 0,
+                       0, 2.0f / deltaY, 0, 0,
+                       0, 0, scaleZ, 0,
+                       -(right + left) / deltaX, -(top + bottom) / deltaY, -(farZ + nearZ) / deltaZ, 1 );
+    }
+
     // The following functions will affect existing values in the matrix.
     void Scale(float scale);
     void Scale(float sx, float sy, float sz);
@@ -59,28 +109,32 @@ public:
     void Translate(float x, float y, float z);
 
     // All create/set functions will overwrite values in the matrix.
-    void SetIdentity();
+    constexpr void SetIdentity() { *this = MakeIdentity(); }
     void SetAxesView(const vec3& right, const vec3& up, const vec3& at, const vec3& pos);
     void SetAxesWorld(const vec3& right, const vec3& up, const vec3& at, const vec3& pos);
     void SetTranslation(vec3 pos);
     void SetTranslation(float x, float y, float z);
-    void CreateScale(float scale);
-    void CreateScale(float x, float y, float z);
-    void CreateScale(vec3 scale);
+    constexpr void CreateScale(float scale) { *this = MakeScale( vec3(scale, scale, scale) ); }
+    constexpr void CreateScale(float x, float y, float z) { *this = MakeScale( vec3(x, y, z) ); }
+    constexpr void CreateScale(vec3 scale) { *this = MakeScale( scale ); }
     void CreateRotation(vec3 eulerdegrees);
-    void CreateTranslation(float x, float y, float z);
-    void CreateTranslation(vec3 pos);
+    void CreateRotation(const quat& rot);
+    constexpr void CreateTranslation(float x, float y, float z) { *this = MakeTranslation( vec3(x, y, z) ); }
+    constexpr void CreateTranslation(vec3 pos) { *this = MakeTranslation( pos ); }
     void CreateSRT(float scale, vec3 rot, vec3 pos);
     void CreateSRT(vec3 scale, vec3 rot, vec3 pos);
+    void CreateSRT(vec3 scale, vec3 rot, vec3 pos, matrix& rotationMat); // Also outputs the rotation alone, for normals.
+    void CreateSRT(vec3 scale, const quat& rot, vec3 pos);
+    void CreateSRT(vec3 scale, const quat& rot, vec3 pos, matrix& rotationMat);
     void CreateFrustum(float left, float right, float bottom, float top, float nearZ, float farZ);
     void CreatePerspectiveVFoV(float vertfovdegrees, float aspect, float nearZ, float farZ);
     void CreatePerspectiveHFoV(float horfovdegrees, float aspect, float nearZ, float farZ);
-    void CreateOrtho(float left, float right, float bottom, float top, float nearZ, float farZ);
+    constexpr void CreateOrtho(float left, float right, float bottom, float top, float nearZ, float farZ) { *this = MakeOrtho( left, right, bottom, top, nearZ, farZ ); }
     void CreateLookAtView(const vec3& eye, const vec3& up, const vec3& at);
     void CreateLookAtWorld(const vec3& eye, const vec3& up, const vec3& at);
 
     // Get values from matrix.
-    vec3 GetTranslation() { return vec3(m41, m42, m43); }
+    constexpr vec3 GetTranslation() const { return vec3(m41, m42, m43); }
     vec3 GetEulerAngles();
     vec3 GetScale();
     vec3 GetUp();
@@ -89,14 +143,17 @@ public:
 
     void Transpose()
     {
-        float temp;
+        simd::float4 c0 = simd::Load( &m11 );
+        simd::float4 c1 = simd::Load( &m21 );
+        simd::float4 c2 = simd::Load( &m31 );
+        simd::float4 c3 = simd::Load( &m41 );
+
+        simd::Transpose( c0, c1, c2, c3 );
 
-        temp = m12; m12 = m21; m21 = temp;
-        temp = m13; m13 = m31; m31 = temp;
-        temp = m14; m14 = m41; m41 = temp;
-        temp = m23; m23 = m32; m32 = temp;
-        temp = m24; m24 = m42; m42 = temp;
-        temp = m34; m34 = m43; m43 = temp;
+        simd::Store( &m11, c0 );
+        simd::Store( &m21, c1 );
+        simd::Store( &m31, c2 );
+        simd::Store( &m41, c3 );
     }
 
     inline matrix operator *(const float o) const
@@ -125,92 +182,138 @@ public:
 
     inline vec3 operator *(const vec3 o) const
     {
-        vec4 result = vec4(m11 * o.x + m21 * o.y + m31 * o.z + m41 * 1,
-                           m12 * o.x + m22 * o.y + m32 * o.z + m42 * 1,
-                           m13 * o.x + m23 * o.y + m33 * o.z + m43 * 1,
-                           m14 * o.x + m24 * o.y + m34 * o.z + m44 * 1);
-        if( result.w )
-            return vec3(result.x / result.w, result.y / result.w, result.z / result.w);
+        // Same order of operations as the scalar version, so results are bit for bit identical.
+        simd::float4 result = simd::Mul( simd::Load( &m11 ), simd::Splat( o.x ) );
+        result = simd::Add( result, simd::Mul( simd::Load( &m21 ), simd::Splat( o.y ) ) );
+        result = simd::Add( result, simd::Mul( simd::Load( &m31 ), simd::Splat( o.z ) ) );
+        result = simd::Add( result, simd::Load( &m41 ) );
+
+        float r[4];
+        simd::Store( r, result );
+
+        if( r[3] )
+            return vec3(r[0] / r[3], r[1] / r[3], r[2] / r[3]);
         else
-            return vec3(result.x, result.y, result.z);
+            return vec3(r[0], r[1], r[2]);
     }
 
     inline vec4 operator *(const vec4 o) const
     {
-        return vec4(m11 * o.x + m21 * o.y + m31 * o.z + m41 * o.w,
-            m12 * o.x + m22 * o.y + m32 * o.z + m42 * o.w,
-            m13 * o.x + m23 * o.y + m33 * o.z + m43 * o.w,
-            m14 * o.x + m24 * o.y + m34 * o.z + m44 * o.w);
+        simd::float4 result = simd::Mul( simd::Load( &m11 ), simd::Splat( o.x ) );
+        result = simd::Add( result, simd::Mul( simd::Load( &m21 ), simd::Splat( o.y ) ) );
+        result = simd::Add( result, simd::Mul( simd::Load( &m31 ), simd::Splat( o.z ) ) );
+        result = simd::Add( result, simd::Mul( simd::Load( &m41 ), simd::Splat( o.w ) ) );
+
+        float r[4];
+        simd::Store( r, result );
+
+        return vec4(r[0], r[1], r[2], r[3]);
     }
 
-    inline matrix operator *(const matrix o) const
+    inline matrix operator *(const matrix& o) const
     {
+        // Each column of the result is this matrix's columns weighted by the matching column of o.
+        simd::float4 c0 = simd::Load( &m11 );
+        simd::float4 c1 = simd::Load( &m21 );
+        simd::float4 c2 = simd::Load( &m31 );
+        simd::float4 c3 = simd::Load( &m41 );
+
         matrix newmat;
+        const float* pOther = &o.m11;
+        float* pResult = &newmat.m11;
 
-        newmat.m11 = this->m11 * o.m11 + this->m21 * o.m12 + this->m31 * o.m13 + this->m41 * o.m14;
-        newmat.m12 = this->m12 * o.m11 + this->m22 * o.m12 + this->m32 * o.m13 + this->m42 * o.m14;
-        newmat.m13 = this->m13 * o.m11 + this->m23 * o.m12 + this->m33 * o.m13 + this->m43 * o.m14;
-        newmat.m14 = this->m14 * o.m11 + this->m24 * o.m12 + this->m34 * o.m13 + this->m44 * o.m14;
-        newmat.m21 = this->m11 * o.m21 + this->m21 * o.m22 + this->m31 * o.m23 + this->m41 * o.m24;
-        newmat.m22 = this->m12 * o.m21 + this->m22 * o.m22 + this->m32 * o.m23 + this->m42 * o.m24;
-        newmat.m23 = this->m13 * o.m21 + this->m23 * o.m22 + this->m33 * o.m23 + this->m43 * o.m24;
-        newmat.m24 = this->m14 * o.m21 + this->m24 * o.m22 + this->m34 * o.m23 + this->m44 * o.m24;
-        newmat.m31 = this->m11 * o.m31 + this->m21 * o.m32 + this->m31 * o.m33 + this->m41 * o.m34;
-        newmat.m32 = this->m12 * o.m31 + this->m22 * o.m32 + this->m32 * o.m33 + this->m42 * o.m34;
-        newmat.m33 = this->m13 * o.m31 + this->m23 * o.m32 + this->m33 * o.m33 + this->m43 * o.m34;
-        newmat.m34 = this->m14 * o.m31 + this->m24 * o.m32 + this->m34 * o.m33 + this->m44 * o.m34;
-        newmat.m41 = this->m11 * o.m41 + this->m21 * o.m42 + this->m31 * o.m43 + this->m41 * o.m44;
-        newmat.m42 = this->m12 * o.m41 + this->m22 * o.m42 + this->m32 * o.m43 + this->m42 * o.m44;
-        newmat.m43 = this->m13 * o.m41 + this->m23 * o.m42 + this->m33 * o.m43 + this->m43 * o.m44;
-        newmat.m44 = this->m14 * o.m41 + this->m24 * o.m42 + this->m34 * o.m43 + this->m44 * o.m44;
+        for( int i=0; i<4; i++ )
+        {
+            simd::float4 column = simd::Load( pOther + i*4 );
+
+            simd::float4 result = simd::Mul( c0, simd::SplatLane<0>( column ) );
+            result = simd::Add( result, simd::Mul( c1, simd::SplatLane<1>( column ) ) );
+            result = simd::Add( result, simd::Mul( c2, simd::SplatLane<2>( column ) ) );
+            result = simd::Add( result, simd::Mul( c3, simd::SplatLane<3>( column ) ) );
+
+            simd::Store( pResult + i*4, result );
+        }
 
         return newmat;
     }
 
-    bool Inverse(float tolerance = 0.0001f)
-    {
-        // Determinants of 2x2 submatrices.
-        float S0 = m11 * m22 - m12 * m21;
-        float S1 = m11 * m23 - m13 * m21;
-        float S2 = m11 * m24 - m14 * m21;
-        float S3 = m12 * m23 - m13 * m22;
-        float S4 = m12 * m24 - m14 * m22;
-        float S5 = m13 * m24 - m14 * m23;
+    // General 4x4 inverse, leaves the matrix untouched and returns false if the determinant is within tolerance of 0.
+    bool Inverse(float tolerance = 0.0001f);
 
-        float C5 = m33 * m44 - m34 * m43;
-        float C4 = m32 * m44 - m34 * m42;
-        float C3 = m32 * m43 - m33 * m42;
-        float C2 = m31 * m44 - m34 * m41;
-        float C1 = m31 * m43 - m33 * m41;
-        float C0 = m31 * m42 - m32 * m41;
+    // Inverse of a matrix made only of scale, rotation and translation, like the ones from CreateSRT.
+    // Axes are assumed to be perpendicular, zero scale axes stay zero instead of failing.
+    void InverseAffine();
 
-        // If determinant equals 0, there is no inverse.
-        float det = S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
-        if( fabs(det) <= tolerance )
-            return false;
+    matrix GetInverse(float tolerance = 0.0001f)
+    {
+        matrix invmat = *this;
+        invmat.Inverse(tolerance);
+        return invmat;
+    }
 
-        // Compute adjugate matrix.
-        *this = matrix(
-            m22 * C5 - m23 * C4 + m24 * C3, -m12 * C5 + m13 * C4 - m14 * C3,
-            m42 * S5 - m43 * S4 + m44 * S3, -m32 * S5 + m33 * S4 - m34 * S3,
+    matrix GetInverseAffine()
+    {
+        matrix invmat = *this;
+        invmat.InverseAffine();
+        return invmat;
+    }
+};
+
+// 3x3 matrix for normals, column major like matrix, so it uploads straight to a GLSL mat3.
+// m11 m21 m31
+// m12 m22 m32
+// m13 m23 m33
+class mat3
+{
+public:
+    float m11, m12, m13, m21, m22, m23, m31, m32, m33;
 
-            -m21 * C5 + m23 * C2 - m24 * C1, m11 * C5 - m13 * C2 + m14 * C1,
-            -m41 * S5 + m43 * S2 - m44 * S1, m31 * S5 - m33 * S2 + m34 * S1,
+public:
+    constexpr mat3() : m11(1), m12(0), m13(0), m21(0), m22(1), m23(0), m31(0), m32(0), m33(1) {}
+    constexpr mat3(float v11, float v12, float v13,
+        float v21, float v22, float v23,
+        float v31, float v32, float v33)
+        : m11(v11), m12(v12), m13(v13)
+        , m21(v21), m22(v22), m23(v23)
+        , m31(v31), m32(v32), m33(v33)
+    {
+    }
 
-            m21 * C4 - m22 * C2 + m24 * C0, -m11 * C4 + m12 * C2 - m14 * C0,
-            m41 * S4 - m42 * S2 + m44 * S0, -m31 * S4 + m32 * S2 - m34 * S0,
+    // Top left 3x3 of a 4x4, drops translation and projection.
+    constexpr explicit mat3(const matrix& o)
+        : m11(o.m11), m12(o.m12), m13(o.m13)
+        , m21(o.m21), m22(o.m22), m23(o.m23)
+        , m31(o.m31), m32(o.m32), m33(o.m33)
+    {
+    }
 
-            -m21 * C3 + m22 * C1 - m23 * C0, m11 * C3 - m12 * C1 + m13 * C0,
-            -m41 * S3 + m42 * S1 - m43 * S0, m31 * S3 - m32 * S1 + m33 * S0) * (1 / det);
+    static constexpr mat3 MakeIdentity() { return mat3(); }
 
-        return true;
+    // Multiplies each column, e.g. by 1/scale to turn a rotation into the inverse transpose of rotation * scale.
+    constexpr void ScaleColumns(vec3 scale)
+    {
+        m11 *= scale.x; m12 *= scale.x; m13 *= scale.x;
+        m21 *= scale.y; m22 *= scale.y; m23 *= scale.y;
+        m31 *= scale.z; m32 *= scale.z; m33 *= scale.z;
     }
 
-    matrix GetInverse(float tolerance = 0.0001f)
+    constexpr vec3 operator *(const vec3 o) const
     {
-        matrix invmat = *this;
-        invmat.Inverse(tolerance);
-        return invmat;
+        return vec3( m11 * o.x + m21 * o.y + m31 * o.z,
+                     m12 * o.x + m22 * o.y + m32 * o.z,
+                     m13 * o.x + m23 * o.y + m33 * o.z );
+    }
+    constexpr mat3 operator *(const mat3& o) const
+    {
+        return mat3( m11 * o.m11 + m21 * o.m12 + m31 * o.m13,
+                     m12 * o.m11 + m22 * o.m12 + m32 * o.m13,
+                     m13 * o.m11 + m23 * o.m12 + m33 * o.m13,
+                     m11 * o.m21 + m21 * o.m22 + m31 * o.m23,
+                     m12 * o.m21 + m22 * o.m22 + m32 * o.m23,
+                     m13 * o.m21 + m23 * o.m22 + m33 * o.m23,
+                     m11 * o.m31 + m21 * o.m32 + m31 * o.m33,
+                     m12 * o.m31 + m22 * o.m32 + m32 * o.m33,
+                     m13 * o.m31 + m23 * o.m32 + m33 * o.m33 );
     }
 };
 
@@ -0,0 +1,85 @@
+#include "CoreHeaders.h"
+
+#include "Quaternion.h"
+#include "Matrix.h"
+#include "FastMath.h"
+
+namespace fw {
+
+// matrix::Rotate() turns clockwise looking down the axis, so the half angles are negated
+// to match it instead of the usual counter-clockwise quaternion.
+quat quat::CreateAxisAngle(vec3 axis, float degrees)
+{
+    float s, c;
+    fastmath::SinCosDegrees( -degrees * 0.5f, s, c );
+
+    axis.Normalize();
+    return quat( axis.x * s, axis.y * s, axis.z * s, c );
+}
+
+quat quat::CreateEuler(vec3 eulerdegrees)
+{
+    float s[4], c[4];
+    simd::float4 sines, cosines;
+    fastmath::SinCosDegrees( simd::Mul( simd::Set( eulerdegrees.x, eulerdegrees.y, eulerdegrees.z, 0 ), simd::Splat( -0.5f ) ), sines, cosines );
+    simd::Store( s, sines );
+    simd::Store( c, cosines );
+
+    float sx = s[0], cx = c[0];
+    float sy = s[1], cy = c[1];
+    float sz = s[2], cz = c[2];
+
+    // yaw * pitch * roll, multiplied out.
+    return quat( cy * sx * cz + sy * cx * sz,
+                 sy * cx * cz - cy * sx * sz,
+                 cy * cx * sz - sy * sx * cz,
+                 cy * cx * cz + sy * sx * sz );
+}
+
+quat quat::Nlerp(const quat& a, const quat& b, float t)
+{
+    // Flip b if needed so the blend goes the short way around.
+    float bt = a.Dot( b ) < 0 ? -t : t;
+
+    quat result;
+    simd::Store( &result.x, simd::Add( simd::Mul( simd::Load( &a.x ), simd::Splat( 1 - t ) ), simd::Mul( simd::Load( &b.x ), simd::Splat( bt ) ) ) );
+    return result.Normalize();
+}
+
+quat quat::Slerp(const quat& a, const quat& b, float t)
+{
+    float cosAngle = a.Dot( b );
+    float sign = 1;
+    if( cosAngle < 0 )
+    {
+        cosAngle = -cosAngle;
+        sign = -1;
+    }
+
+    // Nearly parallel, sin(angle) is too close to 0 to divide by.
+    if( cosAngle > 0.9995f )
+        return Nlerp( a, b, t );
+
+    float angle = acosf( cosAngle );
+    float invSin = 1.0f / sinf( angle );
+    float wa = sinf( (1 - t) * angle ) * invSin;
+    float wb = sinf( t * angle ) * invSin * sign;
+
+    quat result;
+    simd::Store( &result.x, simd::Add( simd::Mul( simd::Load( &a.x ), simd::Splat( wa ) ), simd::Mul( simd::Load( &b.x ), simd::Splat( wb ) ) ) );
+    return result;
+}
+
+matrix quat::GetMatrix() const
+{
+    matrix mat;
+    mat.CreateRotation( *this );
+    return mat;
+}
+
+vec3 quat::GetEulerAngles() const
+{
+    return GetMatrix().GetEulerAngles();
+}
+
+} // namespace fw
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Vector.h"
+#include "SIMD.h"
+#include "FastMath.h"
+
+namespace fw {
+
+class matrix;
+
+// Unit quaternion for rotations, stored x, y, z, w so it can be copied straight from a btQuaternion.
+// Angles follow the same convention as matrix::Rotate() and CreateRotation(), so
+// quat::CreateEuler( rot ) builds the same rotation as matrix::CreateRotation( rot ).
+class quat
+{
+public:
+    float x, y, z, w;
+
+public:
+    constexpr quat() : x(0), y(0), z(0), w(1) {}
+    constexpr quat(float nx, float ny, float nz, float nw) : x(nx), y(ny), z(nz), w(nw) {}
+
+    static constexpr quat Identity() { return quat(0.0f, 0.0f, 0.0f, 1.0f); }
+
+    // All create functions take angles in degrees.
+    static quat CreateAxisAngle(vec3 axis, float degrees);
+    static quat CreateEuler(vec3 eulerdegrees); // Roll (z), then pitch (x), then yaw (y).
+
+    inline float Dot(const quat& o) const { return x * o.x + y * o.y + z * o.z + w * o.w; }
+    inline float LengthSquared() const { return Dot( *this ); }
+    inline float Length() const { return sqrtf( Dot( *this ) ); }
+
+    inline quat GetNormalized() const { quat q = *this; q.Normalize(); return q; }
+    inline quat Normalize()
+    {
+        simd::float4 v = simd::Load( &x );
+        simd::float4 lenSq = simd::HorizontalAdd( simd::Mul( v, v ) );
+        if( !fequal( simd::GetX( lenSq ), 0 ) )
+        {
+            simd::Store( &x, simd::Mul( v, fastmath::RSqrt( lenSq ) ) );
+        }
+        return *this;
+    }
+
+    // The inverse of a unit quaternion.
+    inline quat GetConjugate() const { return quat(-x, -y, -z, w); }
+
+    // Combined rotation, o is applied first, the same order as matrix multiplies.
+    inline quat operator *(const quat& o) const
+    {
+        simd::float4 b = simd::Load( &o.x );
+
+        simd::float4 result = simd::Mul( simd::Splat( w ), b );
+        result = simd::Add( result, simd::Mul( simd::Splat( x ), simd::Mul( simd::Swizzle<3,2,1,0>( b ), simd::Set( 1,-1, 1,-1) ) ) );
+        result = simd::Add( result, simd::Mul( simd::Splat( y ), simd::Mul( simd::Swizzle<2,3,0,1>( b ), simd::Set( 1, 1,-1,-1) ) ) );
+        result = simd::Add( result, simd::Mul( simd::Splat( z ), simd::Mul( simd::Swizzle<1,0,3,2>( b ), simd::Set(-1, 1, 1,-1) ) ) );
+
+        quat newquat;
+        simd::Store( &newquat.x, result );
+        return newquat;
+    }
+
+    inline vec3 operator *(const vec3& v) const { return Rotate( v ); }
+    inline bool operator ==(const quat& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y) && fequal(this->z, o.z) && fequal(this->w, o.w); }
+    inline bool operator !=(const quat& o) const { return !(*this == o); }
+
+    // Rotates a vector without building a matrix.
+    inline vec3 Rotate(const vec3& v) const
+    {
+        vec3 u( x, y, z );
+        vec3 t = u.Cross( v ) * 2.0f;
+        return v + t * w + u.Cross( t );
+    }
+
+    // Interpolation along the shortest arc, results are normalized.
+    // Nlerp is cheaper and fine for small steps, Slerp keeps a constant angular speed.
+    static quat Nlerp(const quat& a, const quat& b, float t);
+    static quat Slerp(const quat& a, const quat& b, float t);
+
+    // Conversions.
+    matrix GetMatrix() const;
+    vec3 GetEulerAngles() const;
+};
+
+} // namespace fw
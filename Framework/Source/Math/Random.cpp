@@ -9,12 +9,20 @@ namespace Random {
 #undef min
 
 static Generator g_RNGObject;
+static unsigned int g_Seed = std::random_device()();
 
-void SetSeed(unsigned int seed)      { g_RNGObject.SetSeed( seed ); }
+void SetSeed(unsigned int seed)      { g_Seed = seed; g_RNGObject.SetSeed( seed ); }
 int GetInt(int min, int max)         { return g_RNGObject.GetInt( min, max ); }
 int GetInt(int max)                  { return g_RNGObject.GetInt( max ); }
 float GetFloat(float min, float max) { return g_RNGObject.GetFloat( min, max ); }
 float GetFloat(float max)            { return g_RNGObject.GetFloat( max ); }
+void Fill(float* pValues, size_t count, float min, float max) { g_RNGObject.Fill( pValues, count, min, max ); }
+void Fill(int* pValues, size_t count, int min, int max)       { g_RNGObject.Fill( pValues, count, min, max ); }
+
+Generator CreateStream(uint64_t stream)
+{
+    return Generator( g_Seed, stream );
+}
 
 Generator::Generator()
     : m_RNGEngine( pcg_extras::seed_seq_from<std::random_device>() )
@@ -26,11 +34,27 @@ Generator::Generator(unsigned int seed)
 {
 }
 
+// Each stream is a different sequence, not an offset into the same one.
+Generator::Generator(unsigned int seed, uint64_t stream)
+    : m_RNGEngine( seed, stream )
+{
+}
+
 void Generator::SetSeed(unsigned int seed)
 {
     m_RNGEngine.seed( seed );
 }
 
+void Generator::SetSeed(unsigned int seed, uint64_t stream)
+{
+    m_RNGEngine.seed( seed, stream );
+}
+
+void Generator::Advance(uint64_t delta)
+{
+    m_RNGEngine.advance( delta );
+}
+
 // Min and max are inclusive.
 int Generator::GetInt(int min, int max)
 {
@@ -60,5 +84,72 @@ float Generator::GetFloat(float max)
     return (float)(rand01 * max);
 }
 
+// pcg32's output function, the same as m_RNGEngine() gives for a state.
+static inline uint32_t Output(uint64_t state)
+{
+    uint32_t xorshifted = (uint32_t)(((state >> 18u) ^ state) >> 27u);
+    uint32_t rot = (uint32_t)(state >> 59u);
+    return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+}
+
+// Runs 8 copies of the generator, each 1 step ahead of the previous one and moving 8 steps at a time,
+// so the 64 bit multiplies don't wait on each other. Gives exactly the numbers a plain loop would.
+template<typename Func> void Generator::FillLanes(size_t count, Func store)
+{
+    const int lanes = 8;
+
+    // 8 steps of state * mul + inc, folded into one.
+    uint64_t mul = Engine::GetMultiplier();
+    uint64_t inc = m_RNGEngine.GetIncrement();
+    uint64_t mulStride = 1, incStride = 0;
+    for( int i=0; i<lanes; i++ )
+    {
+        incStride = incStride * mul + inc;
+        mulStride *= mul;
+    }
+
+    uint64_t state[lanes];
+    state[0] = m_RNGEngine.GetState();
+    for( int i=1; i<lanes; i++ )
+        state[i] = state[i-1] * mul + inc;
+
+    size_t i = 0;
+    for( ; i+lanes<=count; i+=lanes )
+    {
+        for( int l=0; l<lanes; l++ )
+        {
+            store( i + l, Output( state[l] ) );
+            state[l] = state[l] * mulStride + incStride;
+        }
+    }
+
+    int leftover = (int)(count - i);
+    for( int l=0; l<leftover; l++ )
+        store( i + l, Output( state[l] ) );
+
+    // Carry on from where the lanes left off, as if count numbers were pulled one at a time.
+    m_RNGEngine.SetState( state[leftover] );
+}
+
+void Generator::Fill(float* pValues, size_t count, float min, float max)
+{
+    assert( min < max );
+
+    // The top 24 bits fill a float's mantissa exactly.
+    // The add can still round up to max when min is bigger than the range, so clamp to the float below it.
+    float scale = (max - min) / 16777216.0f;
+    float below = nextafterf( max, min );
+    FillLanes( count, [=](size_t i, uint32_t bits) { pValues[i] = std::min( min + (float)(bits >> 8) * scale, below ); } );
+}
+
+void Generator::Fill(int* pValues, size_t count, int min, int max)
+{
+    assert( min <= max );
+
+    // Multiply and shift instead of a modulo, which would need retries to stay unbiased.
+    uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+    FillLanes( count, [=](size_t i, uint32_t bits) { pValues[i] = (int)(min + (int64_t)((bits * range) >> 32)); } );
+}
+
 } // namespace Random
 } // namespace fw
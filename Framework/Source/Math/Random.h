@@ -4,28 +4,65 @@
 namespace fw {
 namespace Random {
 
+class Generator;
+
 // Get values from a global generator.
 void SetSeed(unsigned int seed);
 int GetInt(int min, int max);
 int GetInt(int max);
 float GetFloat(float min, float max);
 float GetFloat(float max);
+void Fill(float* pValues, size_t count, float min, float max);
+void Fill(int* pValues, size_t count, int min, int max);
+
+// An independent generator seeded from the global seed, e.g. one per thread or per job.
+// The same seed and stream index always give the same sequence, whatever thread runs it.
+Generator CreateStream(uint64_t stream);
+
+// pcg32 with its state exposed, so Fill() can split it into lanes.
+class Engine : public pcg32
+{
+public:
+    using pcg32::pcg32;
+
+    uint64_t GetState() const { return state_; }
+    void SetState(uint64_t state) { state_ = state; }
+
+    // Each step is state * multiplier + increment.
+    static uint64_t GetMultiplier() { return multiplier(); }
+    uint64_t GetIncrement() const { return increment(); }
+};
 
 class Generator
 {
 public:
     Generator();
     Generator(unsigned int seed);
+    Generator(unsigned int seed, uint64_t stream);
 
     void SetSeed(unsigned int seed);
+    void SetSeed(unsigned int seed, uint64_t stream);
+
+    // Skips ahead as if delta numbers were pulled, in log(delta) steps.
+    void Advance(uint64_t delta);
 
     int GetInt(int min, int max);
     int GetInt(int max);
     float GetFloat(float min, float max);
     float GetFloat(float max);
 
+    // Bulk versions, one number per value, several at a time.
+    // Floats are in [min, max), ints in [min, max] with a bias below 2^-32 * range.
+    // The result only depends on the generator, so a buffer can be split across threads by
+    // giving each piece a copy that was Advance()'d to its start, and match a single Fill().
+    void Fill(float* pValues, size_t count, float min, float max);
+    void Fill(int* pValues, size_t count, int min, int max);
+
+protected:
+    template<typename Func> void FillLanes(size_t count, Func store);
+
 protected:
-    pcg32 m_RNGEngine;
+    Engine m_RNGEngine;
 };
 
 } // namespace Random
@@ -0,0 +1,178 @@
+#pragma once
+
+// Thin wrapper over 4-wide float registers so the math code is written once for every backend.
+// The backend is picked at compile time:
+//   SSE2 on x86/x64, NEON on ARM, plain floats everywhere else or when FW_SIMD_SCALAR is defined.
+
+#if !defined(FW_SIMD_SCALAR)
+    #if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+        #define FW_SIMD_SSE 1
+        #include <emmintrin.h>
+    #elif defined(_M_ARM) || defined(_M_ARM64) || defined(__ARM_NEON)
+        #define FW_SIMD_NEON 1
+        #include <arm_neon.h>
+    #else
+        #define FW_SIMD_SCALAR 1
+    #endif
+#endif
+
+namespace fw {
+namespace simd {
+
+#if FW_SIMD_SSE
+
+typedef __m128 float4;
+
+inline float4 Load(const float* p) { return _mm_loadu_ps( p ); }
+inline void Store(float* p, float4 v) { _mm_storeu_ps( p, v ); }
+inline float4 LoadAligned(const float* p) { return _mm_load_ps( p ); }
+inline void StoreAligned(float* p, float4 v) { _mm_store_ps( p, v ); }
+inline float4 Set(float x, float y, float z, float w) { return _mm_setr_ps( x, y, z, w ); }
+inline float4 Splat(float v) { return _mm_set1_ps( v ); }
+inline float4 Zero() { return _mm_setzero_ps(); }
+
+inline float4 Add(float4 a, float4 b) { return _mm_add_ps( a, b ); }
+inline float4 Sub(float4 a, float4 b) { return _mm_sub_ps( a, b ); }
+inline float4 Mul(float4 a, float4 b) { return _mm_mul_ps( a, b ); }
+inline float4 Div(float4 a, float4 b) { return _mm_div_ps( a, b ); }
+inline float4 Min(float4 a, float4 b) { return _mm_min_ps( a, b ); }
+inline float4 Max(float4 a, float4 b) { return _mm_max_ps( a, b ); }
+
+// To the nearest whole number, only valid within int range.
+inline float4 Round(float4 v) { return _mm_cvtepi32_ps( _mm_cvtps_epi32( v ) ); }
+
+// About 12 bits, relative error below 1.5 * 2^-12.
+const int RSqrtEstimateBits = 12;
+inline float4 RSqrtEstimate(float4 v) { return _mm_rsqrt_ps( v ); }
+
+inline float GetX(float4 v) { return _mm_cvtss_f32( v ); }
+
+// Result is (a[X], a[Y], b[Z], b[W]).
+template<int X, int Y, int Z, int W> inline float4 Shuffle(float4 a, float4 b)
+{
+    return _mm_shuffle_ps( a, b, _MM_SHUFFLE( W, Z, Y, X ) );
+}
+
+#elif FW_SIMD_NEON
+
+typedef float32x4_t float4;
+
+inline float4 Load(const float* p) { return vld1q_f32( p ); }
+inline void Store(float* p, float4 v) { vst1q_f32( p, v ); }
+inline float4 LoadAligned(const float* p) { return vld1q_f32( p ); }
+inline void StoreAligned(float* p, float4 v) { vst1q_f32( p, v ); }
+inline float4 Set(float x, float y, float z, float w) { float v[4] = { x, y, z, w }; return vld1q_f32( v ); }
+inline float4 Splat(float v) { return vdupq_n_f32( v ); }
+inline float4 Zero() { return vdupq_n_f32( 0 ); }
+
+inline float4 Add(float4 a, float4 b) { return vaddq_f32( a, b ); }
+inline float4 Sub(float4 a, float4 b) { return vsubq_f32( a, b ); }
+inline float4 Mul(float4 a, float4 b) { return vmulq_f32( a, b ); }
+
+// Two Newton-Raphson steps on the reciprocal estimate, close to a real divide.
+inline float4 Div(float4 a, float4 b)
+{
+    float4 recip = vrecpeq_f32( b );
+    recip = vmulq_f32( vrecpsq_f32( b, recip ), recip );
+    recip = vmulq_f32( vrecpsq_f32( b, recip ), recip );
+    return vmulq_f32( a, recip );
+}
+
+inline float4 Min(float4 a, float4 b) { return vminq_f32( a, b ); }
+inline float4 Max(float4 a, float4 b) { return vmaxq_f32( a, b ); }
+
+// To the nearest whole number, only valid within int range.
+inline float4 Round(float4 v)
+{
+    float4 half = vbslq_f32( vcgeq_f32( v, vdupq_n_f32( 0 ) ), vdupq_n_f32( 0.5f ), vdupq_n_f32( -0.5f ) );
+    return vcvtq_f32_s32( vcvtq_s32_f32( vaddq_f32( v, half ) ) );
+}
+
+// About 8 bits.
+const int RSqrtEstimateBits = 8;
+inline float4 RSqrtEstimate(float4 v) { return vrsqrteq_f32( v ); }
+
+inline float GetX(float4 v) { return vgetq_lane_f32( v, 0 ); }
+
+// Result is (a[X], a[Y], b[Z], b[W]).
+template<int X, int Y, int Z, int W> inline float4 Shuffle(float4 a, float4 b)
+{
+    float4 result = vdupq_n_f32( vgetq_lane_f32( a, X ) );
+    result = vsetq_lane_f32( vgetq_lane_f32( a, Y ), result, 1 );
+    result = vsetq_lane_f32( vgetq_lane_f32( b, Z ), result, 2 );
+    result = vsetq_lane_f32( vgetq_lane_f32( b, W ), result, 3 );
+    return result;
+}
+
+#else
+
+struct float4
+{
+    float v[4];
+};
+
+inline float4 Load(const float* p) { float4 r = { p[0], p[1], p[2], p[3] }; return r; }
+inline void Store(float* p, float4 v) { p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3]; }
+inline float4 LoadAligned(const float* p) { return Load( p ); }
+inline void StoreAligned(float* p, float4 v) { Store( p, v ); }
+inline float4 Set(float x, float y, float z, float w) { float4 r = { x, y, z, w }; return r; }
+inline float4 Splat(float v) { float4 r = { v, v, v, v }; return r; }
+inline float4 Zero() { return Splat( 0 ); }
+
+inline float4 Add(float4 a, float4 b) { float4 r = { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] }; return r; }
+inline float4 Sub(float4 a, float4 b) { float4 r = { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] }; return r; }
+inline float4 Mul(float4 a, float4 b) { float4 r = { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] }; return r; }
+inline float4 Div(float4 a, float4 b) { float4 r = { a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3] }; return r; }
+inline float4 Min(float4 a, float4 b) { float4 r = { a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1], a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3] }; return r; }
+inline float4 Max(float4 a, float4 b) { float4 r = { a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1], a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3] }; return r; }
+
+// To the nearest whole number.
+inline float4 Round(float4 v) { float4 r = { floorf( v.v[0] + 0.5f ), floorf( v.v[1] + 0.5f ), floorf( v.v[2] + 0.5f ), floorf( v.v[3] + 0.5f ) }; return r; }
+
+// No estimate instruction, so it's exact.
+const int RSqrtEstimateBits = 24;
+inline float4 RSqrtEstimate(float4 v) { float4 r = { 1 / sqrtf( v.v[0] ), 1 / sqrtf( v.v[1] ), 1 / sqrtf( v.v[2] ), 1 / sqrtf( v.v[3] ) }; return r; }
+
+inline float GetX(float4 v) { return v.v[0]; }
+
+// Result is (a[X], a[Y], b[Z], b[W]).
+template<int X, int Y, int Z, int W> inline float4 Shuffle(float4 a, float4 b)
+{
+    float4 r = { a.v[X], a.v[Y], b.v[Z], b.v[W] };
+    return r;
+}
+
+#endif
+
+// Helpers built on the operations above, the same for every backend.
+
+// Floats per register, and the byte alignment LoadAligned() and StoreAligned() need.
+const unsigned int Lanes = 4;
+const unsigned int Alignment = 16;
+
+template<int X, int Y, int Z, int W> inline float4 Swizzle(float4 v) { return Shuffle<X, Y, Z, W>( v, v ); }
+template<int Lane> inline float4 SplatLane(float4 v) { return Shuffle<Lane, Lane, Lane, Lane>( v, v ); }
+
+// Sum of all 4 lanes, in every lane.
+inline float4 HorizontalAdd(float4 v)
+{
+    v = Add( v, Swizzle<2, 3, 0, 1>( v ) );
+    return Add( v, Swizzle<1, 0, 3, 2>( v ) );
+}
+
+// Rows become columns.
+inline void Transpose(float4& a, float4& b, float4& c, float4& d)
+{
+    float4 t0 = Shuffle<0, 1, 0, 1>( a, b );
+    float4 t1 = Shuffle<2, 3, 2, 3>( a, b );
+    float4 t2 = Shuffle<0, 1, 0, 1>( c, d );
+    float4 t3 = Shuffle<2, 3, 2, 3>( c, d );
+
+    a = Shuffle<0, 2, 0, 2>( t0, t2 );
+    b = Shuffle<1, 3, 1, 3>( t0, t2 );
+    c = Shuffle<0, 2, 0, 2>( t1, t3 );
+    d = Shuffle<1, 3, 1, 3>( t1, t3 );
+}
+
+} // namespace simd
+} // namespace fw
@@ -0,0 +1,234 @@
+#include "CoreHeaders.h"
+
+#include "SoAArray.h"
+#include "BatchTransform.h"
+#include "FastMath.h"
+
+namespace fw {
+
+void* AlignedAlloc(size_t bytes, size_t alignment)
+{
+#if _MSC_VER
+    return _aligned_malloc( bytes, alignment );
+#else
+    void* p = nullptr;
+    if( posix_memalign( &p, alignment, bytes ) != 0 )
+        return nullptr;
+    return p;
+#endif
+}
+
+void AlignedFree(void* p)
+{
+#if _MSC_VER
+    _aligned_free( p );
+#else
+    free( p );
+#endif
+}
+
+// Streams are aligned and padded, so every loop below works in whole registers.
+static inline simd::float4 Get(const float* pStream, size_t i) { return simd::LoadAligned( pStream + i ); }
+static inline void Put(float* pStream, size_t i, simd::float4 v) { simd::StoreAligned( pStream + i, v ); }
+
+void Add(const SoAVec3Array& a, const SoAVec3Array& b, SoAVec3Array& out)
+{
+    assert( a.Size() == b.Size() );
+    out.Resize( a.Size() );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        for( unsigned int s=0; s<3; s++ )
+            Put( out.GetStream( s ), i, simd::Add( Get( a.GetStream( s ), i ), Get( b.GetStream( s ), i ) ) );
+    }
+}
+
+void Subtract(const SoAVec3Array& a, const SoAVec3Array& b, SoAVec3Array& out)
+{
+    assert( a.Size() == b.Size() );
+    out.Resize( a.Size() );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        for( unsigned int s=0; s<3; s++ )
+            Put( out.GetStream( s ), i, simd::Sub( Get( a.GetStream( s ), i ), Get( b.GetStream( s ), i ) ) );
+    }
+}
+
+void Scale(const SoAVec3Array& a, float scale, SoAVec3Array& out)
+{
+    out.Resize( a.Size() );
+    simd::float4 s4 = simd::Splat( scale );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        for( unsigned int s=0; s<3; s++ )
+            Put( out.GetStream( s ), i, simd::Mul( Get( a.GetStream( s ), i ), s4 ) );
+    }
+}
+
+void AddScaled(const SoAVec3Array& a, const SoAVec3Array& b, float scale, SoAVec3Array& out)
+{
+    assert( a.Size() == b.Size() );
+    out.Resize( a.Size() );
+    simd::float4 s4 = simd::Splat( scale );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        for( unsigned int s=0; s<3; s++ )
+            Put( out.GetStream( s ), i, simd::Add( Get( a.GetStream( s ), i ), simd::Mul( Get( b.GetStream( s ), i ), s4 ) ) );
+    }
+}
+
+void Lerp(const SoAVec3Array& a, const SoAVec3Array& b, float t, SoAVec3Array& out)
+{
+    assert( a.Size() == b.Size() );
+    out.Resize( a.Size() );
+    simd::float4 t4 = simd::Splat( t );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        for( unsigned int s=0; s<3; s++ )
+        {
+            simd::float4 va = Get( a.GetStream( s ), i );
+            Put( out.GetStream( s ), i, simd::Add( va, simd::Mul( simd::Sub( Get( b.GetStream( s ), i ), va ), t4 ) ) );
+        }
+    }
+}
+
+static inline simd::float4 Dot4(const SoAVec3Array& a, const SoAVec3Array& b, size_t i)
+{
+    simd::float4 result = simd::Mul( Get( a.GetX(), i ), Get( b.GetX(), i ) );
+    result = simd::Add( result, simd::Mul( Get( a.GetY(), i ), Get( b.GetY(), i ) ) );
+    return simd::Add( result, simd::Mul( Get( a.GetZ(), i ), Get( b.GetZ(), i ) ) );
+}
+
+void Dot(const SoAVec3Array& a, const SoAVec3Array& b, SoAFloatArray& out)
+{
+    assert( a.Size() == b.Size() );
+    out.Resize( a.Size() );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        Put( out.GetData(), i, Dot4( a, b, i ) );
+    }
+}
+
+void Length(const SoAVec3Array& a, SoAFloatArray& out)
+{
+    out.Resize( a.Size() );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        Put( out.GetData(), i, fastmath::Sqrt( Dot4( a, a, i ) ) );
+    }
+}
+
+void Normalize(const SoAVec3Array& a, SoAVec3Array& out)
+{
+    out.Resize( a.Size() );
+
+    for( size_t i=0; i<a.GetPaddedSize(); i+=simd::Lanes )
+    {
+        // Clamped so a zero vector is 0 * big instead of 0 * infinity.
+        simd::float4 invLength = fastmath::RSqrt( simd::Max( Dot4( a, a, i ), simd::Splat( FLT_MIN ) ) );
+
+        for( unsigned int s=0; s<3; s++ )
+            Put( out.GetStream( s ), i, simd::Mul( Get( a.GetStream( s ), i ), invLength ) );
+    }
+}
+
+void TransformPoints(const matrix& mat, const SoAVec3Array& points, SoAVec3Array& out)
+{
+    out.Resize( points.Size() );
+
+    TransformPointsSoA( mat, points.GetX(), points.GetY(), points.GetZ(), out.GetX(), out.GetY(), out.GetZ(), points.GetPaddedSize() );
+
+    // The padding picked up the translation.
+    out.ClearPadding();
+}
+
+void TransformPoints(const SoAMatrixArray& mats, const SoAVec3Array& points, SoAVec3Array& out)
+{
+    assert( mats.Size() == points.Size() );
+    out.Resize( points.Size() );
+
+    for( size_t i=0; i<points.GetPaddedSize(); i+=simd::Lanes )
+    {
+        simd::float4 x = Get( points.GetX(), i );
+        simd::float4 y = Get( points.GetY(), i );
+        simd::float4 z = Get( points.GetZ(), i );
+
+        // Column c, row r of the matrix is stream c*4 + r.
+        for( unsigned int r=0; r<3; r++ )
+        {
+            simd::float4 result = simd::Mul( Get( mats.GetStream( r ), i ), x );
+            result = simd::Add( result, simd::Mul( Get( mats.GetStream( 4 + r ), i ), y ) );
+            result = simd::Add( result, simd::Mul( Get( mats.GetStream( 8 + r ), i ), z ) );
+            result = simd::Add( result, Get( mats.GetStream( 12 + r ), i ) );
+            Put( out.GetStream( r ), i, result );
+        }
+    }
+}
+
+// The same closed form as matrix::CreateSRT(), with 4 objects in the lanes.
+void CreateSRTs(const SoAVec3Array& scales, const SoAVec3Array& rotations, const SoAVec3Array& positions, SoAMatrixArray& out)
+{
+    assert( scales.Size() == rotations.Size() && scales.Size() == positions.Size() );
+    out.Resize( scales.Size() );
+
+    simd::float4 zero = simd::Zero();
+    simd::float4 one = simd::Splat( 1 );
+
+    for( size_t i=0; i<scales.GetPaddedSize(); i+=simd::Lanes )
+    {
+        simd::float4 sx, cx, sy, cy, sz, cz;
+        fastmath::SinCosDegrees( Get( rotations.GetX(), i ), sx, cx );
+        fastmath::SinCosDegrees( Get( rotations.GetY(), i ), sy, cy );
+        fastmath::SinCosDegrees( Get( rotations.GetZ(), i ), sz, cz );
+
+        simd::float4 scaleX = Get( scales.GetX(), i );
+        simd::float4 scaleY = Get( scales.GetY(), i );
+        simd::float4 scaleZ = Get( scales.GetZ(), i );
+
+        simd::float4 sysx = simd::Mul( sy, sx );
+        simd::float4 cysx = simd::Mul( cy, sx );
+
+        simd::float4 r11 = simd::Sub( simd::Mul( cy, cz ), simd::Mul( sysx, sz ) );
+        simd::float4 r12 = simd::Sub( zero, simd::Mul( cx, sz ) );
+        simd::float4 r13 = simd::Add( simd::Mul( sy, cz ), simd::Mul( cysx, sz ) );
+
+        simd::float4 r21 = simd::Add( simd::Mul( cy, sz ), simd::Mul( sysx, cz ) );
+        simd::float4 r22 = simd::Mul( cx, cz );
+        simd::float4 r23 = simd::Sub( simd::Mul( sy, sz ), simd::Mul( cysx, cz ) );
+
+        simd::float4 r31 = simd::Sub( zero, simd::Mul( sy, cx ) );
+        simd::float4 r32 = sx;
+        simd::float4 r33 = simd::Mul( cy, cx );
+
+        Put( out.GetStream( 0 ), i, simd::Mul( r11, scaleX ) );
+        Put( out.GetStream( 1 ), i, simd::Mul( r12, scaleX ) );
+        Put( out.GetStream( 2 ), i, simd::Mul( r13, scaleX ) );
+        Put( out.GetStream( 3 ), i, zero );
+
+        Put( out.GetStream( 4 ), i, simd::Mul( r21, scaleY ) );
+        Put( out.GetStream( 5 ), i, simd::Mul( r22, scaleY ) );
+        Put( out.GetStream( 6 ), i, simd::Mul( r23, scaleY ) );
+        Put( out.GetStream( 7 ), i, zero );
+
+        Put( out.GetStream( 8 ), i, simd::Mul( r31, scaleZ ) );
+        Put( out.GetStream( 9 ), i, simd::Mul( r32, scaleZ ) );
+        Put( out.GetStream( 10 ), i, simd::Mul( r33, scaleZ ) );
+        Put( out.GetStream( 11 ), i, zero );
+
+        Put( out.GetStream( 12 ), i, Get( positions.GetX(), i ) );
+        Put( out.GetStream( 13 ), i, Get( positions.GetY(), i ) );
+        Put( out.GetStream( 14 ), i, Get( positions.GetZ(), i ) );
+        Put( out.GetStream( 15 ), i, one );
+    }
+
+    // The padding got m44 = 1.
+    out.ClearPadding();
+}
+
+} // namespace fw
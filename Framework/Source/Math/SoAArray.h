@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Vector.h"
+#include "Matrix.h"
+#include "SIMD.h"
+
+#include <string.h>
+
+namespace fw {
+
+// Structure of arrays containers for bulk component data, so loops over many objects
+// run 4 at a time instead of one vec3 at a time.
+//
+// Each component lives in its own float array, aligned for simd::LoadAligned() and padded
+// up to a multiple of simd::Lanes. The padding is always kept at 0, so the bulk operations
+// below never need a leftover loop.
+
+void* AlignedAlloc(size_t bytes, size_t alignment);
+void AlignedFree(void* p);
+
+// N float arrays of the same length, in one aligned block.
+template<unsigned int N> class SoAStreams
+{
+public:
+    SoAStreams() {}
+    explicit SoAStreams(size_t size) { Resize( size ); }
+    SoAStreams(const SoAStreams& o) { *this = o; }
+    SoAStreams(SoAStreams&& o) { Swap( o ); }
+    ~SoAStreams() { AlignedFree( m_pBlock ); }
+
+    SoAStreams& operator=(const SoAStreams& o)
+    {
+        if( this != &o )
+        {
+            Resize( o.m_Size );
+            for( unsigned int s=0; s<N; s++ )
+                memcpy( m_pStreams[s], o.m_pStreams[s], sizeof(float) * o.GetPaddedSize() );
+        }
+        return *this;
+    }
+
+    SoAStreams& operator=(SoAStreams&& o) { Swap( o ); return *this; }
+
+    void Swap(SoAStreams& o)
+    {
+        std::swap( m_pBlock, o.m_pBlock );
+        std::swap( m_Size, o.m_Size );
+        std::swap( m_Capacity, o.m_Capacity );
+        for( unsigned int s=0; s<N; s++ )
+            std::swap( m_pStreams[s], o.m_pStreams[s] );
+    }
+
+    size_t Size() const { return m_Size; }
+    size_t Capacity() const { return m_Capacity; }
+    bool Empty() const { return m_Size == 0; }
+
+    // Size rounded up to whole registers, what the bulk operations loop over.
+    size_t GetPaddedSize() const { return (m_Size + simd::Lanes - 1) & ~(size_t)(simd::Lanes - 1); }
+
+    float* GetStream(unsigned int s) { return m_pStreams[s]; }
+    const float* GetStream(unsigned int s) const { return m_pStreams[s]; }
+
+    void Reserve(size_t capacity)
+    {
+        capacity = (capacity + simd::Lanes - 1) & ~(size_t)(simd::Lanes - 1);
+        if( capacity <= m_Capacity )
+            return;
+
+        float* pBlock = static_cast<float*>( AlignedAlloc( sizeof(float) * capacity * N, simd::Alignment ) );
+        memset( pBlock, 0, sizeof(float) * capacity * N );
+
+        for( unsigned int s=0; s<N; s++ )
+        {
+            if( m_Size > 0 )
+                memcpy( pBlock + capacity * s, m_pStreams[s], sizeof(float) * m_Size );
+            m_pStreams[s] = pBlock + capacity * s;
+        }
+
+        AlignedFree( m_pBlock );
+        m_pBlock = pBlock;
+        m_Capacity = capacity;
+    }
+
+    // New elements are 0.
+    void Resize(size_t size)
+    {
+        if( size > m_Capacity )
+            Reserve( size > m_Capacity * 2 ? size : m_Capacity * 2 );
+
+        // Clear whatever was cut off, so the padding stays 0.
+        if( size < m_Size )
+        {
+            size_t oldPadded = GetPaddedSize();
+            for( unsigned int s=0; s<N; s++ )
+                memset( m_pStreams[s] + size, 0, sizeof(float) * (oldPadded - size) );
+        }
+
+        m_Size = size;
+    }
+
+    void Clear() { Resize( 0 ); }
+
+    // For code that writes whole registers and may have left something in the padding.
+    void ClearPadding()
+    {
+        size_t padded = GetPaddedSize();
+        for( unsigned int s=0; s<N; s++ )
+            memset( m_pStreams[s] + m_Size, 0, sizeof(float) * (padded - m_Size) );
+    }
+
+protected:
+    float* m_pBlock = nullptr;
+    float* m_pStreams[N] = {};
+    size_t m_Size = 0;
+    size_t m_Capacity = 0;
+};
+
+// Walks an SoA array by index, handing out whatever the array's operator[] returns.
+template<typename ArrayType, typename RefType> class SoAIterator
+{
+public:
+    SoAIterator(ArrayType* pArray, size_t index) : m_pArray( pArray ), m_Index( index ) {}
+
+    RefType operator*() const { return (*m_pArray)[m_Index]; }
+    SoAIterator& operator++() { m_Index++; return *this; }
+    bool operator==(const SoAIterator& o) const { return m_Index == o.m_Index; }
+    bool operator!=(const SoAIterator& o) const { return m_Index != o.m_Index; }
+
+protected:
+    ArrayType* m_pArray;
+    size_t m_Index;
+};
+
+class SoAFloatArray : public SoAStreams<1>
+{
+public:
+    using SoAStreams<1>::SoAStreams;
+
+    float& operator[](size_t i) { return m_pStreams[0][i]; }
+    float operator[](size_t i) const { return m_pStreams[0][i]; }
+
+    void PushBack(float value) { Resize( m_Size + 1 ); m_pStreams[0][m_Size - 1] = value; }
+
+    float* GetData() { return m_pStreams[0]; }
+    const float* GetData() const { return m_pStreams[0]; }
+};
+
+// Reads and writes one element of an SoAVec3Array as if it were a vec3.
+class SoAVec3Ref
+{
+public:
+    float& x;
+    float& y;
+    float& z;
+
+public:
+    SoAVec3Ref(float& nx, float& ny, float& nz) : x( nx ), y( ny ), z( nz ) {}
+
+    operator vec3() const { return vec3( x, y, z ); }
+
+    SoAVec3Ref& operator=(const vec3& o) { x = o.x; y = o.y; z = o.z; return *this; }
+    SoAVec3Ref& operator=(const SoAVec3Ref& o) { return *this = (vec3)o; }
+    SoAVec3Ref& operator+=(const vec3& o) { x += o.x; y += o.y; z += o.z; return *this; }
+    SoAVec3Ref& operator-=(const vec3& o) { x -= o.x; y -= o.y; z -= o.z; return *this; }
+    SoAVec3Ref& operator*=(float o) { x *= o; y *= o; z *= o; return *this; }
+};
+
+class SoAVec3Array : public SoAStreams<3>
+{
+public:
+    typedef SoAIterator<SoAVec3Array, SoAVec3Ref> iterator;
+    typedef SoAIterator<const SoAVec3Array, vec3> const_iterator;
+
+public:
+    using SoAStreams<3>::SoAStreams;
+
+    SoAVec3Ref operator[](size_t i) { return SoAVec3Ref( m_pStreams[0][i], m_pStreams[1][i], m_pStreams[2][i] ); }
+    vec3 operator[](size_t i) const { return vec3( m_pStreams[0][i], m_pStreams[1][i], m_pStreams[2][i] ); }
+
+    void PushBack(const vec3& value) { Resize( m_Size + 1 ); (*this)[m_Size - 1] = value; }
+
+    iterator begin() { return iterator( this, 0 ); }
+    iterator end() { return iterator( this, m_Size ); }
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end() const { return const_iterator( this, m_Size ); }
+
+    float* GetX() { return m_pStreams[0]; }
+    float* GetY() { return m_pStreams[1]; }
+    float* GetZ() { return m_pStreams[2]; }
+    const float* GetX() const { return m_pStreams[0]; }
+    const float* GetY() const { return m_pStreams[1]; }
+    const float* GetZ() const { return m_pStreams[2]; }
+};
+
+// One stream per matrix element, in the same order as the floats in a matrix.
+class SoAMatrixArray : public SoAStreams<16>
+{
+public:
+    typedef SoAIterator<const SoAMatrixArray, matrix> const_iterator;
+
+public:
+    using SoAStreams<16>::SoAStreams;
+
+    matrix operator[](size_t i) const { return Get( i ); }
+
+    matrix Get(size_t i) const
+    {
+        matrix mat;
+        float* pOut = &mat.m11;
+        for( unsigned int s=0; s<16; s++ )
+            pOut[s] = m_pStreams[s][i];
+        return mat;
+    }
+
+    void Set(size_t i, const matrix& mat)
+    {
+        const float* pIn = &mat.m11;
+        for( unsigned int s=0; s<16; s++ )
+            m_pStreams[s][i] = pIn[s];
+    }
+
+    void PushBack(const matrix& mat) { Resize( m_Size + 1 ); Set( m_Size - 1, mat ); }
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end() const { return const_iterator( this, m_Size ); }
+};
+
+// Bulk operations, 4 elements per step. Outputs are resized to match the first input and
+// may be the same array as an input. Inputs need to be the same size.
+
+void Add(const SoAVec3Array& a, const SoAVec3Array& b, SoAVec3Array& out);
+void Subtract(const SoAVec3Array& a, const SoAVec3Array& b, SoAVec3Array& out);
+void Scale(const SoAVec3Array& a, float scale, SoAVec3Array& out);
+void AddScaled(const SoAVec3Array& a, const SoAVec3Array& b, float scale, SoAVec3Array& out); // a + b * scale, e.g. pos + vel * dt.
+void Lerp(const SoAVec3Array& a, const SoAVec3Array& b, float t, SoAVec3Array& out);
+void Dot(const SoAVec3Array& a, const SoAVec3Array& b, SoAFloatArray& out);
+void Length(const SoAVec3Array& a, SoAFloatArray& out);
+void Normalize(const SoAVec3Array& a, SoAVec3Array& out); // Zero vectors stay zero.
+
+// out[i] = mat * points[i], with w = 1.
+void TransformPoints(const matrix& mat, const SoAVec3Array& points, SoAVec3Array& out);
+
+// out[i] = mats[i] * points[i], with w = 1.
+void TransformPoints(const SoAMatrixArray& mats, const SoAVec3Array& points, SoAVec3Array& out);
+
+// out[i] = CreateSRT( scales[i], rotations[i], positions[i] ), rotations in degrees.
+void CreateSRTs(const SoAVec3Array& scales, const SoAVec3Array& rotations, const SoAVec3Array& positions, SoAMatrixArray& out);
+
+} // namespace fw
@@ -18,57 +18,57 @@ namespace fw
 class vec2
 {
 public:
-    vec2() {}
-    vec2(float nxy) { x = nxy; y = nxy; }
-    vec2(float nx, float ny) { x = nx; y = ny; }
+    constexpr vec2() {}
+    constexpr vec2(float nxy) { x = nxy; y = nxy; }
+    constexpr vec2(float nx, float ny) { x = nx; y = ny; }
     //virtual ~vec2() {}
 
-    static const vec2 Right() { return vec2(1.0f, 0.0f); }
-    static const vec2 Up() { return vec2(0.0f, 1.0f); }
-    static const vec2 Zero() { return vec2(0.0f, 0.0f); }
-    static const vec2 One() { return vec2(1.0f, 1.0f); }
+    static constexpr vec2 Right() { return vec2(1.0f, 0.0f); }
+    static constexpr vec2 Up() { return vec2(0.0f, 1.0f); }
+    static constexpr vec2 Zero() { return vec2(0.0f, 0.0f); }
+    static constexpr vec2 One() { return vec2(1.0f, 1.0f); }
 
-    inline void Set(float nx, float ny) { x = nx; y = ny; }
-    inline float LengthSquared() const { return x * x + y * y; }
+    constexpr void Set(float nx, float ny) { x = nx; y = ny; }
+    constexpr float LengthSquared() const { return x * x + y * y; }
     inline float Length() const { return sqrtf(x * x + y * y); }
     inline float DistanceFrom(const vec2 o) const { return sqrtf((x - o.x) * (x - o.x) + (y - o.y) * (y - o.y)); }
 
     inline vec2 GetNormalized() const { float len = Length(); if(fequal(len, 0)) return vec2(x, y); len = 1.0f / len; return vec2(x * len, y * len); }
     inline vec2 Normalize() { float len = Length(); if(!fequal(len, 0)) { x /= len; y /= len; } return *this; }
-    inline void Absolute() { if(x < 0) x *= -1; if(y < 0) y *= -1; }
-    inline vec2 GetAbsolute() const { return vec2(x < 0 ? -x : x, y < 0 ? -y : y); }
-    inline float Dot(const vec2& o) const { return x * o.x + y * o.y; }
-    inline vec2 Add(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
-    inline vec2 Sub(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
-    inline vec2 Scale(const float o) const { return vec2(this->x * o, this->y * o); }
-
-    inline vec2 WithX(float x) const { return vec2(x, this->y); }
-    inline vec2 WithY(float y) const { return vec2(this->x, y); }
-
-    inline bool operator ==(const vec2& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y); }
-    inline bool operator !=(const vec2& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y); }
-
-    inline vec2 operator -() const { return vec2(-this->x, -this->y); }
-    inline vec2 operator *(const float o) const { return vec2(this->x * o, this->y * o); }
-    inline vec2 operator /(const float o) const { return vec2(this->x / o, this->y / o); }
-    inline vec2 operator +(const float o) const { return vec2(this->x + o, this->y + o); }
-    inline vec2 operator -(const float o) const { return vec2(this->x - o, this->y - o); }
-    inline vec2 operator *(const vec2& o) const { return vec2(this->x * o.x, this->y * o.y); }
-    inline vec2 operator /(const vec2& o) const { return vec2(this->x / o.x, this->y / o.y); }
-    inline vec2 operator +(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
-    inline vec2 operator -(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
-
-    inline vec2 operator *=(const float o) { this->x *= o; this->y *= o; return *this; }
-    inline vec2 operator /=(const float o) { this->x /= o; this->y /= o; return *this; }
-    inline vec2 operator +=(const float o) { this->x += o; this->y += o; return *this; }
-    inline vec2 operator -=(const float o) { this->x -= o; this->y -= o; return *this; }
-    inline vec2 operator *=(const vec2& o) { this->x *= o.x; this->y *= o.y; return *this; }
-    inline vec2 operator /=(const vec2& o) { this->x /= o.x; this->y /= o.y; return *this; }
-    inline vec2 operator +=(const vec2& o) { this->x += o.x; this->y += o.y; return *this; }
-    inline vec2 operator -=(const vec2& o) { this->x -= o.x; this->y -= o.y; return *this; }
-
-    bool vec2::operator<(const vec2& aVector2) const { return (x == aVector2.x) ? (y < aVector2.y) : (x < aVector2.x); }
-    bool vec2::operator>(const vec2& aVector2) const { return (x == aVector2.x) ? (y > aVector2.y) : (x > aVector2.x); }
+    constexpr void Absolute() { if(x < 0) x *= -1; if(y < 0) y *= -1; }
+    constexpr vec2 GetAbsolute() const { return vec2(x < 0 ? -x : x, y < 0 ? -y : y); }
+    constexpr float Dot(const vec2& o) const { return x * o.x + y * o.y; }
+    constexpr vec2 Add(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
+    constexpr vec2 Sub(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
+    constexpr vec2 Scale(const float o) const { return vec2(this->x * o, this->y * o); }
+
+    constexpr vec2 WithX(float x) const { return vec2(x, this->y); }
+    constexpr vec2 WithY(float y) const { return vec2(this->x, y); }
+
+    constexpr bool operator ==(const vec2& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y); }
+    constexpr bool operator !=(const vec2& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y); }
+
+    constexpr vec2 operator -() const { return vec2(-this->x, -this->y); }
+    constexpr vec2 operator *(const float o) const { return vec2(this->x * o, this->y * o); }
+    constexpr vec2 operator /(const float o) const { return vec2(this->x / o, this->y / o); }
+    constexpr vec2 operator +(const float o) const { return vec2(this->x + o, this->y + o); }
+    constexpr vec2 operator -(const float o) const { return vec2(this->x - o, this->y - o); }
+    constexpr vec2 operator *(const vec2& o) const { return vec2(this->x * o.x, this->y * o.y); }
+    constexpr vec2 operator /(const vec2& o) const { return vec2(this->x / o.x, this->y / o.y); }
+    constexpr vec2 operator +(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
+    constexpr vec2 operator -(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
+
+    constexpr vec2 operator *=(const float o) { this->x *= o; this->y *= o; return *this; }
+    constexpr vec2 operator /=(const float o) { this->x /= o; this->y /= o; return *this; }
+    constexpr vec2 operator +=(const float o) { this->x += o; this->y += o; return *this; }
+    constexpr vec2 operator -=(const float o) { this->x -= o; this->y -= o; return *this; }
+    constexpr vec2 operator *=(const vec2& o) { this->x *= o.x; this->y *= o.y; return *this; }
+    constexpr vec2 operator /=(const vec2& o) { this->x /= o.x; this->y /= o.y; return *this; }
+    constexpr vec2 operator +=(const vec2& o) { this->x += o.x; this->y += o.y; return *this; }
+    constexpr vec2 operator -=(const vec2& o) { this->x -= o.x; this->y -= o.y; return *this; }
+
+    bool operator<(const vec2& aVector2) const { return (x == aVector2.x) ? (y < aVector2.y) : (x < aVector2.x); }
+    bool operator>(const vec2& aVector2) const { return (x == aVector2.x) ? (y > aVector2.y) : (x > aVector2.x); }
 
     float& operator[] (int i) { assert(i >= 0 && i < 2); return *(&x + i); }
 
@@ -79,87 +79,87 @@ public:
     float y = 0;
 };
 
-inline vec2 operator *(float scalar, const vec2& vec) { return vec2(scalar * vec.x, scalar * vec.y); }
-inline vec2 operator /(float scalar, const vec2& vec) { return vec2(scalar / vec.x, scalar / vec.y); }
-inline vec2 operator +(float scalar, const vec2& vec) { return vec2(scalar + vec.x, scalar + vec.y); }
-inline vec2 operator -(float scalar, const vec2& vec) { return vec2(scalar - vec.x, scalar - vec.y); }
+constexpr vec2 operator *(float scalar, const vec2& vec) { return vec2(scalar * vec.x, scalar * vec.y); }
+constexpr vec2 operator /(float scalar, const vec2& vec) { return vec2(scalar / vec.x, scalar / vec.y); }
+constexpr vec2 operator +(float scalar, const vec2& vec) { return vec2(scalar + vec.x, scalar + vec.y); }
+constexpr vec2 operator -(float scalar, const vec2& vec) { return vec2(scalar - vec.x, scalar - vec.y); }
 
 class vec3
 {
 public:
-    vec3() {}
-    vec3(float nxyz) { x = nxyz; y = nxyz; z = nxyz; }
-    vec3(float nx, float ny) { x = nx; y = ny; z = 0; }
-    vec3(float nx, float ny, float nz) { x = nx; y = ny; z = nz; }
-    vec3(vec2 v2) { x = v2.x; y = v2.y; z = 0; }
-    vec3(vec2 v2, float nz) { x = v2.x; y = v2.y; z = nz; }
-    vec3(float nx, vec2 v2) { x = nx; y = v2.x; z = v2.y; }
-
-    vec3(int nxyz) { x = (float)nxyz; y = (float)nxyz; z = (float)nxyz; }
-    vec3(int nx, int ny) { x = (float)nx; y = (float)ny; z = 0; }
-    vec3(int nx, int ny, int nz) { x = (float)nx; y = (float)ny; z = (float)nz; }
+    constexpr vec3() {}
+    constexpr vec3(float nxyz) { x = nxyz; y = nxyz; z = nxyz; }
+    constexpr vec3(float nx, float ny) { x = nx; y = ny; z = 0; }
+    constexpr vec3(float nx, float ny, float nz) { x = nx; y = ny; z = nz; }
+    constexpr vec3(vec2 v2) { x = v2.x; y = v2.y; z = 0; }
+    constexpr vec3(vec2 v2, float nz) { x = v2.x; y = v2.y; z = nz; }
+    constexpr vec3(float nx, vec2 v2) { x = nx; y = v2.x; z = v2.y; }
+
+    constexpr vec3(int nxyz) { x = (float)nxyz; y = (float)nxyz; z = (float)nxyz; }
+    constexpr vec3(int nx, int ny) { x = (float)nx; y = (float)ny; z = 0; }
+    constexpr vec3(int nx, int ny, int nz) { x = (float)nx; y = (float)ny; z = (float)nz; }
     //vec3(ivec2 v2) { x = v2.x; y = v2.y; z = 0; }
     //vec3(ivec2 v2, int nz) { x = v2.x; y = v2.y; z = (float)nz; }
     //vec3(int nx, ivec2 v2) { x = (float)nx; y = v2.x; z = v2.y; }
 
-    vec3(float nx, int ny) { x = nx; y = (float)ny; z = 0; }
-    vec3(int nx, float ny) { x = (float)nx; y = ny; z = 0; }
-    vec3(float nx, int ny, int nz) { x = nx; y = (float)ny; z = (float)nz; }
-    vec3(int nx, float ny, int nz) { x = (float)nx; y = ny; z = (float)nz; }
-    vec3(int nx, int ny, float nz) { x = (float)nx; y = (float)ny; z = nz; }
-    vec3(float nx, float ny, int nz) { x = nx; y = ny; z = (float)nz; }
-    vec3(float nx, int ny, float nz) { x = nx; y = (float)ny; z = nz; }
+    constexpr vec3(float nx, int ny) { x = nx; y = (float)ny; z = 0; }
+    constexpr vec3(int nx, float ny) { x = (float)nx; y = ny; z = 0; }
+    constexpr vec3(float nx, int ny, int nz) { x = nx; y = (float)ny; z = (float)nz; }
+    constexpr vec3(int nx, float ny, int nz) { x = (float)nx; y = ny; z = (float)nz; }
+    constexpr vec3(int nx, int ny, float nz) { x = (float)nx; y = (float)ny; z = nz; }
+    constexpr vec3(float nx, float ny, int nz) { x = nx; y = ny; z = (float)nz; }
+    constexpr vec3(float nx, int ny, float nz) { x = nx; y = (float)ny; z = nz; }
     //virtual ~vec3() {}
 
-    static const vec3 Right() { return vec3(1.0f, 0.0f, 0.0f); }
-    static const vec3 Up() { return vec3(0.0f, 1.0f, 0.0f); }
-    static const vec3 In() { return vec3(0.0f, 0.0f, 1.0f); }
-    static const vec3 Zero() { return vec3(0.0f, 0.0f, 0.0f); }
+    static constexpr vec3 Right() { return vec3(1.0f, 0.0f, 0.0f); }
+    static constexpr vec3 Up() { return vec3(0.0f, 1.0f, 0.0f); }
+    static constexpr vec3 In() { return vec3(0.0f, 0.0f, 1.0f); }
+    static constexpr vec3 Zero() { return vec3(0.0f, 0.0f, 0.0f); }
 
-    inline vec2 XY() const { return vec2(x, y); }
-    inline vec2 XZ() const { return vec2(x, z); }
+    constexpr vec2 XY() const { return vec2(x, y); }
+    constexpr vec2 XZ() const { return vec2(x, z); }
 
-    inline void Set(float nx, float ny, float nz) { x = nx; y = ny; z = nz; }
-    inline float LengthSquared() const { return x * x + y * y + z * z; }
+    constexpr void Set(float nx, float ny, float nz) { x = nx; y = ny; z = nz; }
+    constexpr float LengthSquared() const { return x * x + y * y + z * z; }
     inline float Length() const { return sqrtf(x * x + y * y + z * z); }
     inline float DistanceFrom(const vec3 o) const { return sqrtf((x - o.x) * (x - o.x) + (y - o.y) * (y - o.y) + (z - o.z) * (z - o.z)); }
 
     inline vec3 GetNormalized() const { float len = Length(); if(fequal(len, 0)) return vec3(x, y, z); len = 1.0f / len; return vec3(x * len, y * len, z * len); }
     inline vec3 Normalize() { float len = Length(); if(!fequal(len, 0)) { x /= len; y /= len; z /= len; } return *this; }
-    inline vec3 Cross(const vec3& o) const { return vec3((y * o.z - z * o.y), (z * o.x - x * o.z), (x * o.y - y * o.x)); }
-    inline float Dot(const vec3& o) const { return x * o.x + y * o.y + z * o.z; }
-    inline vec3 Add(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
-    inline vec3 Sub(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
-    inline vec3 Scale(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
-    inline vec3 MultiplyComponents(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-    inline vec3 DivideComponents(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
+    constexpr vec3 Cross(const vec3& o) const { return vec3((y * o.z - z * o.y), (z * o.x - x * o.z), (x * o.y - y * o.x)); }
+    constexpr float Dot(const vec3& o) const { return x * o.x + y * o.y + z * o.z; }
+    constexpr vec3 Add(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
+    constexpr vec3 Sub(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
+    constexpr vec3 Scale(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
+    constexpr vec3 MultiplyComponents(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+    constexpr vec3 DivideComponents(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
     //inline vec3 MultiplyComponents(const ivec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
 
-    inline vec3 WithX(float x) const { return vec3(x, this->y, this->z); }
-    inline vec3 WithY(float y) const { return vec3(this->x, y, this->z); }
-    inline vec3 WithZ(float z) const { return vec3(this->x, this->y, z); }
-
-    inline bool operator ==(const vec3& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y) && fequal(this->z, o.z); }
-    inline bool operator !=(const vec3& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y) || !fequal(this->z, o.z); }
-
-    inline vec3 operator -() const { return vec3(-this->x, -this->y, -this->z); }
-    inline vec3 operator *(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
-    inline vec3 operator /(const float o) const { return vec3(this->x / o, this->y / o, this->z / o); }
-    inline vec3 operator +(const float o) const { return vec3(this->x + o, this->y + o, this->z + o); }
-    inline vec3 operator -(const float o) const { return vec3(this->x - o, this->y - o, this->z - o); }
-    inline vec3 operator *(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-    inline vec3 operator /(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
-    inline vec3 operator +(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
-    inline vec3 operator -(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
-
-    inline vec3 operator *=(const float o) { this->x *= o; this->y *= o; this->z *= o; return *this; }
-    inline vec3 operator /=(const float o) { this->x /= o; this->y /= o; this->z /= o; return *this; }
-    inline vec3 operator +=(const float o) { this->x += o; this->y += o; this->z += o; return *this; }
-    inline vec3 operator -=(const float o) { this->x -= o; this->y -= o; this->z -= o; return *this; }
-    inline vec3 operator *=(const vec3& o) { this->x *= o.x; this->y *= o.y; this->z *= o.z; return *this; }
-    inline vec3 operator /=(const vec3& o) { this->x /= o.x; this->y /= o.y; this->z /= o.z; return *this; }
-    inline vec3 operator +=(const vec3& o) { this->x += o.x; this->y += o.y; this->z += o.z; return *this; }
-    inline vec3 operator -=(const vec3& o) { this->x -= o.x; this->y -= o.y; this->z -= o.z; return *this; }
+    constexpr vec3 WithX(float x) const { return vec3(x, this->y, this->z); }
+    constexpr vec3 WithY(float y) const { return vec3(this->x, y, this->z); }
+    constexpr vec3 WithZ(float z) const { return vec3(this->x, this->y, z); }
+
+    constexpr bool operator ==(const vec3& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y) && fequal(this->z, o.z); }
+    constexpr bool operator !=(const vec3& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y) || !fequal(this->z, o.z); }
+
+    constexpr vec3 operator -() const { return vec3(-this->x, -this->y, -this->z); }
+    constexpr vec3 operator *(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
+    constexpr vec3 operator /(const float o) const { return vec3(this->x / o, this->y / o, this->z / o); }
+    constexpr vec3 operator +(const float o) const { return vec3(this->x + o, this->y + o, this->z + o); }
+    constexpr vec3 operator -(const float o) const { return vec3(this->x - o, this->y - o, this->z - o); }
+    constexpr vec3 operator *(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+    constexpr vec3 operator /(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
+    constexpr vec3 operator +(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
+    constexpr vec3 operator -(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
+
+    constexpr vec3 operator *=(const float o) { this->x *= o; this->y *= o; this->z *= o; return *this; }
+    constexpr vec3 operator /=(const float o) { this->x /= o; this->y /= o; this->z /= o; return *this; }
+    constexpr vec3 operator +=(const float o) { this->x += o; this->y += o; this->z += o; return *this; }
+    constexpr vec3 operator -=(const float o) { this->x -= o; this->y -= o; this->z -= o; return *this; }
+    constexpr vec3 operator *=(const vec3& o) { this->x *= o.x; this->y *= o.y; this->z *= o.z; return *this; }
+    constexpr vec3 operator /=(const vec3& o) { this->x /= o.x; this->y /= o.y; this->z /= o.z; return *this; }
+    constexpr vec3 operator +=(const vec3& o) { this->x += o.x; this->y += o.y; this->z += o.z; return *this; }
+    constexpr vec3 operator -=(const vec3& o) { this->x -= o.x; this->y -= o.y; this->z -= o.z; return *this; }
 
     float& operator[] (int i) { assert(i >= 0 && i < 3); return *(&x + i); }
 
@@ -171,30 +171,30 @@ public:
     float z = 0;
 };
 
-inline vec3 operator *(float scalar, const vec3& vec) { return vec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
-inline vec3 operator /(float scalar, const vec3& vec) { return vec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
-inline vec3 operator +(float scalar, const vec3& vec) { return vec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
-inline vec3 operator -(float scalar, const vec3& vec) { return vec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
+constexpr vec3 operator *(float scalar, const vec3& vec) { return vec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
+constexpr vec3 operator /(float scalar, const vec3& vec) { return vec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
+constexpr vec3 operator +(float scalar, const vec3& vec) { return vec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
+constexpr vec3 operator -(float scalar, const vec3& vec) { return vec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
 
 class vec4
 {
 public:
-    vec4() {}
-    vec4(float nxyzw) { x = nxyzw; y = nxyzw; z = nxyzw; w = nxyzw; }
-    vec4(float nx, float ny) { x = nx; y = ny; z = 0; w = 0; }
-    vec4(float nx, float ny, float nz) { x = nx; y = ny; z = nz; w = 0; }
-    vec4(float nx, float ny, float nz, float nw) { x = nx; y = ny; z = nz; w = nw; }
-    vec4(vec2 vec, float nz, float nw) { x = vec.x; y = vec.y; z = nz; w = nw; }
-    vec4(float nx, float ny, vec2 vec) { x = nx; y = ny; z = vec.x; w = vec.y; }
-    vec4(float nx, vec2 vec, float nw) { x = nx; y = vec.x; z = vec.y; w = nw; }
-    vec4(vec2 vec_1, vec2 vec_2) { x = vec_1.x; y = vec_1.y; z = vec_2.x; w = vec_2.y; }
-    vec4(vec3 vec, float nw) { x = vec.x; y = vec.y; z = vec.z; w = nw; }
-    vec4(float nx, vec3 vec) { x = nx; y = vec.x; z = vec.y; w = vec.z; }
-
-    vec4(int nxyzw) { x = (float)nxyzw; y = (float)nxyzw; z = (float)nxyzw; w = (float)nxyzw; }
-    vec4(int nx, int ny) { x = (float)nx; y = (float)ny; z = 0; w = 0; }
-    vec4(int nx, int ny, int nz) { x = (float)nx; y = (float)ny; z = (float)nz; w = 0; }
-    vec4(int nx, int ny, int nz, int nw) { x = (float)nx; y = (float)ny; z = (float)nz; w = (float)nw; }
+    constexpr vec4() {}
+    constexpr vec4(float nxyzw) { x = nxyzw; y = nxyzw; z = nxyzw; w = nxyzw; }
+    constexpr vec4(float nx, float ny) { x = nx; y = ny; z = 0; w = 0; }
+    constexpr vec4(float nx, float ny, float nz) { x = nx; y = ny; z = nz; w = 0; }
+    constexpr vec4(float nx, float ny, float nz, float nw) { x = nx; y = ny; z = nz; w = nw; }
+    constexpr vec4(vec2 vec, float nz, float nw) { x = vec.x; y = vec.y; z = nz; w = nw; }
+    constexpr vec4(float nx, float ny, vec2 vec) { x = nx; y = ny; z = vec.x; w = vec.y; }
+    constexpr vec4(float nx, vec2 vec, float nw) { x = nx; y = vec.x; z = vec.y; w = nw; }
+    constexpr vec4(vec2 vec_1, vec2 vec_2) { x = vec_1.x; y = vec_1.y; z = vec_2.x; w = vec_2.y; }
+    constexpr vec4(vec3 vec, float nw) { x = vec.x; y = vec.y; z = vec.z; w = nw; }
+    constexpr vec4(float nx, vec3 vec) { x = nx; y = vec.x; z = vec.y; w = vec.z; }
+
+    constexpr vec4(int nxyzw) { x = (float)nxyzw; y = (float)nxyzw; z = (float)nxyzw; w = (float)nxyzw; }
+    constexpr vec4(int nx, int ny) { x = (float)nx; y = (float)ny; z = 0; w = 0; }
+    constexpr vec4(int nx, int ny, int nz) { x = (float)nx; y = (float)ny; z = (float)nz; w = 0; }
+    constexpr vec4(int nx, int ny, int nz, int nw) { x = (float)nx; y = (float)ny; z = (float)nz; w = (float)nw; }
     //vec4(ivec2 vec, int nz, int nw) { x = vec.x; y = vec.y; z = (float)nz; w = (float)nw; }
     //vec4(int nx, int ny, ivec2 vec) { x = (float)nx; y = (float)ny; z = vec.x; w = vec.y; }
     //vec4(int nx, ivec2 vec, int nw) { x = (float)nx; y = vec.x; z = vec.y; w = (float)nw; }
@@ -202,27 +202,27 @@ public:
     //vec4(ivec3 vec, int nw) { x = vec.x; y = vec.y; z = vec.z; w = (float)nw; }
     //vec4(int nx, ivec3 vec) { x = (float)nx; y = vec.x; z = vec.y; w = vec.z; }
 
-    vec4(float nx, int ny) { x = nx; y = (float)ny; z = 0; w = 0; }
-    vec4(int nx, float ny) { x = (float)nx; y = ny; z = 0; w = 0; }
-    vec4(float nx, int ny, int nz) { x = nx; y = (float)ny; z = (float)nz; w = 0; }
-    vec4(int nx, float ny, int nz) { x = (float)nx; y = ny; z = (float)nz; w = 0; }
-    vec4(int nx, int ny, float nz) { x = (float)nx; y = (float)ny; z = nz; w = 0; }
-    vec4(float nx, float ny, int nz) { x = nx; y = ny; z = (float)nz; w = 0; }
-    vec4(float nx, int ny, float nz) { x = nx; y = (float)ny; z = nz; w = 0; }
-    vec4(float nx, int ny, int nz, int nw) { x = nx; y = (float)ny; z = (float)nz; w = (float)nw; }
-    vec4(int nx, float ny, int nz, int nw) { x = (float)nx; y = ny; z = (float)nz; w = (float)nw; }
-    vec4(int nx, int ny, float nz, int nw) { x = (float)nx; y = (float)ny; z = nz; w = (float)nw; }
-    vec4(int nx, int ny, int nz, float nw) { x = (float)nx; y = (float)ny; z = (float)nz; w = nw; }
-    vec4(float nx, float ny, int nz, int nw) { x = nx; y = ny; z = (float)nz; w = (float)nw; }
-    vec4(float nx, int ny, float nz, int nw) { x = nx; y = (float)ny; z = nz; w = (float)nw; }
-    vec4(float nx, int ny, int nz, float nw) { x = nx; y = (float)ny; z = (float)nz; w = nw; }
-    vec4(int nx, float ny, float nz, int nw) { x = (float)nx; y = ny; z = nz; w = (float)nw; }
-    vec4(int nx, float ny, int nz, float nw) { x = (float)nx; y = ny; z = (float)nz; w = nw; }
-    vec4(int nx, int ny, float nz, float nw) { x = (float)nx; y = (float)ny; z = nz; w = nw; }
-    vec4(float nx, float ny, float nz, int nw) { x = nx; y = ny; z = nz; w = (float)nw; }
-    vec4(float nx, float ny, int nz, float nw) { x = nx; y = ny; z = (float)nz; w = nw; }
-    vec4(float nx, int ny, float nz, float nw) { x = nx; y = (float)ny; z = nz; w = nw; }
-    vec4(int nx, float ny, float nz, float nw) { x = (float)nx; y = ny; z = nz; w = nw; }
+    constexpr vec4(float nx, int ny) { x = nx; y = (float)ny; z = 0; w = 0; }
+    constexpr vec4(int nx, float ny) { x = (float)nx; y = ny; z = 0; w = 0; }
+    constexpr vec4(float nx, int ny, int nz) { x = nx; y = (float)ny; z = (float)nz; w = 0; }
+    constexpr vec4(int nx, float ny, int nz) { x = (float)nx; y = ny; z = (float)nz; w = 0; }
+    constexpr vec4(int nx, int ny, float nz) { x = (float)nx; y = (float)ny; z = nz; w = 0; }
+    constexpr vec4(float nx, float ny, int nz) { x = nx; y = ny; z = (float)nz; w = 0; }
+    constexpr vec4(float nx, int ny, float nz) { x = nx; y = (float)ny; z = nz; w = 0; }
+    constexpr vec4(float nx, int ny, int nz, int nw) { x = nx; y = (float)ny; z = (float)nz; w = (float)nw; }
+    constexpr vec4(int nx, float ny, int nz, int nw) { x = (float)nx; y = ny; z = (float)nz; w = (float)nw; }
+    constexpr vec4(int nx, int ny, float nz, int nw) { x = (float)nx; y = (float)ny; z = nz; w = (float)nw; }
+    constexpr vec4(int nx, int ny, int nz, float nw) { x = (float)nx; y = (float)ny; z = (float)nz; w = nw; }
+    constexpr vec4(float nx, float ny, int nz, int nw) { x = nx; y = ny; z = (float)nz; w = (float)nw; }
+    constexpr vec4(float nx, int ny, float nz, int nw) { x = nx; y = (float)ny; z = nz; w = (float)nw; }
+    constexpr vec4(float nx, int ny, int nz, float nw) { x = nx; y = (float)ny; z = (float)nz; w = nw; }
+    constexpr vec4(int nx, float ny, float nz, int nw) { x = (float)nx; y = ny; z = nz; w = (float)nw; }
+    constexpr vec4(int nx, float ny, int nz, float nw) { x = (float)nx; y = ny; z = (float)nz; w = nw; }
+    constexpr vec4(int nx, int ny, float nz, float nw) { x = (float)nx; y = (float)ny; z = nz; w = nw; }
+    constexpr vec4(float nx, float ny, float nz, int nw) { x = nx; y = ny; z = nz; w = (float)nw; }
+    constexpr vec4(float nx, float ny, int nz, float nw) { x = nx; y = ny; z = (float)nz; w = nw; }
+    constexpr vec4(float nx, int ny, float nz, float nw) { x = nx; y = (float)ny; z = nz; w = nw; }
+    constexpr vec4(int nx, float ny, float nz, float nw) { x = (float)nx; y = ny; z = nz; w = nw; }
     //vec4(ivec2 vec, float nz, int nw) { x = vec.x; y = vec.y; z = nz; w = (float)nw; }
     //vec4(ivec2 vec, int nz, float nw) { x = vec.x; y = vec.y; z = (float)nz; w = nw; }
     //vec4(float nx, int ny, ivec2 vec) { x = nx; y = (float)ny; z = vec.x; w = vec.y; }
@@ -231,10 +231,10 @@ public:
     //vec4(int nx, ivec2 vec, float nw) { x = (float)nx; y = vec.x; z = vec.y; w = nw; }
     //virtual ~vec4() {}
 
-    inline vec3 XYZ() { return vec3(x, y, z); }
+    constexpr vec3 XYZ() { return vec3(x, y, z); }
 
-    inline void Set(float nx, float ny, float nz, float nw) { x = nx; y = ny; z = nz; w = nw; }
-    inline float LengthSquared() const { return x * x + y * y + z * z + w * w; }
+    constexpr void Set(float nx, float ny, float nz, float nw) { x = nx; y = ny; z = nz; w = nw; }
+    constexpr float LengthSquared() const { return x * x + y * y + z * z + w * w; }
     inline float Length() const { return sqrtf(x * x + y * y + z * z + w * w); }
     inline float DistanceFrom(const vec4 o) const { return sqrtf((x - o.x) * (x - o.x) + (y - o.y) * (y - o.y) + (z - o.z) * (z - o.z) + (w - o.w) * (w - o.w)); }
 
@@ -258,31 +258,31 @@ public:
     //        y*Pxz - x*Pyz - z*Pxy
     //        );
     //}
-    inline float Dot(const vec4& o) const { return x * o.x + y * o.y + z * o.z + w * o.w; }
-    inline vec4 Add(const vec4& o) const { return vec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
-    inline vec4 Sub(const vec4& o) const { return vec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
-    inline vec4 Scale(const float o) const { return vec4(this->x * o, this->y * o, this->z * o, this->w * o); }
-    inline vec4 MultiplyComponents(const vec4& o) const { return vec4(this->x * o.x, this->y * o.y, this->z * o.z, this->w * o.w); }
-    inline vec4 DivideComponents(const vec4& o) const { return vec4(this->x / o.x, this->y / o.y, this->z / o.z, this->w / o.w); }
+    constexpr float Dot(const vec4& o) const { return x * o.x + y * o.y + z * o.z + w * o.w; }
+    constexpr vec4 Add(const vec4& o) const { return vec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
+    constexpr vec4 Sub(const vec4& o) const { return vec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
+    constexpr vec4 Scale(const float o) const { return vec4(this->x * o, this->y * o, this->z * o, this->w * o); }
+    constexpr vec4 MultiplyComponents(const vec4& o) const { return vec4(this->x * o.x, this->y * o.y, this->z * o.z, this->w * o.w); }
+    constexpr vec4 DivideComponents(const vec4& o) const { return vec4(this->x / o.x, this->y / o.y, this->z / o.z, this->w / o.w); }
     //inline vec4 MultiplyComponents(const ivec4& o) const { return vec4(this->x * o.x, this->y * o.y, this->z * o.z, this->w * o.w); }
 
-    inline vec4 WithX(float x) const { return vec4(x, this->y, this->z, this->w); }
-    inline vec4 WithY(float y) const { return vec4(this->x, y, this->z, this->w); }
-    inline vec4 WithZ(float z) const { return vec4(this->x, this->y, z, this->w); }
-    inline vec4 WithW(float w) const { return vec4(this->x, this->y, this->z, w); }
+    constexpr vec4 WithX(float x) const { return vec4(x, this->y, this->z, this->w); }
+    constexpr vec4 WithY(float y) const { return vec4(this->x, y, this->z, this->w); }
+    constexpr vec4 WithZ(float z) const { return vec4(this->x, this->y, z, this->w); }
+    constexpr vec4 WithW(float w) const { return vec4(this->x, this->y, this->z, w); }
 
-    inline bool operator ==(const vec4& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y) && fequal(this->z, o.z) && fequal(this->w, o.w); }
-    inline bool operator !=(const vec4& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y) || !fequal(this->z, o.z) || !fequal(this->w, o.w); }
+    constexpr bool operator ==(const vec4& o) const { return fequal(this->x, o.x) && fequal(this->y, o.y) && fequal(this->z, o.z) && fequal(this->w, o.w); }
+    constexpr bool operator !=(const vec4& o) const { return !fequal(this->x, o.x) || !fequal(this->y, o.y) || !fequal(this->z, o.z) || !fequal(this->w, o.w); }
 
-    inline vec4 operator -() const { return vec4(-this->x, -this->y, -this->z, -this->w); }
-    inline vec4 operator *(const float o) const { return vec4(this->x * o, this->y * o, this->z * o, this->w * o); }
-    inline vec4 operator /(const float o) const { return vec4(this->x / o, this->y / o, this->z / o, this->w / o); }
-    inline vec4 operator +(const float o) const { return vec4(this->x + o, this->y + o, this->z + o, this->w + o); }
-    inline vec4 operator -(const float o) const { return vec4(this->x - o, this->y - o, this->z - o, this->w - o); }
-    inline vec4 operator *(const vec4& o) const { return vec4(this->x * o.x, this->y * o.y, this->z * o.z, this->w * o.w); }
-    inline vec4 operator /(const vec4& o) const { return vec4(this->x / o.x, this->y / o.y, this->z / o.z, this->w / o.w); }
-    inline vec4 operator +(const vec4& o) const { return vec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
-    inline vec4 operator -(const vec4& o) const { return vec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
+    constexpr vec4 operator -() const { return vec4(-this->x, -this->y, -this->z, -this->w); }
+    constexpr vec4 operator *(const float o) const { return vec4(this->x * o, this->y * o, this->z * o, this->w * o); }
+    constexpr vec4 operator /(const float o) const { return vec4(this->x / o, this->y / o, this->z / o, this->w / o); }
+    constexpr vec4 operator +(const float o) const { return vec4(this->x + o, this->y + o, this->z + o, this->w + o); }
+    constexpr vec4 operator -(const float o) const { return vec4(this->x - o, this->y - o, this->z - o, this->w - o); }
+    constexpr vec4 operator *(const vec4& o) const { return vec4(this->x * o.x, this->y * o.y, this->z * o.z, this->w * o.w); }
+    constexpr vec4 operator /(const vec4& o) const { return vec4(this->x / o.x, this->y / o.y, this->z / o.z, this->w / o.w); }
+    constexpr vec4 operator +(const vec4& o) const { return vec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
+    constexpr vec4 operator -(const vec4& o) const { return vec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
 
     float& operator[] (int i) { assert(i >= 0 && i < 4); return *(&x + i); }
 
@@ -293,58 +293,58 @@ public:
     float w = 0;
 };
 
-inline vec4 operator *(float scalar, const vec4& vec) { return vec4(scalar * vec.x, scalar * vec.y, scalar * vec.z, scalar * vec.w); }
-inline vec4 operator /(float scalar, const vec4& vec) { return vec4(scalar / vec.x, scalar / vec.y, scalar / vec.z, scalar / vec.w); }
-inline vec4 operator +(float scalar, const vec4& vec) { return vec4(scalar + vec.x, scalar + vec.y, scalar + vec.z, scalar + vec.w); }
-inline vec4 operator -(float scalar, const vec4& vec) { return vec4(scalar - vec.x, scalar - vec.y, scalar - vec.z, scalar - vec.w); }
+constexpr vec4 operator *(float scalar, const vec4& vec) { return vec4(scalar * vec.x, scalar * vec.y, scalar * vec.z, scalar * vec.w); }
+constexpr vec4 operator /(float scalar, const vec4& vec) { return vec4(scalar / vec.x, scalar / vec.y, scalar / vec.z, scalar / vec.w); }
+constexpr vec4 operator +(float scalar, const vec4& vec) { return vec4(scalar + vec.x, scalar + vec.y, scalar + vec.z, scalar + vec.w); }
+constexpr vec4 operator -(float scalar, const vec4& vec) { return vec4(scalar - vec.x, scalar - vec.y, scalar - vec.z, scalar - vec.w); }
 
 class ivec2
 {
 public:
-    ivec2() {}
-    ivec2(int nx, int ny) { x = nx; y = ny; }
-    ivec2(vec2 o) { x = (int)o.x; y = (int)o.y; }
+    constexpr ivec2() {}
+    constexpr ivec2(int nx, int ny) { x = nx; y = ny; }
+    constexpr ivec2(vec2 o) { x = (int)o.x; y = (int)o.y; }
     //virtual ~ivec2() {}
 
-    inline void Set(int nx, int ny) { x = nx; y = ny; }
-    inline float LengthSquared() const { return (float)x * x + y * y; }
+    constexpr void Set(int nx, int ny) { x = nx; y = ny; }
+    constexpr float LengthSquared() const { return (float)x * x + y * y; }
     inline float Length() const { return sqrtf((float)x * x + y * y); }
     inline float DistanceFrom(const ivec2 o) const { return sqrtf(((float)x - o.x) * (x - o.x) + (y - o.y) * (y - o.y)); }
 
     //inline ivec2 Normalize() const { float len = Length(); if( fequal(len,0) ) return ivec2(x,y); len = 1.0f/len; return ivec2(x*len, y*len); }
 
-    inline ivec2 WithX(int x) const { return ivec2(x, this->y); }
-    inline ivec2 WithY(int y) const { return ivec2(this->x, y); }
-
-    inline bool operator ==(const ivec2& o) const { return this->x == o.x && this->y == o.y; }
-    inline bool operator !=(const ivec2& o) const { return this->x != o.x || this->y != o.y; }
-
-    inline ivec2 operator -() const { return ivec2(-this->x, -this->y); }
-    inline vec2 operator *(const float o) const { return vec2(this->x * o, this->y * o); }
-    inline vec2 operator /(const float o) const { return vec2(this->x / o, this->y / o); }
-    inline vec2 operator +(const float o) const { return vec2(this->x + o, this->y + o); }
-    inline vec2 operator -(const float o) const { return vec2(this->x - o, this->y - o); }
-    inline ivec2 operator *(const int o) const { return ivec2(this->x * o, this->y * o); }
-    inline ivec2 operator /(const int o) const { return ivec2(this->x / o, this->y / o); }
-    inline ivec2 operator +(const int o) const { return ivec2(this->x + o, this->y + o); }
-    inline ivec2 operator -(const int o) const { return ivec2(this->x - o, this->y - o); }
-    inline vec2 operator *(const vec2& o) const { return vec2(this->x * o.x, this->y * o.y); }
-    inline vec2 operator /(const vec2& o) const { return vec2(this->x / o.x, this->y / o.y); }
-    inline vec2 operator +(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
-    inline vec2 operator -(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
-    inline ivec2 operator *(const ivec2& o) const { return ivec2(this->x * o.x, this->y * o.y); }
-    inline ivec2 operator /(const ivec2& o) const { return ivec2(this->x / o.x, this->y / o.y); }
-    inline ivec2 operator +(const ivec2& o) const { return ivec2(this->x + o.x, this->y + o.y); }
-    inline ivec2 operator -(const ivec2& o) const { return ivec2(this->x - o.x, this->y - o.y); }
-
-    inline ivec2 operator *=(const int o) { this->x *= o; this->y *= o; return *this; }
-    inline ivec2 operator /=(const int o) { this->x /= o; this->y /= o; return *this; }
-    inline ivec2 operator +=(const int o) { this->x += o; this->y += o; return *this; }
-    inline ivec2 operator -=(const int o) { this->x -= o; this->y -= o; return *this; }
-    inline ivec2 operator *=(const ivec2& o) { this->x *= o.x; this->y *= o.y; return *this; }
-    inline ivec2 operator /=(const ivec2& o) { this->x /= o.x; this->y /= o.y; return *this; }
-    inline ivec2 operator +=(const ivec2& o) { this->x += o.x; this->y += o.y; return *this; }
-    inline ivec2 operator -=(const ivec2& o) { this->x -= o.x; this->y -= o.y; return *this; }
+    constexpr ivec2 WithX(int x) const { return ivec2(x, this->y); }
+    constexpr ivec2 WithY(int y) const { return ivec2(this->x, y); }
+
+    constexpr bool operator ==(const ivec2& o) const { return this->x == o.x && this->y == o.y; }
+    constexpr bool operator !=(const ivec2& o) const { return this->x != o.x || this->y != o.y; }
+
+    constexpr ivec2 operator -() const { return ivec2(-this->x, -this->y); }
+    constexpr vec2 operator *(const float o) const { return vec2(this->x * o, this->y * o); }
+    constexpr vec2 operator /(const float o) const { return vec2(this->x / o, this->y / o); }
+    constexpr vec2 operator +(const float o) const { return vec2(this->x + o, this->y + o); }
+    constexpr vec2 operator -(const float o) const { return vec2(this->x - o, this->y - o); }
+    constexpr ivec2 operator *(const int o) const { return ivec2(this->x * o, this->y * o); }
+    constexpr ivec2 operator /(const int o) const { return ivec2(this->x / o, this->y / o); }
+    constexpr ivec2 operator +(const int o) const { return ivec2(this->x + o, this->y + o); }
+    constexpr ivec2 operator -(const int o) const { return ivec2(this->x - o, this->y - o); }
+    constexpr vec2 operator *(const vec2& o) const { return vec2(this->x * o.x, this->y * o.y); }
+    constexpr vec2 operator /(const vec2& o) const { return vec2(this->x / o.x, this->y / o.y); }
+    constexpr vec2 operator +(const vec2& o) const { return vec2(this->x + o.x, this->y + o.y); }
+    constexpr vec2 operator -(const vec2& o) const { return vec2(this->x - o.x, this->y - o.y); }
+    constexpr ivec2 operator *(const ivec2& o) const { return ivec2(this->x * o.x, this->y * o.y); }
+    constexpr ivec2 operator /(const ivec2& o) const { return ivec2(this->x / o.x, this->y / o.y); }
+    constexpr ivec2 operator +(const ivec2& o) const { return ivec2(this->x + o.x, this->y + o.y); }
+    constexpr ivec2 operator -(const ivec2& o) const { return ivec2(this->x - o.x, this->y - o.y); }
+
+    constexpr ivec2 operator *=(const int o) { this->x *= o; this->y *= o; return *this; }
+    constexpr ivec2 operator /=(const int o) { this->x /= o; this->y /= o; return *this; }
+    constexpr ivec2 operator +=(const int o) { this->x += o; this->y += o; return *this; }
+    constexpr ivec2 operator -=(const int o) { this->x -= o; this->y -= o; return *this; }
+    constexpr ivec2 operator *=(const ivec2& o) { this->x *= o.x; this->y *= o.y; return *this; }
+    constexpr ivec2 operator /=(const ivec2& o) { this->x /= o.x; this->y /= o.y; return *this; }
+    constexpr ivec2 operator +=(const ivec2& o) { this->x += o.x; this->y += o.y; return *this; }
+    constexpr ivec2 operator -=(const ivec2& o) { this->x -= o.x; this->y -= o.y; return *this; }
 
     int& operator[] (int i) { assert(i >= 0 && i < 2); return *(&x + i); }
 
@@ -353,74 +353,74 @@ public:
     int y = 0;
 };
 
-inline ivec2 operator *(int scalar, const ivec2& vec) { return ivec2(scalar * vec.x, scalar * vec.y); }
-inline ivec2 operator /(int scalar, const ivec2& vec) { return ivec2(scalar / vec.x, scalar / vec.y); }
-inline ivec2 operator +(int scalar, const ivec2& vec) { return ivec2(scalar + vec.x, scalar + vec.y); }
-inline ivec2 operator -(int scalar, const ivec2& vec) { return ivec2(scalar - vec.x, scalar - vec.y); }
+constexpr ivec2 operator *(int scalar, const ivec2& vec) { return ivec2(scalar * vec.x, scalar * vec.y); }
+constexpr ivec2 operator /(int scalar, const ivec2& vec) { return ivec2(scalar / vec.x, scalar / vec.y); }
+constexpr ivec2 operator +(int scalar, const ivec2& vec) { return ivec2(scalar + vec.x, scalar + vec.y); }
+constexpr ivec2 operator -(int scalar, const ivec2& vec) { return ivec2(scalar - vec.x, scalar - vec.y); }
 
 class ivec3
 {
 public:
-    ivec3() {}
-    ivec3(int nxyz) { x = nxyz; y = nxyz; z = nxyz; }
-    ivec3(int nx, int ny) { x = nx; y = ny; z = 0; }
-    ivec3(int nx, int ny, int nz) { x = nx; y = ny; z = nz; }
-    ivec3(ivec2 v2) { x = v2.x; y = v2.y; z = 0; }
-    ivec3(ivec2 v2, int nz) { x = v2.x; y = v2.y; z = nz; }
-    ivec3(int nx, ivec2 v2) { x = nx; y = v2.x; z = v2.y; }
-
-    ivec3(float nxyz) { x = (int)nxyz; y = (int)nxyz; z = (int)nxyz; }
-    ivec3(float nx, float ny) { x = (int)nx; y = (int)ny; z = 0; }
-    ivec3(float nx, float ny, float nz) { x = (int)nx; y = (int)ny; z = (int)nz; }
-    ivec3(vec2 v2) { x = (int)v2.x; y = (int)v2.y; z = 0; }
-    ivec3(vec2 v2, float nz) { x = (int)v2.x; y = (int)v2.y; z = (int)nz; }
-    ivec3(float nx, vec2 v2) { x = (int)nx; y = (int)v2.x; z = (int)v2.y; }
-
-    ivec3(float nx, int ny) { x = (int)nx; y = ny; z = 0; }
-    ivec3(int nx, float ny) { x = nx; y = (int)ny; z = 0; }
-    ivec3(float nx, int ny, int nz) { x = (int)nx; y = ny; z = nz; }
-    ivec3(int nx, float ny, int nz) { x = nx; y = (int)ny; z = nz; }
-    ivec3(int nx, int ny, float nz) { x = nx; y = ny; z = (int)nz; }
-    ivec3(float nx, float ny, int nz) { x = (int)nx; y = (int)ny; z = nz; }
-    ivec3(float nx, int ny, float nz) { x = (int)nx; y = ny; z = (int)nz; }
+    constexpr ivec3() {}
+    constexpr ivec3(int nxyz) { x = nxyz; y = nxyz; z = nxyz; }
+    constexpr ivec3(int nx, int ny) { x = nx; y = ny; z = 0; }
+    constexpr ivec3(int nx, int ny, int nz) { x = nx; y = ny; z = nz; }
+    constexpr ivec3(ivec2 v2) { x = v2.x; y = v2.y; z = 0; }
+    constexpr ivec3(ivec2 v2, int nz) { x = v2.x; y = v2.y; z = nz; }
+    constexpr ivec3(int nx, ivec2 v2) { x = nx; y = v2.x; z = v2.y; }
+
+    constexpr ivec3(float nxyz) { x = (int)nxyz; y = (int)nxyz; z = (int)nxyz; }
+    constexpr ivec3(float nx, float ny) { x = (int)nx; y = (int)ny; z = 0; }
+    constexpr ivec3(float nx, float ny, float nz) { x = (int)nx; y = (int)ny; z = (int)nz; }
+    constexpr ivec3(vec2 v2) { x = (int)v2.x; y = (int)v2.y; z = 0; }
+    constexpr ivec3(vec2 v2, float nz) { x = (int)v2.x; y = (int)v2.y; z = (int)nz; }
+    constexpr ivec3(float nx, vec2 v2) { x = (int)nx; y = (int)v2.x; z = (int)v2.y; }
+
+    constexpr ivec3(float nx, int ny) { x = (int)nx; y = ny; z = 0; }
+    constexpr ivec3(int nx, float ny) { x = nx; y = (int)ny; z = 0; }
+    constexpr ivec3(float nx, int ny, int nz) { x = (int)nx; y = ny; z = nz; }
+    constexpr ivec3(int nx, float ny, int nz) { x = nx; y = (int)ny; z = nz; }
+    constexpr ivec3(int nx, int ny, float nz) { x = nx; y = ny; z = (int)nz; }
+    constexpr ivec3(float nx, float ny, int nz) { x = (int)nx; y = (int)ny; z = nz; }
+    constexpr ivec3(float nx, int ny, float nz) { x = (int)nx; y = ny; z = (int)nz; }
     //virtual ~ivec3() {}
 
-    inline void Set(int nx, int ny, int nz) { x = nx; y = ny; z = nz; }
-    inline void Set(ivec3 vec) { x = vec.x; y = vec.y; z = vec.z; }
-    inline int LengthSquared() const { return x * x + y * y + z * z; }
+    constexpr void Set(int nx, int ny, int nz) { x = nx; y = ny; z = nz; }
+    constexpr void Set(ivec3 vec) { x = vec.x; y = vec.y; z = vec.z; }
+    constexpr int LengthSquared() const { return x * x + y * y + z * z; }
     inline float Length() const { return sqrtf((float)x * x + y * y + z * z); }
     inline float DistanceFrom(const ivec3 o) const { return sqrtf(((float)x - o.x) * (x - o.x) + (y - o.y) * (y - o.y) + (z - o.z) * (z - o.z)); }
 
     //inline ivec3 Normalize() const { float len = Length(); if( fequal(len,0) ) return ivec3(x,y,z); len = 1.0f/len; return ivec3(x*len, y*len, z*len); }
     //inline ivec3 Cross(const ivec3& o) const { return ivec3( (y*o.z - z*o.y), (z*o.x - x*o.z), (x*o.y - y*o.x) ); }
 
-    inline vec3 MultiplyComponents(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-    inline ivec3 MultiplyComponents(const ivec3& o) const { return ivec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-
-    inline ivec3 WithX(int x) const { return ivec3(x, this->y, this->z); }
-    inline ivec3 WithY(int y) const { return ivec3(this->x, y, this->z); }
-    inline ivec3 WithZ(int z) const { return ivec3(this->x, this->y, z); }
-
-    inline bool operator ==(const ivec3& o) const { return this->x == o.x && this->y == o.y && this->z == o.z; }
-    inline bool operator !=(const ivec3& o) const { return this->x != o.x || this->y != o.y || this->z != o.z; }
-
-    inline ivec3 operator -() const { return ivec3(-this->x, -this->y, -this->z); }
-    inline vec3 operator *(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
-    inline vec3 operator /(const float o) const { return vec3(this->x / o, this->y / o, this->z / o); }
-    inline vec3 operator +(const float o) const { return vec3(this->x + o, this->y + o, this->z + o); }
-    inline vec3 operator -(const float o) const { return vec3(this->x - o, this->y - o, this->z - o); }
-    inline ivec3 operator *(const int o) const { return ivec3(this->x * o, this->y * o, this->z * o); }
-    inline ivec3 operator /(const int o) const { return ivec3(this->x / o, this->y / o, this->z / o); }
-    inline ivec3 operator +(const int o) const { return ivec3(this->x + o, this->y + o, this->z + o); }
-    inline ivec3 operator -(const int o) const { return ivec3(this->x - o, this->y - o, this->z - o); }
-    inline vec3 operator *(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-    inline vec3 operator /(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
-    inline vec3 operator +(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
-    inline vec3 operator -(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
-    inline ivec3 operator *(const ivec3& o) const { return ivec3(this->x * o.x, this->y * o.y, this->z * o.z); }
-    inline ivec3 operator /(const ivec3& o) const { return ivec3(this->x / o.x, this->y / o.y, this->z / o.z); }
-    inline ivec3 operator +(const ivec3& o) const { return ivec3(this->x + o.x, this->y + o.y, this->z + o.z); }
-    inline ivec3 operator -(const ivec3& o) const { return ivec3(this->x - o.x, this->y - o.y, this->z - o.z); }
+    constexpr vec3 MultiplyComponents(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+    constexpr ivec3 MultiplyComponents(const ivec3& o) const { return ivec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+
+    constexpr ivec3 WithX(int x) const { return ivec3(x, this->y, this->z); }
+    constexpr ivec3 WithY(int y) const { return ivec3(this->x, y, this->z); }
+    constexpr ivec3 WithZ(int z) const { return ivec3(this->x, this->y, z); }
+
+    constexpr bool operator ==(const ivec3& o) const { return this->x == o.x && this->y == o.y && this->z == o.z; }
+    constexpr bool operator !=(const ivec3& o) const { return this->x != o.x || this->y != o.y || this->z != o.z; }
+
+    constexpr ivec3 operator -() const { return ivec3(-this->x, -this->y, -this->z); }
+    constexpr vec3 operator *(const float o) const { return vec3(this->x * o, this->y * o, this->z * o); }
+    constexpr vec3 operator /(const float o) const { return vec3(this->x / o, this->y / o, this->z / o); }
+    constexpr vec3 operator +(const float o) const { return vec3(this->x + o, this->y + o, this->z + o); }
+    constexpr vec3 operator -(const float o) const { return vec3(this->x - o, this->y - o, this->z - o); }
+    constexpr ivec3 operator *(const int o) const { return ivec3(this->x * o, this->y * o, this->z * o); }
+    constexpr ivec3 operator /(const int o) const { return ivec3(this->x / o, this->y / o, this->z / o); }
+    constexpr ivec3 operator +(const int o) const { return ivec3(this->x + o, this->y + o, this->z + o); }
+    constexpr ivec3 operator -(const int o) const { return ivec3(this->x - o, this->y - o, this->z - o); }
+    constexpr vec3 operator *(const vec3& o) const { return vec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+    constexpr vec3 operator /(const vec3& o) const { return vec3(this->x / o.x, this->y / o.y, this->z / o.z); }
+    constexpr vec3 operator +(const vec3& o) const { return vec3(this->x + o.x, this->y + o.y, this->z + o.z); }
+    constexpr vec3 operator -(const vec3& o) const { return vec3(this->x - o.x, this->y - o.y, this->z - o.z); }
+    constexpr ivec3 operator *(const ivec3& o) const { return ivec3(this->x * o.x, this->y * o.y, this->z * o.z); }
+    constexpr ivec3 operator /(const ivec3& o) const { return ivec3(this->x / o.x, this->y / o.y, this->z / o.z); }
+    constexpr ivec3 operator +(const ivec3& o) const { return ivec3(this->x + o.x, this->y + o.y, this->z + o.z); }
+    constexpr ivec3 operator -(const ivec3& o) const { return ivec3(this->x - o.x, this->y - o.y, this->z - o.z); }
 
     //inline ivec3 operator *=(const float o) { this->x *= o; this->y *= o; this->z *= o; return *this; }
     //inline ivec3 operator /=(const float o) { this->x /= o; this->y /= o; this->z /= o; return *this; }
@@ -428,8 +428,8 @@ public:
     //inline ivec3 operator -=(const float o) { this->x -= o; this->y -= o; this->z -= o; return *this; }
     //inline ivec3 operator +=(const vec3& o) { this->x += o.x; this->y += o.y; this->z += o.z; return *this; }
     //inline ivec3 operator -=(const vec3& o) { this->x -= o.x; this->y -= o.y; this->z -= o.z; return *this; }
-    inline ivec3 operator +=(const ivec3& o) { this->x += o.x; this->y += o.y; this->z += o.z; return *this; }
-    inline ivec3 operator -=(const ivec3& o) { this->x -= o.x; this->y -= o.y; this->z -= o.z; return *this; }
+    constexpr ivec3 operator +=(const ivec3& o) { this->x += o.x; this->y += o.y; this->z += o.z; return *this; }
+    constexpr ivec3 operator -=(const ivec3& o) { this->x -= o.x; this->y -= o.y; this->z -= o.z; return *this; }
 
     int& operator[] (int i) { assert(i >= 0 && i < 3); return *(&x + i); }
 
@@ -439,89 +439,89 @@ public:
     int z = 0;
 };
 
-inline vec3 operator *(float scalar, const ivec3& vec) { return vec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
-inline vec3 operator /(float scalar, const ivec3& vec) { return vec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
-inline vec3 operator +(float scalar, const ivec3& vec) { return vec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
-inline vec3 operator -(float scalar, const ivec3& vec) { return vec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
-inline ivec3 operator *(int scalar, const ivec3& vec) { return ivec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
-inline ivec3 operator /(int scalar, const ivec3& vec) { return ivec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
-inline ivec3 operator +(int scalar, const ivec3& vec) { return ivec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
-inline ivec3 operator -(int scalar, const ivec3& vec) { return ivec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
+constexpr vec3 operator *(float scalar, const ivec3& vec) { return vec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
+constexpr vec3 operator /(float scalar, const ivec3& vec) { return vec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
+constexpr vec3 operator +(float scalar, const ivec3& vec) { return vec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
+constexpr vec3 operator -(float scalar, const ivec3& vec) { return vec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
+constexpr ivec3 operator *(int scalar, const ivec3& vec) { return ivec3(scalar * vec.x, scalar * vec.y, scalar * vec.z); }
+constexpr ivec3 operator /(int scalar, const ivec3& vec) { return ivec3(scalar / vec.x, scalar / vec.y, scalar / vec.z); }
+constexpr ivec3 operator +(int scalar, const ivec3& vec) { return ivec3(scalar + vec.x, scalar + vec.y, scalar + vec.z); }
+constexpr ivec3 operator -(int scalar, const ivec3& vec) { return ivec3(scalar - vec.x, scalar - vec.y, scalar - vec.z); }
 
 class ivec4
 {
 public:
-    ivec4() {}
-    ivec4(int nxyzw) { x = nxyzw; y = nxyzw; z = nxyzw; w = nxyzw; }
-    ivec4(int nx, int ny) { x = nx; y = ny; z = 0; w = 0; }
-    ivec4(int nx, int ny, int nz) { x = nx; y = ny; z = nz; w = 0; }
-    ivec4(int nx, int ny, int nz, int nw) { x = nx; y = ny; z = nz; w = nw; }
-    ivec4(ivec2 vec, int nz, int nw) { x = vec.x; y = vec.y; z = nz; w = nw; }
-    ivec4(int nx, int ny, ivec2 vec) { x = nx; y = ny; z = vec.x; w = vec.y; }
-    ivec4(int nx, ivec2 vec, int nw) { x = nx; y = vec.x; z = vec.y; w = nw; }
-    ivec4(ivec2 vec_1, ivec2 vec_2) { x = vec_1.x; y = vec_1.y; z = vec_2.x; w = vec_2.y; }
-    ivec4(ivec3 vec, int nw) { x = vec.x; y = vec.y; z = vec.z; w = nw; }
-    ivec4(int nx, ivec3 vec) { x = nx; y = vec.x; z = vec.y; w = vec.z; }
-
-    ivec4(float nxyzw) { x = (int)nxyzw; y = (int)nxyzw; z = (int)nxyzw; w = (int)nxyzw; }
-    ivec4(float nx, float ny) { x = (int)nx; y = (int)ny; z = 0; w = 0; }
-    ivec4(float nx, float ny, float nz) { x = (int)nx; y = (int)ny; z = (int)nz; w = 0; }
-    ivec4(float nx, float ny, float nz, float nw) { x = (int)nx; y = (int)ny; z = (int)nz; w = (int)nw; }
-    ivec4(vec2 vec, float nz, float nw) { x = (int)vec.x; y = (int)vec.y; z = (int)nz; w = (int)nw; }
-    ivec4(float nx, float ny, vec2 vec) { x = (int)nx; y = (int)ny; z = (int)vec.x; w = (int)vec.y; }
-    ivec4(float nx, vec2 vec, float nw) { x = (int)nx; y = (int)vec.x; z = (int)vec.y; w = (int)nw; }
-    ivec4(vec2 vec_1, vec2 vec_2) { x = (int)vec_1.x; y = (int)vec_1.y; z = (int)vec_2.x; w = (int)vec_2.y; }
-    ivec4(vec3 vec, float nw) { x = (int)vec.x; y = (int)vec.y; z = (int)vec.z; w = (int)nw; }
-    ivec4(float nx, vec3 vec) { x = (int)nx; y = (int)vec.x; z = (int)vec.y; w = (int)vec.z; }
-
-    ivec4(float nx, int ny) { x = (int)nx; y = ny; z = 0; w = 0; }
-    ivec4(int nx, float ny) { x = nx; y = (int)ny; z = 0; w = 0; }
-    ivec4(float nx, int ny, int nz) { x = (int)nx; y = ny; z = nz; w = 0; }
-    ivec4(int nx, float ny, int nz) { x = nx; y = (int)ny; z = nz; w = 0; }
-    ivec4(int nx, int ny, float nz) { x = nx; y = ny; z = (int)nz; w = 0; }
-    ivec4(float nx, float ny, int nz) { x = (int)nx; y = (int)ny; z = nz; w = 0; }
-    ivec4(float nx, int ny, float nz) { x = (int)nx; y = ny; z = (int)nz; w = 0; }
-    ivec4(float nx, int ny, int nz, int nw) { x = (int)nx; y = ny; z = nz; w = nw; }
-    ivec4(int nx, float ny, int nz, int nw) { x = nx; y = (int)ny; z = nz; w = nw; }
-    ivec4(int nx, int ny, float nz, int nw) { x = nx; y = ny; z = (int)nz; w = nw; }
-    ivec4(int nx, int ny, int nz, float nw) { x = nx; y = ny; z = nz; w = (int)nw; }
-    ivec4(float nx, float ny, int nz, int nw) { x = (int)nx; y = (int)ny; z = nz; w = nw; }
-    ivec4(float nx, int ny, float nz, int nw) { x = (int)nx; y = ny; z = (int)nz; w = nw; }
-    ivec4(float nx, int ny, int nz, float nw) { x = (int)nx; y = ny; z = nz; w = (int)nw; }
-    ivec4(int nx, float ny, float nz, int nw) { x = nx; y = (int)ny; z = (int)nz; w = nw; }
-    ivec4(int nx, float ny, int nz, float nw) { x = nx; y = (int)ny; z = nz; w = (int)nw; }
-    ivec4(int nx, int ny, float nz, float nw) { x = nx; y = ny; z = (int)nz; w = (int)nw; }
-    ivec4(float nx, float ny, float nz, int nw) { x = (int)nx; y = (int)ny; z = (int)nz; w = nw; }
-    ivec4(float nx, float ny, int nz, float nw) { x = (int)nx; y = (int)ny; z = nz; w = (int)nw; }
-    ivec4(float nx, int ny, float nz, float nw) { x = (int)nx; y = ny; z = (int)nz; w = (int)nw; }
-    ivec4(int nx, float ny, float nz, float nw) { x = nx; y = (int)ny; z = (int)nz; w = (int)nw; }
-    ivec4(ivec2 vec, float nz, int nw) { x = vec.x; y = vec.y; z = (int)nz; w = nw; }
-    ivec4(ivec2 vec, int nz, float nw) { x = vec.x; y = vec.y; z = nz; w = (int)nw; }
-    ivec4(float nx, int ny, ivec2 vec) { x = (int)nx; y = ny; z = vec.x; w = vec.y; }
-    ivec4(int nx, float ny, ivec2 vec) { x = nx; y = (int)ny; z = vec.x; w = vec.y; }
-    ivec4(float nx, ivec2 vec, int nw) { x = (int)nx; y = vec.x; z = vec.y; w = nw; }
-    ivec4(int nx, ivec2 vec, float nw) { x = nx; y = vec.x; z = vec.y; w = (int)nw; }
+    constexpr ivec4() {}
+    constexpr ivec4(int nxyzw) { x = nxyzw; y = nxyzw; z = nxyzw; w = nxyzw; }
+    constexpr ivec4(int nx, int ny) { x = nx; y = ny; z = 0; w = 0; }
+    constexpr ivec4(int nx, int ny, int nz) { x = nx; y = ny; z = nz; w = 0; }
+    constexpr ivec4(int nx, int ny, int nz, int nw) { x = nx; y = ny; z = nz; w = nw; }
+    constexpr ivec4(ivec2 vec, int nz, int nw) { x = vec.x; y = vec.y; z = nz; w = nw; }
+    constexpr ivec4(int nx, int ny, ivec2 vec) { x = nx; y = ny; z = vec.x; w = vec.y; }
+    constexpr ivec4(int nx, ivec2 vec, int nw) { x = nx; y = vec.x; z = vec.y; w = nw; }
+    constexpr ivec4(ivec2 vec_1, ivec2 vec_2) { x = vec_1.x; y = vec_1.y; z = vec_2.x; w = vec_2.y; }
+    constexpr ivec4(ivec3 vec, int nw) { x = vec.x; y = vec.y; z = vec.z; w = nw; }
+    constexpr ivec4(int nx, ivec3 vec) { x = nx; y = vec.x; z = vec.y; w = vec.z; }
+
+    constexpr ivec4(float nxyzw) { x = (int)nxyzw; y = (int)nxyzw; z = (int)nxyzw; w = (int)nxyzw; }
+    constexpr ivec4(float nx, float ny) { x = (int)nx; y = (int)ny; z = 0; w = 0; }
+    constexpr ivec4(float nx, float ny, float nz) { x = (int)nx; y = (int)ny; z = (int)nz; w = 0; }
+    constexpr ivec4(float nx, float ny, float nz, float nw) { x = (int)nx; y = (int)ny; z = (int)nz; w = (int)nw; }
+    constexpr ivec4(vec2 vec, float nz, float nw) { x = (int)vec.x; y = (int)vec.y; z = (int)nz; w = (int)nw; }
+    constexpr ivec4(float nx, float ny, vec2 vec) { x = (int)nx; y = (int)ny; z = (int)vec.x; w = (int)vec.y; }
+    constexpr ivec4(float nx, vec2 vec, float nw) { x = (int)nx; y = (int)vec.x; z = (int)vec.y; w = (int)nw; }
+    constexpr ivec4(vec2 vec_1, vec2 vec_2) { x = (int)vec_1.x; y = (int)vec_1.y; z = (int)vec_2.x; w = (int)vec_2.y; }
+    constexpr ivec4(vec3 vec, float nw) { x = (int)vec.x; y = (int)vec.y; z = (int)vec.z; w = (int)nw; }
+    constexpr ivec4(float nx, vec3 vec) { x = (int)nx; y = (int)vec.x; z = (int)vec.y; w = (int)vec.z; }
+
+    constexpr ivec4(float nx, int ny) { x = (int)nx; y = ny; z = 0; w = 0; }
+    constexpr ivec4(int nx, float ny) { x = nx; y = (int)ny; z = 0; w = 0; }
+    constexpr ivec4(float nx, int ny, int nz) { x = (int)nx; y = ny; z = nz; w = 0; }
+    constexpr ivec4(int nx, float ny, int nz) { x = nx; y = (int)ny; z = nz; w = 0; }
+    constexpr ivec4(int nx, int ny, float nz) { x = nx; y = ny; z = (int)nz; w = 0; }
+    constexpr ivec4(float nx, float ny, int nz) { x = (int)nx; y = (int)ny; z = nz; w = 0; }
+    constexpr ivec4(float nx, int ny, float nz) { x = (int)nx; y = ny; z = (int)nz; w = 0; }
+    constexpr ivec4(float nx, int ny, int nz, int nw) { x = (int)nx; y = ny; z = nz; w = nw; }
+    constexpr ivec4(int nx, float ny, int nz, int nw) { x = nx; y = (int)ny; z = nz; w = nw; }
+    constexpr ivec4(int nx, int ny, float nz, int nw) { x = nx; y = ny; z = (int)nz; w = nw; }
+    constexpr ivec4(int nx, int ny, int nz, float nw) { x = nx; y = ny; z = nz; w = (int)nw; }
+    constexpr ivec4(float nx, float ny, int nz, int nw) { x = (int)nx; y = (int)ny; z = nz; w = nw; }
+    constexpr ivec4(float nx, int ny, float nz, int nw) { x = (int)nx; y = ny; z = (int)nz; w = nw; }
+    constexpr ivec4(float nx, int ny, int nz, float nw) { x = (int)nx; y = ny; z = nz; w = (int)nw; }
+    constexpr ivec4(int nx, float ny, float nz, int nw) { x = nx; y = (int)ny; z = (int)nz; w = nw; }
+    constexpr ivec4(int nx, float ny, int nz, float nw) { x = nx; y = (int)ny; z = nz; w = (int)nw; }
+    constexpr ivec4(int nx, int ny, float nz, float nw) { x = nx; y = ny; z = (int)nz; w = (int)nw; }
+    constexpr ivec4(float nx, float ny, float nz, int nw) { x = (int)nx; y = (int)ny; z = (int)nz; w = nw; }
+    constexpr ivec4(float nx, float ny, int nz, float nw) { x = (int)nx; y = (int)ny; z = nz; w = (int)nw; }
+    constexpr ivec4(float nx, int ny, float nz, float nw) { x = (int)nx; y = ny; z = (int)nz; w = (int)nw; }
+    constexpr ivec4(int nx, float ny, float nz, float nw) { x = nx; y = (int)ny; z = (int)nz; w = (int)nw; }
+    constexpr ivec4(ivec2 vec, float nz, int nw) { x = vec.x; y = vec.y; z = (int)nz; w = nw; }
+    constexpr ivec4(ivec2 vec, int nz, float nw) { x = vec.x; y = vec.y; z = nz; w = (int)nw; }
+    constexpr ivec4(float nx, int ny, ivec2 vec) { x = (int)nx; y = ny; z = vec.x; w = vec.y; }
+    constexpr ivec4(int nx, float ny, ivec2 vec) { x = nx; y = (int)ny; z = vec.x; w = vec.y; }
+    constexpr ivec4(float nx, ivec2 vec, int nw) { x = (int)nx; y = vec.x; z = vec.y; w = nw; }
+    constexpr ivec4(int nx, ivec2 vec, float nw) { x = nx; y = vec.x; z = vec.y; w = (int)nw; }
     //virtual ~ivec4() {}
 
-    inline void Set(int nx, int ny, int nz, int nw) { x = nx; y = ny; z = nz; w = nw; }
-    inline float LengthSquared() const { return (float)x * x + y * y + z * z + w * w; }
+    constexpr void Set(int nx, int ny, int nz, int nw) { x = nx; y = ny; z = nz; w = nw; }
+    constexpr float LengthSquared() const { return (float)x * x + y * y + z * z + w * w; }
     inline float Length() const { return sqrtf((float)x * x + y * y + z * z + w * w); }
     inline float DistanceFrom(const ivec4 o) const { return sqrtf(((float)x - o.x) * (x - o.x) + (y - o.y) * (y - o.y) + (z - o.z) * (z - o.z) + (w - o.w) * (w - o.w)); }
 
     //inline ivec4 Normalize() const { float len = Length(); if( fequal(len,0) ) return ivec4(x,y,z); len = 1.0f/len; return ivec4(x*len, y*len, z*len); }
     //inline ivec4 Cross(const ivec4& o) const { return ivec4( (y*o.z - z*o.y), (z*o.x - x*o.z), (x*o.y - y*o.x) ); }
 
-    inline ivec4 WithX(int x) const { return ivec4(x, this->y, this->z, this->w); }
-    inline ivec4 WithY(int y) const { return ivec4(this->x, y, this->z, this->w); }
-    inline ivec4 WithZ(int z) const { return ivec4(this->x, this->y, z, this->w); }
-    inline ivec4 WithW(int w) const { return ivec4(this->x, this->y, this->z, w); }
+    constexpr ivec4 WithX(int x) const { return ivec4(x, this->y, this->z, this->w); }
+    constexpr ivec4 WithY(int y) const { return ivec4(this->x, y, this->z, this->w); }
+    constexpr ivec4 WithZ(int z) const { return ivec4(this->x, this->y, z, this->w); }
+    constexpr ivec4 WithW(int w) const { return ivec4(this->x, this->y, this->z, w); }
 
-    inline bool operator ==(const ivec4& o) const { return this->x == o.x && this->y == o.y && this->z == o.z && this->w == o.w; }
-    inline bool operator !=(const ivec4& o) const { return this->x != o.x || this->y != o.y || this->z != o.z || this->w != o.w; }
+    constexpr bool operator ==(const ivec4& o) const { return this->x == o.x && this->y == o.y && this->z == o.z && this->w == o.w; }
+    constexpr bool operator !=(const ivec4& o) const { return this->x != o.x || this->y != o.y || this->z != o.z || this->w != o.w; }
 
-    inline ivec4 operator -() const { return ivec4(-this->x, -this->y, -this->z, -this->w); }
-    inline ivec4 operator +(const ivec4& o) const { return ivec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
-    inline ivec4 operator -(const ivec4& o) const { return ivec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
+    constexpr ivec4 operator -() const { return ivec4(-this->x, -this->y, -this->z, -this->w); }
+    constexpr ivec4 operator +(const ivec4& o) const { return ivec4(this->x + o.x, this->y + o.y, this->z + o.z, this->w + o.w); }
+    constexpr ivec4 operator -(const ivec4& o) const { return ivec4(this->x - o.x, this->y - o.y, this->z - o.z, this->w - o.w); }
 
     int& operator[] (int i) { assert(i >= 0 && i < 4); return *(&x + i); }
 
@@ -532,10 +532,10 @@ public:
     int w = 0;
 };
 
-inline ivec4 operator *(int scalar, const ivec4& vec) { return ivec4(scalar * vec.x, scalar * vec.y, scalar * vec.z, scalar * vec.w); }
-inline ivec4 operator /(int scalar, const ivec4& vec) { return ivec4(scalar / vec.x, scalar / vec.y, scalar / vec.z, scalar / vec.w); }
-inline ivec4 operator +(int scalar, const ivec4& vec) { return ivec4(scalar + vec.x, scalar + vec.y, scalar + vec.z, scalar + vec.w); }
-inline ivec4 operator -(int scalar, const ivec4& vec) { return ivec4(scalar - vec.x, scalar - vec.y, scalar - vec.z, scalar - vec.w); }
+constexpr ivec4 operator *(int scalar, const ivec4& vec) { return ivec4(scalar * vec.x, scalar * vec.y, scalar * vec.z, scalar * vec.w); }
+constexpr ivec4 operator /(int scalar, const ivec4& vec) { return ivec4(scalar / vec.x, scalar / vec.y, scalar / vec.z, scalar / vec.w); }
+constexpr ivec4 operator +(int scalar, const ivec4& vec) { return ivec4(scalar + vec.x, scalar + vec.y, scalar + vec.z, scalar + vec.w); }
+constexpr ivec4 operator -(int scalar, const ivec4& vec) { return ivec4(scalar - vec.x, scalar - vec.y, scalar - vec.z, scalar - vec.w); }
 
 class MyRect
 {
@@ -594,45 +594,45 @@ public:
 class Color4f
 {
 public:
-    Color4f() {}
-    Color4f(float nr, float ng, float nb, float na) { r = nr; g = ng; b = nb; a = na; }
+    constexpr Color4f() {}
+    constexpr Color4f(float nr, float ng, float nb, float na) { r = nr; g = ng; b = nb; a = na; }
 
     // Primary.
-    static const Color4f Red()              { return Color4f(1.0f, 0.0f, 0.0f, 1.0f); }
-    static const Color4f Green()            { return Color4f(0.0f, 1.0f, 0.0f, 1.0f); }
-    static const Color4f Yellow()           { return Color4f(1.0f, 1.0f, 0.0f, 1.0f); }
-    static const Color4f Blue()             { return Color4f(0.0f, 0.0f, 1.0f, 1.0f); }
-    static const Color4f White()            { return Color4f(1.0f, 1.0f, 1.0f, 1.0f); }
-    static const Color4f Black()            { return Color4f(0.0f, 0.0f, 0.0f, 1.0f); }
-    static const Color4f Grey()             { return Color4f(0.5f, 0.5f, 0.5f, 1.0f); }
+    static constexpr Color4f Red()              { return Color4f(1.0f, 0.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Green()            { return Color4f(0.0f, 1.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Yellow()           { return Color4f(1.0f, 1.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Blue()             { return Color4f(0.0f, 0.0f, 1.0f, 1.0f); }
+    static constexpr Color4f White()            { return Color4f(1.0f, 1.0f, 1.0f, 1.0f); }
+    static constexpr Color4f Black()            { return Color4f(0.0f, 0.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Grey()             { return Color4f(0.5f, 0.5f, 0.5f, 1.0f); }
 
     // Red Shades.
-    static const Color4f Maroon()           { return Color4f(0.3f, 0.0f, 0.0f, 1.0f); }
-    static const Color4f Orange()           { return Color4f(1.0f, 0.6471f, 0.0f, 1.0f); }
-    static const Color4f FireRed()          { return Color4f(0.8f, 0.12f, 0.16f, 1.0f); }
+    static constexpr Color4f Maroon()           { return Color4f(0.3f, 0.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Orange()           { return Color4f(1.0f, 0.6471f, 0.0f, 1.0f); }
+    static constexpr Color4f FireRed()          { return Color4f(0.8f, 0.12f, 0.16f, 1.0f); }
 
     // Green Shades.
-    static const Color4f Forest()           { return Color4f(0.0f, 0.3f, 0.0f, 1.0f); }
-    static const Color4f AppleGreen()       { return Color4f(0.5f, 0.7f, 0.0f, 1.0f); }
-    static const Color4f LimeGreen()        { return Color4f(0.74f, 1.0f, 0.0f, 1.0f); }
+    static constexpr Color4f Forest()           { return Color4f(0.0f, 0.3f, 0.0f, 1.0f); }
+    static constexpr Color4f AppleGreen()       { return Color4f(0.5f, 0.7f, 0.0f, 1.0f); }
+    static constexpr Color4f LimeGreen()        { return Color4f(0.74f, 1.0f, 0.0f, 1.0f); }
 
     // Blue Shades.
-    static const Color4f DarkBlue()         { return Color4f(0.0f, 0.0f, 0.3f, 1.0f); }
-    static const Color4f Cyan()             { return Color4f(0.0f, 1.0f, 1.0f, 1.0f); }
-    static const Color4f CornflowerBlue()   { return Color4f(0.39f, 0.05f, 0.92f, 1.0f); }
-
-	inline bool operator ==(const Color4f& o) const { return fequal(this->r, o.r) && fequal(this->g, o.g) && fequal(this->b, o.b) && fequal(this->a, o.a); }
-	inline bool operator !=(const Color4f& o) const { return !fequal(this->r, o.r) || !fequal(this->g, o.g) || !fequal(this->b, o.b) || !fequal(this->a, o.a); }
-
-	inline Color4f operator -() const { return Color4f(-this->r, -this->g, -this->b, -this->a); }
-	inline Color4f operator *(const float o) const { return Color4f(this->r * o, this->g * o, this->b * o, this->a * o); }
-	inline Color4f operator /(const float o) const { return Color4f(this->r / o, this->g / o, this->b / o, this->a / o); }
-	inline Color4f operator +(const float o) const { return Color4f(this->r + o, this->g + o, this->b + o, this->a + o); }
-	inline Color4f operator -(const float o) const { return Color4f(this->r - o, this->g - o, this->b - o, this->a - o); }
-	inline Color4f operator *(const Color4f& o) const { return Color4f(this->r * o.r, this->g * o.g, this->b * o.b, this->a * o.a); }
-	inline Color4f operator /(const Color4f& o) const { return Color4f(this->r / o.r, this->g / o.g, this->b / o.b, this->a / o.a); }
-	inline Color4f operator +(const Color4f& o) const { return Color4f(this->r + o.r, this->g + o.g, this->b + o.b, this->a + o.a); }
-	inline Color4f operator -(const Color4f& o) const { return Color4f(this->r - o.r, this->g - o.g, this->b - o.b, this->a - o.a); }
+    static constexpr Color4f DarkBlue()         { return Color4f(0.0f, 0.0f, 0.3f, 1.0f); }
+    static constexpr Color4f Cyan()             { return Color4f(0.0f, 1.0f, 1.0f, 1.0f); }
+    static constexpr Color4f CornflowerBlue()   { return Color4f(0.39f, 0.05f, 0.92f, 1.0f); }
+
+	constexpr bool operator ==(const Color4f& o) const { return fequal(this->r, o.r) && fequal(this->g, o.g) && fequal(this->b, o.b) && fequal(this->a, o.a); }
+	constexpr bool operator !=(const Color4f& o) const { return !fequal(this->r, o.r) || !fequal(this->g, o.g) || !fequal(this->b, o.b) || !fequal(this->a, o.a); }
+
+	constexpr Color4f operator -() const { return Color4f(-this->r, -this->g, -this->b, -this->a); }
+	constexpr Color4f operator *(const float o) const { return Color4f(this->r * o, this->g * o, this->b * o, this->a * o); }
+	constexpr Color4f operator /(const float o) const { return Color4f(this->r / o, this->g / o, this->b / o, this->a / o); }
+	constexpr Color4f operator +(const float o) const { return Color4f(this->r + o, this->g + o, this->b + o, this->a + o); }
+	constexpr Color4f operator -(const float o) const { return Color4f(this->r - o, this->g - o, this->b - o, this->a - o); }
+	constexpr Color4f operator *(const Color4f& o) const { return Color4f(this->r * o.r, this->g * o.g, this->b * o.b, this->a * o.a); }
+	constexpr Color4f operator /(const Color4f& o) const { return Color4f(this->r / o.r, this->g / o.g, this->b / o.b, this->a / o.a); }
+	constexpr Color4f operator +(const Color4f& o) const { return Color4f(this->r + o.r, this->g + o.g, this->b + o.b, this->a + o.a); }
+	constexpr Color4f operator -(const Color4f& o) const { return Color4f(this->r - o.r, this->g - o.g, this->b - o.b, this->a - o.a); }
 
 public:
     float r = 1.0f;
@@ -641,9 +641,9 @@ public:
     float a = 1.0f;
 };
 
-inline Color4f operator *(float scalar, const Color4f& vec) { return Color4f(scalar * vec.r, scalar * vec.g, scalar * vec.b, scalar * vec.a); }
-inline Color4f operator /(float scalar, const Color4f& vec) { return Color4f(scalar / vec.r, scalar / vec.g, scalar / vec.b, scalar / vec.a); }
-inline Color4f operator +(float scalar, const Color4f& vec) { return Color4f(scalar + vec.r, scalar + vec.g, scalar + vec.b, scalar + vec.a); }
-inline Color4f operator -(float scalar, const Color4f& vec) { return Color4f(scalar - vec.r, scalar - vec.g, scalar - vec.b, scalar - vec.a); }
+constexpr Color4f operator *(float scalar, const Color4f& vec) { return Color4f(scalar * vec.r, scalar * vec.g, scalar * vec.b, scalar * vec.a); }
+constexpr Color4f operator /(float scalar, const Color4f& vec) { return Color4f(scalar / vec.r, scalar / vec.g, scalar / vec.b, scalar / vec.a); }
+constexpr Color4f operator +(float scalar, const Color4f& vec) { return Color4f(scalar + vec.r, scalar + vec.g, scalar + vec.b, scalar + vec.a); }
+constexpr Color4f operator -(float scalar, const Color4f& vec) { return Color4f(scalar - vec.r, scalar - vec.g, scalar - vec.b, scalar - vec.a); }
 
 }
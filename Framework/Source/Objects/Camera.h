@@ -26,6 +26,10 @@ public:
     void SetThirdPersonOffset(vec3 offset) { m_offset = offset; }
 	void SetAspectRatio(float aspectRatio) { m_aspectRatio = aspectRatio; }
 
+    // For cameras that aren't updated by a scene, Update() would overwrite these.
+    void SetViewMatrix(const matrix& viewMatrix) { m_ViewMatrix = viewMatrix; }
+    void SetProjecMatrix(const matrix& projecMatrix) { m_ProjecMatrix = projecMatrix; }
+
 	void TogglePerspective() { m_perspectiveMode = !m_perspectiveMode; }
 	void SetPerspective(bool perspectiveMode) { m_perspectiveMode = perspectiveMode; }
 
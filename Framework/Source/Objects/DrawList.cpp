@@ -0,0 +1,206 @@
+#include "CoreHeaders.h"
+
+#include "DrawList.h"
+#include "Camera.h"
+#include "Material.h"
+#include "Mesh.h"
+#include "ShaderProgram.h"
+#include "Texture.h"
+#include "Components/LightComponent.h"
+#include "Components/MeshComponent.h"
+#include "Components/TransformComponent.h"
+#include "Math/FastMath.h"
+#include "Math/MathHelpers.h"
+#include "Utility/JobSystem.h"
+
+#include <algorithm>
+
+namespace fw {
+
+// Below this many draws per job the cost of queuing it outweighs the work.
+static const size_t c_MinDrawsPerJob = 256;
+
+DrawList::DrawList(JobSystem* pJobSystem)
+{
+    m_pJobSystem = pJobSystem;
+}
+
+DrawList::~DrawList()
+{
+}
+
+void DrawList::Build(Camera* pCamera, const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, const LightView& lights)
+{
+    assert( transforms.size() == meshComponents.size() );
+
+    // Per-frame values shared by every command.
+    m_ViewProjMatrix = pCamera->GetProjecMatrix() * pCamera->GetViewMatrix();
+    GatherLights( lights, m_FrameLights );
+
+    size_t numDraws = meshComponents.size();
+    m_Commands.resize( numDraws );
+
+    // Each range writes to its own slice of m_Commands.
+    if( m_pJobSystem )
+    {
+        m_pJobSystem->ParallelFor( "DrawList::Build", numDraws,
+            [this, &meshComponents, &transforms](size_t start, size_t end) { BuildRange( meshComponents, transforms, start, end ); },
+            c_MinDrawsPerJob );
+    }
+    else
+    {
+        BuildRange( meshComponents, transforms, 0, numDraws );
+    }
+
+    if( m_SortByState )
+    {
+        std::stable_sort( m_Commands.begin(), m_Commands.end(),
+            [](const DrawCommand& a, const DrawCommand& b) { return a.sortKey < b.sortKey; } );
+    }
+}
+
+void DrawList::Submit(Camera* pCamera)
+{
+    for( const DrawCommand& command : m_Commands )
+    {
+        command.pMesh->Draw( pCamera, command );
+    }
+}
+
+void DrawList::BuildRange(const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, size_t start, size_t end)
+{
+    for( size_t i=start; i<end; i++ )
+    {
+        MeshComponent* pMeshComponent = static_cast<MeshComponent*>( meshComponents[i] );
+        TransformComponent* pTransform = transforms[i];
+        DrawCommand& command = m_Commands[i];
+
+        command.pMesh = pMeshComponent->GetMesh();
+        command.pMaterial = pMeshComponent->GetMaterial();
+        command.sortKey = CreateSortKey( command.pMesh, command.pMaterial );
+
+        // Cached by the transform, only rebuilt when it moves.
+        command.normalMatrix = pTransform->GetNormalMatrix();
+
+        command.worldMatrix = pTransform->GetWorldTransform();
+        command.wvpMatrix = m_ViewProjMatrix * command.worldMatrix;
+
+        command.uvScale = pMeshComponent->GetUVScale();
+        command.uvOffset = pMeshComponent->GetUVOffset();
+
+        command.hasLights = m_FrameLights.empty() == false;
+        if( command.hasLights )
+        {
+            SelectLights( m_FrameLights, pTransform->GetWorldPosition(), command.lights );
+        }
+    }
+}
+
+void DrawList::GatherLights(const LightView& lights, std::vector<FrameLight>& frameLights)
+{
+    frameLights.resize( lights.size() );
+
+    for( size_t i=0; i<lights.size(); i++ )
+    {
+        LightComponent* pLight;
+        TransformComponent* pTransform;
+        std::tie( pLight, pTransform ) = lights[i];
+        LightFixture* pDetails = pLight->GetDetails();
+        FrameLight& frameLight = frameLights[i];
+
+        frameLight.type = pDetails->type;
+        frameLight.color = vec4( pDetails->diffuse.r, pDetails->diffuse.g, pDetails->diffuse.b, pDetails->diffuse.a );
+        frameLight.position = pTransform->GetWorldPosition();
+        frameLight.radius = pDetails->radius;
+        frameLight.powerFactor = pDetails->powerFactor;
+        frameLight.spotCosCutoff = fastmath::CosDegrees( pLight->GetCutoff() / 2 );
+
+        // Directional lights shine down their -z axis, spot lights down +z.
+        matrix rotation;
+        rotation.CreateRotation( pTransform->GetRotation() );
+        if( frameLight.type == LightType::Directional )
+            frameLight.direction = rotation * vec3( 0, 0, -1 );
+        else if( frameLight.type == LightType::SpotLight )
+            frameLight.direction = rotation * vec3( 0, 0, 1 );
+        else
+            frameLight.direction = pTransform->GetRotation();
+    }
+}
+
+void DrawList::SelectLights(const std::vector<FrameLight>& frameLights, vec3 objectPos, LightUniformBlock& block)
+{
+    // Closest directional, then the 4 closest point and spot lights, by squared distance.
+    const int numSlots[] = { 1, 4, 4 };
+    const int firstSlot[] = { 0, 1, 5 };
+
+    int closest[LightUniformBlock::NumLights];
+    float closestDistSq[LightUniformBlock::NumLights];
+    int numFound[3] = { 0, 0, 0 };
+
+    for( int i=0; i<static_cast<int>( frameLights.size() ); i++ )
+    {
+        const FrameLight& light = frameLights[i];
+        int typeIndex = static_cast<int>( light.type );
+        int* pSlots = &closest[firstSlot[typeIndex]];
+        float* pDists = &closestDistSq[firstSlot[typeIndex]];
+        int& count = numFound[typeIndex];
+
+        float distSq = fastmath::DistanceSquared( light.position, objectPos );
+
+        // Insertion into a tiny sorted list, drop the farthest when full.
+        if( count == numSlots[typeIndex] && distSq >= pDists[count-1] )
+            continue;
+
+        int slot = count < numSlots[typeIndex] ? count++ : count - 1;
+        while( slot > 0 && pDists[slot-1] > distSq )
+        {
+            pSlots[slot] = pSlots[slot-1];
+            pDists[slot] = pDists[slot-1];
+            slot--;
+        }
+        pSlots[slot] = i;
+        pDists[slot] = distSq;
+    }
+
+    for( int type=0; type<3; type++ )
+    {
+        for( int i=0; i<numSlots[type]; i++ )
+        {
+            int slot = firstSlot[type] + i;
+
+            if( i < numFound[type] )
+            {
+                const FrameLight& light = frameLights[closest[slot]];
+                block.colors[slot] = light.color;
+                block.positions[slot] = light.position;
+                block.directions[slot] = light.direction;
+                block.radii[slot] = light.radius;
+                block.powerFactors[slot] = light.powerFactor;
+                block.spotCosCutoffs[slot] = light.spotCosCutoff;
+            }
+            else
+            {
+                // Black dummy so the shader loops don't need to know how many lights are real.
+                block.colors[slot] = vec4( 0, 0, 0, 1 );
+                block.positions[slot] = vec3( 0, 0, 0 );
+                block.directions[slot] = vec3( 0, 0, 0 );
+                block.radii[slot] = 0.0f;
+                block.powerFactors[slot] = 1.0f;
+                block.spotCosCutoffs[slot] = 1.0f;
+            }
+        }
+    }
+}
+
+uint64_t DrawList::CreateSortKey(Mesh* pMesh, Material* pMaterial)
+{
+    // Most expensive state change in the highest bits: program, then texture, then cubemap, then mesh buffers.
+    uint64_t program = pMaterial->GetShader() ? pMaterial->GetShader()->GetProgram() : 0;
+    uint64_t texture = pMaterial->GetTexture() ? pMaterial->GetTexture()->GetTextureID() : 0;
+    uint64_t cubemap = pMaterial->GetCubemap() ? pMaterial->GetCubemap()->GetTextureID() : 0;
+    uint64_t mesh = (reinterpret_cast<uintptr_t>( pMesh ) >> 4) & 0xFFFF;
+
+    return ((program & 0xFFFF) << 48) | ((texture & 0xFFFF) << 32) | ((cubemap & 0xFFFF) << 16) | mesh;
+}
+
+} // namespace fw
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Math/Vector.h"
+#include "Math/Matrix.h"
+#include "Components/ComponentPool.h"
+#include "Components/ComponentView.h"
+#include "Components/LightComponent.h"
+
+namespace fw {
+
+class Camera;
+class Component;
+class JobSystem;
+class Mesh;
+class Material;
+class TransformComponent;
+
+// Every enabled light with its transform, see ComponentManager::View().
+typedef ComponentView<LightComponent, TransformComponent> LightView;
+
+// A light resolved once per frame, shared read-only by every draw being prepared.
+struct FrameLight
+{
+    LightType type = LightType::PointLight;
+    vec4 color;
+    vec3 position;
+    vec3 direction;
+    float radius = 0.0f;
+    float powerFactor = 1.0f;
+    float spotCosCutoff = 1.0f;
+};
+
+// Light uniform values for a single draw.
+// Slot 0 is the closest directional light, then the 4 closest point lights, then the 4 closest spot lights.
+// Unused slots are black dummies, matching NUM_LIGHTS in the lit shaders.
+struct LightUniformBlock
+{
+    static const int NumLights = 9;
+
+    vec4 colors[NumLights];
+    vec3 positions[NumLights];
+    vec3 directions[NumLights];
+    float radii[NumLights];
+    float powerFactors[NumLights];
+    float spotCosCutoffs[NumLights];
+};
+
+// Everything the GL thread needs to issue one draw, fully resolved ahead of time.
+struct DrawCommand
+{
+    uint64_t sortKey = 0;
+
+    Mesh* pMesh = nullptr;
+    Material* pMaterial = nullptr;
+
+    matrix worldMatrix;
+    mat3 normalMatrix;
+    matrix wvpMatrix;
+
+    vec2 uvScale = vec2(1, 1);
+    vec2 uvOffset = vec2(0, 0);
+
+    bool hasLights = false;
+    LightUniformBlock lights;
+};
+
+class DrawList
+{
+public:
+    DrawList(JobSystem* pJobSystem = nullptr);
+    virtual ~DrawList();
+
+    // Builds one command per mesh component, spread across the job system when there are enough of them.
+    // transforms holds each mesh's own transform in the same order, see ComponentPool::GetTransforms().
+    // Transforms must already be up to date, nothing here touches GL.
+    void Build(Camera* pCamera, const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, const LightView& lights);
+
+    // Replays the commands, must be called on the thread that owns the GL context.
+    void Submit(Camera* pCamera);
+
+    // Draw order is submission order unless sorting is on, sorting groups draws by shader/texture/mesh.
+    void SetSortByState(bool sort) { m_SortByState = sort; }
+
+    const std::vector<DrawCommand>& GetCommands() { return m_Commands; }
+
+    static void GatherLights(const LightView& lights, std::vector<FrameLight>& frameLights);
+    static void SelectLights(const std::vector<FrameLight>& frameLights, vec3 objectPos, LightUniformBlock& block);
+    static uint64_t CreateSortKey(Mesh* pMesh, Material* pMaterial);
+
+protected:
+    void BuildRange(const ComponentRange<Component>& meshComponents, const ComponentRange<TransformComponent>& transforms, size_t start, size_t end);
+
+protected:
+    JobSystem* m_pJobSystem = nullptr;
+
+    std::vector<DrawCommand> m_Commands;
+    std::vector<FrameLight> m_FrameLights;
+
+    matrix m_ViewProjMatrix;
+
+    bool m_SortByState = false;
+};
+
+} // namespace fw
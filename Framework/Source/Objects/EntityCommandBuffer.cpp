@@ -0,0 +1,172 @@
+#include "CoreHeaders.h"
+
+#include "EntityCommandBuffer.h"
+#include "Components/Component.h"
+#include "GameObject.h"
+#include "Scene.h"
+
+namespace fw {
+
+EntityCommandBuffer::EntityCommandBuffer(Scene* pScene, JobSystem* pJobSystem)
+{
+    m_pScene = pScene;
+    m_pJobSystem = pJobSystem;
+}
+
+EntityCommandBuffer::~EntityCommandBuffer()
+{
+    Clear();
+}
+
+void EntityCommandBuffer::CreateObject(std::function<GameObject*(Scene*)> create)
+{
+    GetThreadCommands().creates.push_back(std::move(create));
+}
+
+void EntityCommandBuffer::DestroyObject(GameObject* pObject)
+{
+    Record(CommandType::DestroyObject, pObject, nullptr, false);
+}
+
+void EntityCommandBuffer::AddComponent(GameObject* pObject, Component* pComponent)
+{
+    Record(CommandType::AddComponent, pObject, pComponent, false);
+}
+
+void EntityCommandBuffer::RemoveComponent(GameObject* pObject, Component* pComponent)
+{
+    Record(CommandType::RemoveComponent, pObject, pComponent, false);
+}
+
+void EntityCommandBuffer::SetState(GameObject* pObject, bool isEnabled)
+{
+    Record(CommandType::SetState, pObject, nullptr, isEnabled);
+}
+
+void EntityCommandBuffer::Playback()
+{
+    assert(JobSystem::GetCurrentWorkerIndex() == 0);
+
+    m_NumPlayedBack = 0;
+
+    // A create can record more creates, so each list is swapped out before it's run, and that repeats until none are left.
+    bool ranCreates = true;
+    while (ranCreates)
+    {
+        ranCreates = false;
+        for (ThreadCommands& threadCommands : m_ThreadCommands)
+        {
+            if (threadCommands.creates.empty())
+                continue;
+
+            m_CreatesToRun.swap(threadCommands.creates);
+            for (std::function<GameObject*(Scene*)>& create : m_CreatesToRun)
+            {
+                GameObject* pObject = create(m_pScene);
+                m_pScene->AddObject(pObject);
+            }
+            m_NumPlayedBack += static_cast<unsigned int>(m_CreatesToRun.size());
+            m_CreatesToRun.clear();
+            ranCreates = true;
+        }
+    }
+
+    m_Commands.clear();
+    for (ThreadCommands& threadCommands : m_ThreadCommands)
+    {
+        m_Commands.insert(m_Commands.end(), threadCommands.commands.begin(), threadCommands.commands.end());
+        threadCommands.commands.clear();
+    }
+
+    if (m_Commands.empty())
+        return;
+
+    std::stable_sort(m_Commands.begin(), m_Commands.end(),
+        [](const Command& a, const Command& b) { return a.type < b.type; });
+
+    // Destroys are last, sort them by object so an object recorded more than once is only deleted once.
+    auto firstDestroy = std::find_if(m_Commands.begin(), m_Commands.end(),
+        [](const Command& command) { return command.type == CommandType::DestroyObject; });
+    std::sort(firstDestroy, m_Commands.end(),
+        [](const Command& a, const Command& b) { return a.pObject < b.pObject; });
+    m_Commands.erase(std::unique(firstDestroy, m_Commands.end(),
+        [](const Command& a, const Command& b) { return a.pObject == b.pObject; }), m_Commands.end());
+
+    for (const Command& command : m_Commands)
+    {
+        switch (command.type)
+        {
+        case CommandType::AddComponent:
+            command.pObject->AddComponent(command.pComponent);
+            break;
+
+        case CommandType::SetState:
+            command.pObject->SetState(command.isEnabled);
+            break;
+
+        case CommandType::RemoveComponent:
+            command.pObject->RemoveComponent(command.pComponent);
+            delete command.pComponent;
+            break;
+
+        case CommandType::DestroyObject:
+            if (command.pObject->GetHandle().IsValid())
+            {
+                m_pScene->RemoveObject(command.pObject);
+            }
+            delete command.pObject;
+            break;
+        }
+    }
+
+    m_NumPlayedBack += static_cast<unsigned int>(m_Commands.size());
+}
+
+void EntityCommandBuffer::Clear()
+{
+    for (ThreadCommands& threadCommands : m_ThreadCommands)
+    {
+        for (const Command& command : threadCommands.commands)
+        {
+            if (command.type == CommandType::AddComponent)
+            {
+                delete command.pComponent;
+            }
+        }
+
+        threadCommands.creates.clear();
+        threadCommands.commands.clear();
+    }
+}
+
+bool EntityCommandBuffer::IsEmpty() const
+{
+    for (const ThreadCommands& threadCommands : m_ThreadCommands)
+    {
+        if (!threadCommands.creates.empty() || !threadCommands.commands.empty())
+            return false;
+    }
+
+    return true;
+}
+
+EntityCommandBuffer::ThreadCommands& EntityCommandBuffer::GetThreadCommands()
+{
+    // Any other thread would share a worker index with the main thread.
+    assert(m_pJobSystem == nullptr || m_pJobSystem->IsOwnThread());
+
+    return m_ThreadCommands[JobSystem::GetCurrentWorkerIndex()];
+}
+
+void EntityCommandBuffer::Record(CommandType type, GameObject* pObject, Component* pComponent, bool isEnabled)
+{
+    Command command;
+    command.type = type;
+    command.pObject = pObject;
+    command.pComponent = pComponent;
+    command.isEnabled = isEnabled;
+
+    GetThreadCommands().commands.push_back(command);
+}
+
+} // namespace fw
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <functional>
+
+#include "Utility/JobSystem.h"
+
+namespace fw {
+
+class Component;
+class GameObject;
+class Scene;
+
+// Changes to a scene's GameObjects and their components, recorded wherever it isn't safe to make them (systems,
+// jobs, event handlers, loops over the scene's objects) and made all at once by Playback() on the main thread.
+// Scene::Update() plays its buffer back once the systems are done. Each thread records into its own lists,
+// so recording never waits on another thread, and the lists keep their memory from one frame to the next.
+class EntityCommandBuffer
+{
+public:
+    // Recording is allowed from the thread that created the job system and from its jobs.
+    EntityCommandBuffer(Scene* pScene, JobSystem* pJobSystem = nullptr);
+    virtual ~EntityCommandBuffer();
+
+    // create is called at playback, and the object it returns is added to the scene.
+    void CreateObject(std::function<GameObject*(Scene*)> create);
+
+    // Takes the object out of the scene, if it's in it, and deletes it. Recording the same object twice is fine.
+    void DestroyObject(GameObject* pObject);
+
+    void AddComponent(GameObject* pObject, Component* pComponent);
+
+    // Takes the component off the object and deletes it.
+    void RemoveComponent(GameObject* pObject, Component* pComponent);
+
+    void SetState(GameObject* pObject, bool isEnabled);
+
+    // Creates first, then component adds, state changes, component removes and destroys last, each group in the
+    // order it was recorded on each thread. Main thread only, with no jobs using the scene.
+    void Playback();
+
+    // Drops everything recorded, deleting the components that were waiting to be added.
+    // Objects waiting to be destroyed are left to whoever owns them, i.e. a scene that's being deleted.
+    void Clear();
+
+    bool IsEmpty() const;
+
+    // Commands applied by the last Playback().
+    unsigned int GetNumPlayedBack() const { return m_NumPlayedBack; }
+
+protected:
+    // In playback order.
+    enum class CommandType
+    {
+        AddComponent,
+        SetState,
+        RemoveComponent,
+        DestroyObject,
+    };
+
+    struct Command
+    {
+        CommandType type;
+        GameObject* pObject;
+        Component* pComponent;
+        bool isEnabled;
+    };
+
+    struct ThreadCommands
+    {
+        std::vector<std::function<GameObject*(Scene*)>> creates;
+        std::vector<Command> commands;
+    };
+
+    ThreadCommands& GetThreadCommands();
+    void Record(CommandType type, GameObject* pObject, Component* pComponent, bool isEnabled);
+
+protected:
+    Scene* m_pScene = nullptr;
+    JobSystem* m_pJobSystem = nullptr;
+
+    // Indexed by JobSystem::GetCurrentWorkerIndex(), gathered into m_Commands by Playback().
+    ThreadCommands m_ThreadCommands[JobSystem::MaxWorkers];
+    std::vector<Command> m_Commands;
+    std::vector<std::function<GameObject*(Scene*)>> m_CreatesToRun; // Swapped with a thread's list while it's run.
+
+    unsigned int m_NumPlayedBack = 0;
+};
+
+} // namespace fw
@@ -1,5 +1,6 @@
 #include "CoreHeaders.h"
 #include "FrameBufferObject.h"
+#include "Utility/Utility.h"
 
 namespace fw {
 
@@ -32,6 +33,7 @@ FrameBufferObject::FrameBufferObject(unsigned int width, unsigned int height, st
 
 FrameBufferObject::~FrameBufferObject()
 {
+    ShutdownReadbacks();
     Invalidate(true);
 }
 
@@ -263,6 +265,196 @@ void FrameBufferObject::Unbind()
     glBindFramebuffer( GL_FRAMEBUFFER, 0 );
 }
 
+bool FrameBufferObject::RequestReadback(int attachment, ReadbackCallback callback, ReadbackEncoding encoding)
+{
+    assert( attachment >= 0 && attachment < (int)m_ColorTextureIDs.size() );
+
+    // Fences need GL 3.2.
+    if( glFenceSync == 0 || m_FullyLoaded == false )
+        return false;
+
+    m_ReadbackStats.requested++;
+
+    ReadbackSlot& slot = m_ReadbackSlots[m_NextReadbackSlot];
+    if( slot.inFlight )
+    {
+        m_ReadbackStats.dropped++;
+        return false;
+    }
+
+    if( m_ReadbackWorker.joinable() == false )
+    {
+        m_ReadbackWorkerQuit = false;
+        m_ReadbackWorker = std::thread( &FrameBufferObject::ReadbackWorkerMain, this );
+    }
+
+    GLsizeiptr size = (GLsizeiptr)m_RequestedWidth * m_RequestedHeight * 4;
+
+    if( slot.bufferID == 0 )
+    {
+        glGenBuffers( 1, &slot.bufferID );
+    }
+
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, slot.bufferID );
+    if( slot.bufferSize < size )
+    {
+        glBufferData( GL_PIXEL_PACK_BUFFER, size, 0, GL_STREAM_READ );
+        slot.bufferSize = size;
+    }
+
+    GLint lastFrameBuffer;
+    glGetIntegerv( GL_FRAMEBUFFER_BINDING, &lastFrameBuffer );
+
+    // With a pack buffer bound glReadPixels only queues a copy, it doesn't wait for the GPU.
+    glBindFramebuffer( GL_FRAMEBUFFER, m_FrameBufferID );
+    glReadBuffer( GL_COLOR_ATTACHMENT0 + attachment );
+    glReadPixels( 0, 0, m_RequestedWidth, m_RequestedHeight, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+    glBindFramebuffer( GL_FRAMEBUFFER, lastFrameBuffer );
+
+    slot.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    slot.inFlight = true;
+    slot.frameRequested = m_ReadbackFrame;
+    slot.callback = callback;
+    slot.result = ReadbackResult();
+    slot.result.attachment = attachment;
+    slot.result.width = m_RequestedWidth;
+    slot.result.height = m_RequestedHeight;
+    slot.result.encoding = encoding;
+    slot.result.frameRequested = m_ReadbackFrame;
+
+    m_NextReadbackSlot = (m_NextReadbackSlot + 1) % NumReadbackBuffers;
+
+    return true;
+}
+
+void FrameBufferObject::ProcessReadbacks(bool waitForAll)
+{
+    m_ReadbackFrame++;
+
+    // The slot that will be used next is the oldest one, go through them in the order they were requested.
+    for( int i=0; i<NumReadbackBuffers; i++ )
+    {
+        ReadbackSlot& slot = m_ReadbackSlots[(m_NextReadbackSlot + i) % NumReadbackBuffers];
+        if( slot.inFlight == false )
+            continue;
+
+        GLenum status = glClientWaitSync( slot.fence, 0, 0 );
+
+        if( status == GL_TIMEOUT_EXPIRED )
+        {
+            // Later copies can't be done before this one, try again next frame.
+            if( waitForAll == false && m_ReadbackFrame - slot.frameRequested < (unsigned int)NumReadbackBuffers )
+                break;
+
+            m_ReadbackStats.stalled++;
+            status = glClientWaitSync( slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 ); // 1 second.
+        }
+
+        if( status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED )
+        {
+            assert( false );
+            break;
+        }
+
+        glDeleteSync( slot.fence );
+        slot.fence = 0;
+
+        // Copy out of the mapped buffer so it can be reused right away.
+        GLsizeiptr size = (GLsizeiptr)slot.result.width * slot.result.height * 4;
+
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, slot.bufferID );
+        const unsigned char* pPixels = (const unsigned char*)glMapBufferRange( GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT );
+        if( pPixels )
+        {
+            slot.result.data.assign( pPixels, pPixels + size );
+            glUnmapBuffer( GL_PIXEL_PACK_BUFFER );
+        }
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+        slot.inFlight = false;
+
+        if( pPixels == nullptr )
+            continue;
+
+        {
+            std::lock_guard<std::mutex> lock( m_ReadbackMutex );
+
+            ReadbackJob job;
+            job.callback = std::move( slot.callback );
+            job.result = std::move( slot.result );
+            m_ReadbackJobs.push_back( std::move( job ) );
+        }
+        m_ReadbackCondition.notify_one();
+
+        m_ReadbackStats.delivered++;
+    }
+}
+
+void FrameBufferObject::ReadbackWorkerMain()
+{
+    while( true )
+    {
+        ReadbackJob job;
+
+        {
+            std::unique_lock<std::mutex> lock( m_ReadbackMutex );
+            m_ReadbackCondition.wait( lock, [this]() { return m_ReadbackWorkerQuit || m_ReadbackJobs.empty() == false; } );
+
+            // Only quit once everything queued has been delivered.
+            if( m_ReadbackJobs.empty() )
+                return;
+
+            job = std::move( m_ReadbackJobs.front() );
+            m_ReadbackJobs.pop_front();
+        }
+
+        if( job.result.encoding == ReadbackEncoding::PNG )
+        {
+            std::vector<unsigned char> png;
+            EncodePNG( &job.result.data[0], job.result.width, job.result.height, true, png );
+            job.result.data.swap( png );
+        }
+
+        if( job.callback )
+        {
+            job.callback( job.result );
+        }
+    }
+}
+
+void FrameBufferObject::ShutdownReadbacks()
+{
+    bool hasBuffers = false;
+    for( ReadbackSlot& slot : m_ReadbackSlots )
+    {
+        hasBuffers |= slot.bufferID != 0;
+    }
+
+    if( hasBuffers )
+    {
+        ProcessReadbacks( true );
+
+        for( ReadbackSlot& slot : m_ReadbackSlots )
+        {
+            glDeleteBuffers( 1, &slot.bufferID );
+            slot.bufferID = 0;
+            slot.bufferSize = 0;
+        }
+    }
+
+    if( m_ReadbackWorker.joinable() )
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_ReadbackMutex );
+            m_ReadbackWorkerQuit = true;
+        }
+        m_ReadbackCondition.notify_one();
+        m_ReadbackWorker.join();
+    }
+}
+
 void FrameBufferObject::Invalidate(bool cleanGLAllocs)
 {
     if( m_HasValidResources == false )
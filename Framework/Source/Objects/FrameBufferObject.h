@@ -1,9 +1,45 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 namespace fw {
 
+enum class ReadbackEncoding
+{
+    Raw, // Tightly packed RGBA8, bottom row first like GL.
+    PNG, // A complete PNG file, top row first.
+};
+
+struct ReadbackResult
+{
+    int attachment = 0;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    ReadbackEncoding encoding = ReadbackEncoding::Raw;
+    unsigned int frameRequested = 0;
+    std::vector<unsigned char> data;
+};
+
+// Called on the readback worker thread, never the GL thread.
+typedef std::function<void(ReadbackResult& result)> ReadbackCallback;
+
+struct ReadbackStats
+{
+    unsigned int requested = 0;
+    unsigned int dropped = 0;   // No free buffer in the ring when requested.
+    unsigned int stalled = 0;   // Had to wait on the GPU because the ring was too far behind.
+    unsigned int delivered = 0; // Handed to the worker.
+};
+
 class FrameBufferObject
 {
+public:
+    static const int NumReadbackBuffers = 3;
+
 public:
     enum FBOColorFormat
     {
@@ -34,11 +70,24 @@ public:
     float GetWidthRatio() { return (float)m_RequestedWidth / m_TextureWidth; }
     float GetHeightRatio() { return (float)m_RequestedHeight / m_TextureHeight; }
 
+    // Queues a copy of a color attachment into a pixel buffer without stalling the pipeline.
+    // The pixels reach the callback a few frames later, returns false if all buffers are in flight.
+    bool RequestReadback(int attachment, ReadbackCallback callback, ReadbackEncoding encoding = ReadbackEncoding::Raw);
+
+    // Call once per frame on the GL thread, hands finished copies to the worker.
+    // Copies that are more than NumReadbackBuffers frames old are waited on.
+    void ProcessReadbacks(bool waitForAll = false);
+
+    const ReadbackStats& GetReadbackStats() { return m_ReadbackStats; }
+
 protected:
     void Setup(unsigned int width, unsigned int height, std::vector<FBOColorFormat> colorFormats, int depthBits, int minFilter, int magFilter, bool depthReadable);
     void Invalidate(bool cleanGLAllocs);
     bool Create();
 
+    void ReadbackWorkerMain();
+    void ShutdownReadbacks();
+
 protected:
     bool m_HasValidResources;
     bool m_FullyLoaded;
@@ -63,6 +112,36 @@ protected:
     bool m_DepthIsTexture;
 
     GLuint m_FrameBufferID;
+
+    // Ring of pixel pack buffers, each waiting on a fence until the GPU has written it.
+    struct ReadbackSlot
+    {
+        GLuint bufferID = 0;
+        GLsizeiptr bufferSize = 0;
+        GLsync fence = 0;
+        bool inFlight = false;
+        unsigned int frameRequested = 0;
+        ReadbackCallback callback;
+        ReadbackResult result;
+    };
+
+    ReadbackSlot m_ReadbackSlots[NumReadbackBuffers];
+    int m_NextReadbackSlot = 0;
+    unsigned int m_ReadbackFrame = 0;
+    ReadbackStats m_ReadbackStats;
+
+    // Encoding and callbacks run on a worker so a capture every frame doesn't cost the GL thread.
+    struct ReadbackJob
+    {
+        ReadbackCallback callback;
+        ReadbackResult result;
+    };
+
+    std::thread m_ReadbackWorker;
+    std::mutex m_ReadbackMutex;
+    std::condition_variable m_ReadbackCondition;
+    std::deque<ReadbackJob> m_ReadbackJobs;
+    bool m_ReadbackWorkerQuit = false;
 };
 
 } // namespace fw
@@ -9,6 +9,7 @@
 #include "Components/ComponentManager.h"
 #include "Physics/PhysicsBody.h"
 #include "Scene.h"
+#include "Utility/SlabAllocator.h"
 
 namespace fw {
 
@@ -21,24 +22,31 @@ GameObject::GameObject(Scene* pScene, vec3 pos, vec3 rot)
 
 GameObject::~GameObject()
 {
-    for (auto pComponent : m_pComponents)
+    // Views see an object without components and drop it on the first removal, before anything is deleted.
+    m_ComponentMask = 0;
+
+    Component* pNextComponent = nullptr;
+    for (Component* pComponent = m_pFirstComponent; pComponent != nullptr; pComponent = pNextComponent)
     {
-        if (pComponent != nullptr)
-        {
-			if (pComponent->GetType() == MeshComponent::GetStaticType())
-			{
-				if (m_enabled)
-				{
-					m_pScene->GetComponentManager()->RemoveComponent(pComponent);
-				}
-			}
-			else
-			{
-				m_pScene->GetComponentManager()->RemoveComponent(pComponent);
-			}
-            delete pComponent;
-        }
+        pNextComponent = pComponent->m_pNextOnGameObject;
+
+        m_pScene->GetComponentManager()->RemoveComponent(pComponent);
+        delete pComponent;
     }
+
+    // Last, views find their rows by the transform's handle.
+    m_pScene->GetComponentManager()->RemoveComponent(m_pTransform);
+    delete m_pTransform;
+}
+
+void* GameObject::operator new(size_t size)
+{
+    return SlabArena::Allocate(GetSlabTypeID<GameObject>("GameObject"), size);
+}
+
+void GameObject::operator delete(void* p, size_t size)
+{
+    SlabArena::Free(GetSlabTypeID<GameObject>("GameObject"), p, size);
 }
 
 void GameObject::SetState(bool isEnabled)
@@ -52,19 +60,12 @@ void GameObject::SetState(bool isEnabled)
             pPhysicsBody->GetPhysicsBody()->SetState(isEnabled);
 		}
 
-		MeshComponent* pMesh = GetComponent<fw::MeshComponent>();
-
-		if (pMesh)
-		{
-			if (isEnabled)
-			{
-				AddCompFromManager(pMesh);
-			}
-			else
-			{
-				RemoveCompFromManager(pMesh);
-			}
-		}
+        // The transform stays enabled, children still need it. The rest stay in the manager, so this is O(1) each.
+        ComponentManager* pManager = m_pScene->GetComponentManager();
+        for (Component* pComponent = m_pFirstComponent; pComponent != nullptr; pComponent = pComponent->m_pNextOnGameObject)
+        {
+            pManager->SetComponentEnabled(pComponent, isEnabled);
+        }
 	}
 
 	m_enabled = isEnabled;
@@ -73,34 +74,102 @@ void GameObject::SetState(bool isEnabled)
 void GameObject::AddComponent(Component* pComponent)
 {
     pComponent->SetGameObject(this);
-	if (m_enabled)
+
+	// Only the first of each type is found by GetComponent, same as the old linear search.
+	ComponentTypeID typeID = pComponent->GetTypeID();
+	if (m_pComponentSlots[typeID] == nullptr)
 	{
-		m_pScene->GetComponentManager()->AddComponent(pComponent);
+		m_pComponentSlots[typeID] = pComponent;
+		m_ComponentMask |= 1u << typeID;
 	}
 
-    m_pComponents.push_back(pComponent);
-}
-
-void GameObject::AddCompFromManager(Component* pComponent)
-{
 	m_pScene->GetComponentManager()->AddComponent(pComponent);
+
+	// The transform is only reached through m_pTransform, and never disabled.
+	if (pComponent == m_pTransform)
+	{
+		return;
+	}
+
+	if (!m_enabled)
+	{
+		m_pScene->GetComponentManager()->SetComponentEnabled(pComponent, false);
+	}
+
+    if (m_pLastComponent)
+    {
+        m_pLastComponent->m_pNextOnGameObject = pComponent;
+    }
+    else
+    {
+        m_pFirstComponent = pComponent;
+    }
+    m_pLastComponent = pComponent;
 }
 
-void GameObject::RemoveCompFromManager(Component* pComponent)
+void GameObject::RemoveComponent(Component* pComponent)
 {
-	m_pScene->GetComponentManager()->RemoveComponent(pComponent);
+    assert(pComponent != m_pTransform);
+
+    Component* pPrevious = nullptr;
+    Component* pCurrent = m_pFirstComponent;
+    while (pCurrent != pComponent)
+    {
+        // Assert that the component *was* on this object.
+        assert(pCurrent != nullptr);
+
+        pPrevious = pCurrent;
+        pCurrent = pCurrent->m_pNextOnGameObject;
+    }
+
+    if (pPrevious)
+    {
+        pPrevious->m_pNextOnGameObject = pComponent->m_pNextOnGameObject;
+    }
+    else
+    {
+        m_pFirstComponent = pComponent->m_pNextOnGameObject;
+    }
+    if (m_pLastComponent == pComponent)
+    {
+        m_pLastComponent = pPrevious;
+    }
+    pComponent->m_pNextOnGameObject = nullptr;
+
+    // GetComponent finds the next one of the same type, if there is one.
+    ComponentTypeID typeID = pComponent->GetTypeID();
+    if (m_pComponentSlots[typeID] == pComponent)
+    {
+        m_pComponentSlots[typeID] = nullptr;
+        m_ComponentMask &= ~(1u << typeID);
+
+        for (Component* pOther = m_pFirstComponent; pOther != nullptr; pOther = pOther->m_pNextOnGameObject)
+        {
+            if (pOther->GetTypeID() == typeID)
+            {
+                m_pComponentSlots[typeID] = pOther;
+                m_ComponentMask |= 1u << typeID;
+                break;
+            }
+        }
+    }
+
+    m_pScene->GetComponentManager()->RemoveComponent(pComponent);
+    pComponent->SetGameObject(nullptr);
 }
 
 Component* GameObject::GetComponent(const char* component)
 {
-	for (auto pComponent : m_pComponents)
+	ComponentTypeID typeID = FindComponentType(component);
+	if (typeID == InvalidComponentTypeID)
 	{
-		if (pComponent->GetType() == component)
-		{
-			return pComponent;
-		}
+		return nullptr;
 	}
-    return nullptr;
+
+#if FW_CHECK_SYSTEM_ACCESS
+	CheckSystemAccess(typeID, false);
+#endif
+	return m_pComponentSlots[typeID];
 }
 
 void GameObject::SetPosition(vec3 pos)
@@ -213,7 +282,11 @@ void GameObject::Editor_OutputObjectDetails()
 	else
 	{
 		m_pTransform->SetPosition(pos);
-		m_pTransform->SetRotation(rot);
+		// Only when edited, so a transform in quaternion mode isn't switched back to Euler angles.
+		if (rot != m_pTransform->GetRotation())
+		{
+			m_pTransform->SetRotation(rot);
+		}
 		m_pTransform->SetScale(scale);
 	}
 }
@@ -11,12 +11,26 @@ class Scene;
 
 class GameObject
 {
+    friend class Scene;
+
 protected:
 	std::string m_name;
     Scene* m_pScene = nullptr;
 
+    // Set while the object is in its scene's object list.
+    Handle m_Handle;
+
 	TransformComponent* m_pTransform = nullptr;
-    std::vector<Component*> m_pComponents;
+
+    // Linked through the components themselves, so creating a GameObject doesn't allocate a list.
+    // Everything but the transform, SetState() walks it and doesn't need to touch that.
+    Component* m_pFirstComponent = nullptr;
+    Component* m_pLastComponent = nullptr;
+
+    // The first component of each type by ComponentTypeID, and a bit per type that's present.
+    Component* m_pComponentSlots[MaxComponentTypes] = {};
+    uint32_t m_ComponentMask = 0;
+    static_assert(MaxComponentTypes <= 32, "m_ComponentMask needs a bit per component type.");
 
 	bool m_enabled = true;
 
@@ -24,26 +38,43 @@ public:
     GameObject(Scene* pScene, vec3 pos, vec3 rot);
     virtual ~GameObject();
 
+    // Allocated from the current SlabArena, see Utility/SlabAllocator.h.
+    static void* operator new(size_t size);
+    static void operator delete(void* p, size_t size);
+
+	// Disabled objects keep their components in the manager, switched off, so toggling pooled objects is cheap.
 	void SetState(bool isEnabled);
 
     void AddComponent(Component* pComponent);
-	void AddCompFromManager(Component* pComponent);
-    void RemoveCompFromManager(Component* pComponent);
+
+    // Takes the component off the object and out of the manager, the caller owns it after. Not for the transform.
+    void RemoveComponent(Component* pComponent);
 	Component* GetComponent(const char* component);
 
+	// The first component of a type, by ID.
+	Component* GetComponent(ComponentTypeID typeID)
+	{
+#if FW_CHECK_SYSTEM_ACCESS
+		CheckSystemAccess(typeID, false);
+#endif
+		return m_pComponentSlots[typeID];
+	}
+
 	template <class Type> Type* GetComponent()
 	{
-		for (Component* pComponent : m_pComponents)
-		{
-			if (pComponent->GetType() == Type::GetStaticType())
-			{
-				return static_cast<Type*>(pComponent);
-			}
-		}
-
-		return nullptr;
+#if FW_CHECK_SYSTEM_ACCESS
+		CheckSystemAccess(GetComponentTypeID<Type>(), false);
+#endif
+		return static_cast<Type*>(m_pComponentSlots[GetComponentTypeID<Type>()]);
+	}
+
+	template <class Type> bool HasComponent()
+	{
+		return (m_ComponentMask & (1u << GetComponentTypeID<Type>())) != 0;
 	}
 
+	uint32_t GetComponentMask() { return m_ComponentMask; }
+
     // Getters.
 	TransformComponent* GetTransform() { return m_pTransform; }
 
@@ -57,6 +88,9 @@ public:
 
     Scene* GetScene() { return m_pScene; }
 
+    // Resolves through Scene::GetGameObject() until the object is removed from the scene.
+    Handle GetHandle() const { return m_Handle; }
+
     // Setters.
 	void SetName(std::string name) { m_name = name; }
 
@@ -64,6 +98,9 @@ public:
 	void SetRotation(vec3 rot);
     void SetScale(vec3 scale) { m_pTransform->SetScale(scale); }
 
+    // Position, rotation and scale become relative to the parent, nullptr makes this a root again.
+    void SetParent(GameObject* pParent) { m_pTransform->SetParent(pParent ? pParent->GetTransform() : nullptr); }
+
 	void Editor_OutputObjectDetails();
 };
 
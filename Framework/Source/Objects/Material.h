@@ -26,6 +26,8 @@ public:
     Color4f GetColor() { return m_color; };
     Texture* GetCubemap() { return m_pCubemap; };
 
+    // Setters.
+    void SetCubemap(Texture* pCubemap) { m_pCubemap = pCubemap; }
 };
 
 } // namespace fw
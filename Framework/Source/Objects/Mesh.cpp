@@ -7,6 +7,8 @@
 #include "ShaderProgram.h"
 #include "Texture.h"
 #include "Material.h"
+#include "DrawList.h"
+#include "GL/GLRecorder.h"
 #include "Utility/Utility.h"
 #include "Math/Matrix.h"
 #include "Math/MathHelpers.h"
@@ -14,6 +16,9 @@
 
 namespace fw {
 
+// Meshes with more vertices than this don't keep a CPU copy for occlusion culling.
+static const size_t c_MaxOccluderVerts = 4096;
+
 Mesh::Mesh()
 {
 }
@@ -28,6 +33,11 @@ Mesh::Mesh(GLenum primitiveType, const std::vector<VertexFormat>& verts, const s
     Rebuild(primitiveType, verts, indices);
 }
 
+Mesh::Mesh(GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices, unsigned int numIndices)
+{
+    Rebuild(primitiveType, pVerts, numVerts, pIndices, numIndices);
+}
+
 Mesh::~Mesh()
 {
     // Release the memory.
@@ -59,12 +69,18 @@ void Mesh::SetupUniform(ShaderProgram* pShader, char* name, vec4 value)
     glUniform4f(location, value.x, value.y, value.z, value.w);
 }
 
-void Mesh::SetupUniform(ShaderProgram* pShader, char* name, matrix matrix)
+void Mesh::SetupUniform(ShaderProgram* pShader, char* name, const matrix& matrix)
 {
     GLint location = glGetUniformLocation(pShader->GetProgram(), name);
     glUniformMatrix4fv(location, 1, false, &matrix.m11);
 }
 
+void Mesh::SetupUniform(ShaderProgram* pShader, char* name, const mat3& matrix)
+{
+    GLint location = glGetUniformLocation(pShader->GetProgram(), name);
+    glUniformMatrix3fv(location, 1, false, &matrix.m11);
+}
+
 void Mesh::SetupUniform(ShaderProgram* pShader, char* name, std::vector<float> value)
 {
     GLint location = glGetUniformLocation(pShader->GetProgram(), name);
@@ -99,8 +115,54 @@ void Mesh::SetupAttribute(ShaderProgram* pShader, char* name, int size, GLenum t
     }
 }
 
-void Mesh::Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const matrix& worldMat, const matrix& normalMat, vec2 uvScale, vec2 uvOffset, float time)
+void Mesh::SetupUniform(ShaderProgram* pShader, char* name, const float* values, int count)
+{
+    GLint location = glGetUniformLocation(pShader->GetProgram(), name);
+    glUniform1fv(location, count, values);
+}
+
+void Mesh::SetupUniform(ShaderProgram* pShader, char* name, const vec3* values, int count)
+{
+    GLint location = glGetUniformLocation(pShader->GetProgram(), name);
+    glUniform3fv(location, count, &values[0].x);
+}
+
+void Mesh::SetupUniform(ShaderProgram* pShader, char* name, const vec4* values, int count)
+{
+    GLint location = glGetUniformLocation(pShader->GetProgram(), name);
+    glUniform4fv(location, count, &values[0].x);
+}
+
+void Mesh::Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const matrix& worldMat, const mat3& normalMat, vec2 uvScale, vec2 uvOffset, float time)
+{
+    DrawCommand command;
+    command.pMesh = this;
+    command.pMaterial = pMaterial;
+    command.worldMatrix = worldMat;
+    command.normalMatrix = normalMat;
+    command.wvpMatrix = pCamera->GetProjecMatrix() * pCamera->GetViewMatrix() * worldMat;
+    command.uvScale = uvScale;
+    command.uvOffset = uvOffset;
+
+    if (pParent)
+    {
+        LightView lights = pCamera->GetScene()->GetComponentManager()->View<LightComponent, TransformComponent>();
+
+        if (!lights.empty())
+        {
+            std::vector<FrameLight> frameLights;
+            DrawList::GatherLights(lights, frameLights);
+            DrawList::SelectLights(frameLights, pParent->GetTransform()->GetPosition(), command.lights);
+            command.hasLights = true;
+        }
+    }
+
+    Draw(pCamera, command);
+}
+
+void Mesh::Draw(Camera* pCamera, const DrawCommand& command)
 {
+    Material* pMaterial = command.pMaterial;
     ShaderProgram* pShader = pMaterial->GetShader();
     Texture* pTexture = pMaterial->GetTexture();
 
@@ -118,83 +180,41 @@ void Mesh::Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const
     // Setup the uniforms.
     glUseProgram(pShader->GetProgram());
 
-    // Matrix uniforms.
-    SetupUniform(pShader, "u_WorldMatrix", worldMat);
+    // Matrix uniforms, already resolved when the command was built.
+    SetupUniform(pShader, "u_WorldMatrix", command.worldMatrix);
     SetupUniform(pShader, "u_ViewMatrix", pCamera->GetViewMatrix());
     SetupUniform(pShader, "u_ProjecMatrix", pCamera->GetProjecMatrix());
 
-    SetupUniform(pShader, "u_WVPMatrix", pCamera->GetProjecMatrix() * pCamera->GetViewMatrix() * worldMat);
+    SetupUniform(pShader, "u_WVPMatrix", command.wvpMatrix);
 
-    SetupUniform(pShader, "u_NormalMatrix", normalMat);
+    SetupUniform(pShader, "u_NormalMatrix", command.normalMatrix);
 
     // UV uniforms.
-    SetupUniform( pShader, "u_UVScale", uvScale );
-    SetupUniform( pShader, "u_UVOffset", uvOffset );
+    SetupUniform( pShader, "u_UVScale", command.uvScale );
+    SetupUniform( pShader, "u_UVOffset", command.uvOffset );
     
     // Misc uniforms.
     SetupUniform(pShader, "u_Time", (float)GetSystemTimeSinceGameStart());
 
     SetupUniform(pShader, "u_MaterialColor", vec4(pMaterial->GetColor().r, pMaterial->GetColor().g, pMaterial->GetColor().b, pMaterial->GetColor().a));
 
-    if (pParent)
+    if (command.hasLights)
     {
-        vec3 objectPos = pParent->GetTransform()->GetPosition();
-
-        std::vector<Component*>& lights = pCamera->GetScene()->GetComponentManager()->GetComponentsOfType(LightComponent::GetStaticType());
+        const LightUniformBlock& lights = command.lights;
 
-        if (!lights.empty())
-        {
-            m_numDirecLights = 0;
-            m_numPointLights = 0;
-            m_numSpotLights = 0;
+        SetupUniform(pShader, "u_CamPos", pCamera->GetPosition());
 
-            for (int i = 0; i < lights.size(); i++)
-            {
-                LightComponent* light = static_cast<LightComponent*>(lights[i]);
-                vec3 lightPos = lights[i]->GetGameObject()->GetPosition();
+        SetupUniform(pShader, "u_LightColors", lights.colors, LightUniformBlock::NumLights);
+        SetupUniform(pShader, "u_LightPositions", lights.positions, LightUniformBlock::NumLights);
+        SetupUniform(pShader, "u_lightRotations", lights.directions, LightUniformBlock::NumLights);
+        SetupUniform(pShader, "u_LightRadii", lights.radii, LightUniformBlock::NumLights);
+        SetupUniform(pShader, "u_LightPowerFactors", lights.powerFactors, LightUniformBlock::NumLights);
+        SetupUniform(pShader, "u_SpotCosCutoff", lights.spotCosCutoffs, LightUniformBlock::NumLights);
 
-                switch (light->GetDetails()->type)
-                {
-                    case LightType::Directional:
-                        FindClosestLights(LightType::Directional, lights, objectPos, i);
-                        m_numDirecLights++;
-                        break;
-                    case LightType::PointLight:
-                        FindClosestLights(LightType::PointLight, lights, objectPos, i);
-                        m_numPointLights++;
-                        break;
-                    case LightType::SpotLight:
-                        FindClosestLights(LightType::SpotLight, lights, objectPos, i);
-                        m_numSpotLights++;
-                        break;
-                }
-            }
-            
-            m_lightColors.clear();
-            m_lightPositions.clear();
-            m_lightRotations.clear();
-            m_lightRadii.clear();
-            m_lightPowerFactors.clear();
-            m_spotCutOffs.clear();
-
-            FillClosestLights(LightType::Directional, lights);
-            FillClosestLights(LightType::PointLight, lights);
-            FillClosestLights(LightType::SpotLight, lights);
-
-            SetupUniform(pShader, "u_CamPos", pCamera->GetPosition());
-
-            SetupUniform(pShader, "u_LightColors", m_lightColors);
-            SetupUniform(pShader, "u_LightPositions", m_lightPositions);
-            SetupUniform(pShader, "u_lightRotations", m_lightRotations);
-            SetupUniform(pShader, "u_LightRadii", m_lightRadii);
-            SetupUniform(pShader, "u_LightPowerFactors", m_lightPowerFactors);
-            SetupUniform(pShader, "u_SpotCosCutoff", m_spotCutOffs);
-
-            SetupUniform(pShader, "u_LightColor", m_lightColors[0]);
-            SetupUniform(pShader, "u_LightPos", m_lightPositions[0]);
-            SetupUniform(pShader, "u_LightRadius", m_lightRadii[0]);
-            SetupUniform(pShader, "u_LightPowerFactor", m_lightPowerFactors[0]);
-        }
+        SetupUniform(pShader, "u_LightColor", lights.colors[0]);
+        SetupUniform(pShader, "u_LightPos", lights.positions[0]);
+        SetupUniform(pShader, "u_LightRadius", lights.radii[0]);
+        SetupUniform(pShader, "u_LightPowerFactor", lights.powerFactors[0]);
     }
 
     GLint hasTexture = glGetUniformLocation(pShader->GetProgram(), "u_HasTexture");
@@ -227,163 +247,57 @@ void Mesh::Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const
     // Draw the primitive.
     if (m_NumIndices > 0)
     {
+        GLRecorder::RecordDraw(m_PrimitiveType, m_NumIndices);
         glDrawElements(m_PrimitiveType, m_NumIndices, GL_UNSIGNED_INT, 0);
     }
     else
     {
+        GLRecorder::RecordDraw(m_PrimitiveType, m_NumVerts);
         glDrawArrays( m_PrimitiveType, 0, m_NumVerts );
     }
 }
 
-void Mesh::FindClosestLights(LightType type, std::vector<Component*>& lights, vec3& objectPos, int index)
+void Mesh::Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts)
 {
-    LightComponent* light = static_cast<LightComponent*>(lights[index]);
-    vec3 lightPos = light->GetGameObject()->GetPosition();
-    unsigned int* closestLights;
-    unsigned int closestLightsSize = 0;
-    unsigned int numLightsFound = 0;
-
-    switch (type)
-    {
-        case LightType::Directional:
-            if (index != m_closestDirecLight)
-            {
-                if (m_numDirecLights == 0 || lightPos.DistanceFrom(objectPos) < lights[m_closestDirecLight]->GetGameObject()->GetPosition().DistanceFrom(objectPos))
-                {
-                    m_closestDirecLight = index;
-                }
-            }
-            break;
-
-        case LightType::PointLight:
-            closestLights = &m_closestPoint[0];
-            closestLightsSize = m_closestPoint.size();
-            numLightsFound = m_numPointLights;
-
-        case LightType::SpotLight:
-            if (type == LightType::SpotLight)
-            {
-                closestLights = &m_closestSpot[0];
-                closestLightsSize = m_closestSpot.size();
-                numLightsFound = m_numSpotLights;
-            }
-
-            if (numLightsFound < closestLightsSize)
-            {
-                closestLights[numLightsFound] = index;
-            }
-            else
-            {
-                for (size_t i = 0; i < closestLightsSize; i++)
-                {
-                    if (lightPos.DistanceFrom(objectPos) < lights[closestLights[i]]->GetGameObject()->GetPosition().DistanceFrom(objectPos))
-                    {
-                        closestLights[i] = index;
-                        break;
-                    }
-                }
-
-            }
-            break;
-    }
+    Rebuild(primitiveType, verts.data(), (unsigned int)verts.size());
 }
 
-void Mesh::FillClosestLights(LightType type, std::vector<Component*>& lights)
+void Mesh::Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts, const std::vector<unsigned int>& indices)
 {
-    unsigned int* closestLights = nullptr;
-    unsigned int closestLightsSize = 0;
-    int numDummies = 0;
-
-    switch (type)
-    {
-        case fw::LightType::Directional:
-            closestLights = &m_closestDirecLight;
-            closestLightsSize = 1;
-
-            if (m_numDirecLights == 0)
-            {
-                numDummies = 1;
-            }
-            break;
+    Rebuild(primitiveType, verts.data(), (unsigned int)verts.size());
+    RebuildIndices(indices.data(), (unsigned int)indices.size());
+}
 
-        case fw::LightType::PointLight:
-            closestLights = &m_closestPoint[0];
-            closestLightsSize = m_closestPoint.size();
+void Mesh::Rebuild(GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices, unsigned int numIndices)
+{
+    glDeleteBuffers(1, &m_VBO);
 
-            if (m_numPointLights < 4)
-            {
-                numDummies = 4 - m_numPointLights;
-            }
-            break;
+    m_PrimitiveType = primitiveType;
 
-        case fw::LightType::SpotLight:
-            closestLights = &m_closestSpot[0];
-            closestLightsSize = m_closestSpot.size();
+    m_NumVerts = (int)numVerts;
 
-            if (m_numSpotLights < 4)
-            {
-                numDummies = 4 - m_numSpotLights;
-            }
-            break;
+    // Calculate the local space bounds.
+    m_BoundsMin = numVerts == 0 ? vec3(0, 0, 0) : pVerts[0].pos;
+    m_BoundsMax = m_BoundsMin;
+    for (unsigned int i = 0; i < numVerts; i++)
+    {
+        const VertexFormat& vert = pVerts[i];
+        m_BoundsMin = vec3(vert.pos.x < m_BoundsMin.x ? vert.pos.x : m_BoundsMin.x, vert.pos.y < m_BoundsMin.y ? vert.pos.y : m_BoundsMin.y, vert.pos.z < m_BoundsMin.z ? vert.pos.z : m_BoundsMin.z);
+        m_BoundsMax = vec3(vert.pos.x > m_BoundsMax.x ? vert.pos.x : m_BoundsMax.x, vert.pos.y > m_BoundsMax.y ? vert.pos.y : m_BoundsMax.y, vert.pos.z > m_BoundsMax.z ? vert.pos.z : m_BoundsMax.z);
     }
 
-    LightComponent* light;
-    Color4f color;
-    vec3 pos;
-    vec3 rot;
-    float cutOff = 0.f;
-
-    Color4f dummyColor = Color4f(0.f, 0.f, 0.f, 1.f);
-    LightComponent* dummy = new LightComponent(type, dummyColor, 0.f, 1.f);
-
-    for (size_t i = 0; i < closestLightsSize; i++)
+    // Keep the positions of small triangle meshes around for occluder rasterization.
+    m_OccluderPositions.clear();
+    m_OccluderIndices.clear();
+    if (primitiveType == GL_TRIANGLES && numVerts <= c_MaxOccluderVerts)
     {
-        if (i < closestLightsSize - numDummies)
+        for (unsigned int i = 0; i < numVerts; i++)
         {
-            light = static_cast<LightComponent*>(lights[closestLights[i]]);
-            color = light->GetDetails()->diffuse;
-            pos = light->GetGameObject()->GetPosition();
-            rot = light->GetGameObject()->GetRotation();
-            matrix normalMatrix;
-            normalMatrix.CreateRotation(rot);
-            if (type == LightType::Directional)
-            {
-                rot = normalMatrix * vec3(0, 0, -1);
-            }
-            if (type == LightType::SpotLight)
-            {
-                rot = normalMatrix * vec3(0, 0, 1);
-            }
-
-            cutOff = cos(degreesToRads(light->GetCutoff() / 2));
-        }
-        else if (numDummies > 0)
-        {
-            light = dummy;
-            color = dummyColor;
-            cutOff = cos(degreesToRads(dummy->GetCutoff() / 2));
-            numDummies--;
+            m_OccluderPositions.push_back(pVerts[i].pos);
+            m_OccluderIndices.push_back(i);
         }
-
-        m_lightColors.push_back(vec4(color.r, color.g, color.b, color.a));
-        m_lightPositions.push_back(pos);
-        m_lightRotations.push_back(rot);
-        m_lightRadii.push_back(light->GetDetails()->radius);
-        m_lightPowerFactors.push_back(light->GetDetails()->powerFactor);
-        m_spotCutOffs.push_back(cutOff);
     }
 
-    delete dummy;
-}
-
-void Mesh::Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts)
-{
-    glDeleteBuffers(1, &m_VBO);
-
-    m_PrimitiveType = primitiveType;
-
-    m_NumVerts = (int)verts.size();
-
     // Generate a buffer for our vertex attributes.
     glGenBuffers(1, &m_VBO);
 
@@ -391,21 +305,29 @@ void Mesh::Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts)
     glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
 
     // Copy our attribute data into the VBO.
-    glBufferData(GL_ARRAY_BUFFER, sizeof(VertexFormat) * m_NumVerts, &verts[0], GL_STATIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(VertexFormat) * m_NumVerts, pVerts, GL_STATIC_DRAW);
+
+    if (pIndices)
+    {
+        RebuildIndices(pIndices, numIndices);
+    }
 }
 
-void Mesh::Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts, const std::vector<unsigned int>& indices)
+void Mesh::RebuildIndices(const unsigned int* pIndices, unsigned int numIndices)
 {
-    Rebuild(primitiveType, verts);
-
     glDeleteBuffers(1, &m_IBO);
 
-    m_NumIndices = (int)indices.size();
+    m_NumIndices = (int)numIndices;
+
+    if (!m_OccluderPositions.empty())
+    {
+        m_OccluderIndices.assign(pIndices, pIndices + numIndices);
+    }
 
     // Generate a buffer for our indices.
     glGenBuffers(1, &m_IBO);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * m_NumIndices, &indices[0], GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * m_NumIndices, pIndices, GL_STATIC_DRAW);
 }
 
 void Mesh::CreateSprite()
@@ -10,7 +10,9 @@ class ShaderProgram;
 class Texture;
 class Material;
 class matrix;
+class mat3;
 class GameObject;
+struct DrawCommand;
 
 struct VertexFormat
 {
@@ -26,27 +28,34 @@ public:
     Mesh();
     Mesh(GLenum primitiveType, const std::vector<VertexFormat>& verts);
     Mesh(GLenum primitiveType, const std::vector<VertexFormat>& verts, const std::vector<unsigned int>& indices);
+    Mesh(GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices = nullptr, unsigned int numIndices = 0);
     virtual ~Mesh();
 
     void SetupUniform(ShaderProgram* pShader, char* name, float value);
     void SetupUniform(ShaderProgram* pShader, char* name, vec2 value);
     void SetupUniform(ShaderProgram* pShader, char* name, vec3 value);
     void SetupUniform(ShaderProgram* pShader, char* name, vec4 value);
-    void SetupUniform(ShaderProgram* pShader, char* name, matrix matrix);
+    void SetupUniform(ShaderProgram* pShader, char* name, const matrix& matrix);
+    void SetupUniform(ShaderProgram* pShader, char* name, const mat3& matrix);
 
     void SetupUniform(ShaderProgram* pShader, char* name, std::vector<float> value);
     void SetupUniform(ShaderProgram* pShader, char* name, std::vector<vec2> value);
     void SetupUniform(ShaderProgram* pShader, char* name, std::vector<vec3> value);
     void SetupUniform(ShaderProgram* pShader, char* name, std::vector<vec4> value);
 
-    void SetupAttribute(ShaderProgram* pShader, char* name, int size, GLenum type, GLboolean normalize, int stride, int64_t startIndex);
-    void Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const matrix& worldMat, const matrix& normalMat, vec2 uvScale, vec2 uvOffset, float time);
+    void SetupUniform(ShaderProgram* pShader, char* name, const float* values, int count);
+    void SetupUniform(ShaderProgram* pShader, char* name, const vec3* values, int count);
+    void SetupUniform(ShaderProgram* pShader, char* name, const vec4* values, int count);
 
-    void FindClosestLights(LightType type, std::vector<Component*>& lights, vec3& objectPos, int index);
-    void FillClosestLights(LightType type, std::vector<Component*>& lights);
+    void SetupAttribute(ShaderProgram* pShader, char* name, int size, GLenum type, GLboolean normalize, int stride, int64_t startIndex);
+    void Draw(GameObject* pParent, Camera* pCamera, Material* pMaterial, const matrix& worldMat, const mat3& normalMat, vec2 uvScale, vec2 uvOffset, float time);
+    // Only binds and uploads, all per-draw math was done when the command was built.
+    void Draw(Camera* pCamera, const DrawCommand& command);
 
     void Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts);
     void Rebuild(GLenum primitiveType, const std::vector<VertexFormat>& verts, const std::vector<unsigned int>& indices);
+    // Uploads straight from the arrays, for vertex data that's built at compile time.
+    void Rebuild(GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices = nullptr, unsigned int numIndices = 0);
 
     void CreateSprite();
     void CreatePlane(vec2 size, ivec2 vertRes);
@@ -59,6 +68,18 @@ public:
     void LoadObj(const char* filename);
     void LoadObj(const char* filename, bool righthanded);
 
+    // Local space bounds, recalculated whenever the mesh is rebuilt.
+    vec3 GetBoundsMin() { return m_BoundsMin; }
+    vec3 GetBoundsMax() { return m_BoundsMax; }
+
+    // CPU copy of small triangle meshes so they can be rasterized as occluders.
+    // Left empty for large or non-triangle meshes, those can't be used as occluders.
+    const std::vector<vec3>& GetOccluderPositions() { return m_OccluderPositions; }
+    const std::vector<unsigned int>& GetOccluderIndices() { return m_OccluderIndices; }
+
+protected:
+    void RebuildIndices(const unsigned int* pIndices, unsigned int numIndices);
+
 protected:
     GLuint m_VBO = 0;
     GLuint m_IBO = 0;
@@ -66,20 +87,11 @@ protected:
     int m_NumVerts = 0;
     int m_NumIndices = 0;
 
-    unsigned int m_numDirecLights = 0;
-    unsigned int m_numPointLights = 0;
-    unsigned int m_numSpotLights = 0;
-
-    unsigned int m_closestDirecLight = 0;
-    std::vector<unsigned int> m_closestPoint{ 0,1,2,3 };
-    std::vector<unsigned int> m_closestSpot{ 4,5,6,7 };
+    vec3 m_BoundsMin;
+    vec3 m_BoundsMax;
 
-    std::vector<vec4>  m_lightColors;
-    std::vector<vec3>  m_lightPositions;
-    std::vector<vec3>  m_lightRotations;
-    std::vector<float> m_lightRadii;
-    std::vector<float> m_lightPowerFactors;
-    std::vector<float> m_spotCutOffs;
+    std::vector<vec3> m_OccluderPositions;
+    std::vector<unsigned int> m_OccluderIndices;
 };
 
 } // namespace fw
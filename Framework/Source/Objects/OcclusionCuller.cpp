@@ -0,0 +1,287 @@
+#include "CoreHeaders.h"
+
+#include "OcclusionCuller.h"
+#include "Math/BatchTransform.h"
+
+#include <float.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define OCCLUSION_USE_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace fw {
+
+// Vertices with a clip space w below this are treated as behind the near plane.
+static const float c_MinClipW = 0.0001f;
+
+OcclusionCuller::OcclusionCuller(int width, int height)
+{
+    // The SSE rasterizer works on 4 pixels at a time.
+    assert( width > 0 && height > 0 && width % 4 == 0 );
+
+    m_Width = width;
+    m_Height = height;
+
+    ivec2 size( width, height );
+    while( true )
+    {
+        m_LevelSizes.push_back( size );
+        m_Levels.push_back( std::vector<float>( size.x * size.y, 1.0f ) );
+
+        if( size.x == 1 && size.y == 1 )
+            break;
+
+        size = ivec2( (size.x + 1) / 2, (size.y + 1) / 2 );
+    }
+
+    m_ViewProjMatrix.SetIdentity();
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+}
+
+void OcclusionCuller::Begin(const matrix& viewProjMatrix)
+{
+    m_ViewProjMatrix = viewProjMatrix;
+    m_Stats = OcclusionStats();
+
+    std::vector<float>& depth = m_Levels[0];
+    std::fill( depth.begin(), depth.end(), 1.0f );
+}
+
+void OcclusionCuller::RasterizeOccluder(const matrix& worldMat, const std::vector<vec3>& positions, const std::vector<unsigned int>& indices)
+{
+    matrix wvp = m_ViewProjMatrix * worldMat;
+
+    // Transform every vertex once, triangles share most of them.
+    m_ScreenVerts.resize( positions.size() );
+    if( positions.empty() )
+        return;
+
+    TransformPoints( wvp, &positions[0], &m_ScreenVerts[0], positions.size() );
+
+    for( size_t i=0; i<positions.size(); i++ )
+    {
+        vec4 clip = m_ScreenVerts[i];
+        if( clip.w < c_MinClipW )
+        {
+            m_ScreenVerts[i] = vec4( 0, 0, 0, 0 );
+            continue;
+        }
+
+        float invW = 1.0f / clip.w;
+        m_ScreenVerts[i] = vec4( (clip.x * invW * 0.5f + 0.5f) * m_Width,
+                                 (clip.y * invW * 0.5f + 0.5f) * m_Height,
+                                 clip.z * invW * 0.5f + 0.5f,
+                                 1 );
+    }
+
+    for( size_t i=0; i+2<indices.size(); i+=3 )
+    {
+        const vec4& v0 = m_ScreenVerts[indices[i]];
+        const vec4& v1 = m_ScreenVerts[indices[i+1]];
+        const vec4& v2 = m_ScreenVerts[indices[i+2]];
+
+        if( v0.w == 0 || v1.w == 0 || v2.w == 0 )
+            continue;
+
+        RasterizeTriangle( vec3( v0.x, v0.y, v0.z ), vec3( v1.x, v1.y, v1.z ), vec3( v2.x, v2.y, v2.z ) );
+    }
+
+    m_Stats.occludersRasterized++;
+}
+
+void OcclusionCuller::RasterizeTriangle(vec3 v0, vec3 v1, vec3 v2)
+{
+    // Twice the signed area, flip to counter-clockwise so inside is always positive.
+    float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+    if( fabs( area ) < 0.0001f )
+        return;
+
+    if( area < 0 )
+    {
+        vec3 temp = v1; v1 = v2; v2 = temp;
+        area = -area;
+    }
+
+    // Screen space bounding box, clipped to the buffer.
+    float minXf = fmin( v0.x, fmin( v1.x, v2.x ) );
+    float maxXf = fmax( v0.x, fmax( v1.x, v2.x ) );
+    float minYf = fmin( v0.y, fmin( v1.y, v2.y ) );
+    float maxYf = fmax( v0.y, fmax( v1.y, v2.y ) );
+
+    int minX = minXf < 0 ? 0 : static_cast<int>( minXf );
+    int minY = minYf < 0 ? 0 : static_cast<int>( minYf );
+    int maxX = maxXf > m_Width - 1 ? m_Width - 1 : static_cast<int>( maxXf );
+    int maxY = maxYf > m_Height - 1 ? m_Height - 1 : static_cast<int>( maxYf );
+
+    if( minX > maxX || minY > maxY )
+        return;
+
+    // Edge functions e = a*x + b*y + c, positive on the inside of each edge.
+    float a0 = v1.y - v2.y, b0 = v2.x - v1.x, c0 = v1.x * v2.y - v1.y * v2.x; // Weight of v0.
+    float a1 = v2.y - v0.y, b1 = v0.x - v2.x, c1 = v2.x * v0.y - v2.y * v0.x; // Weight of v1.
+    float a2 = v0.y - v1.y, b2 = v1.x - v0.x, c2 = v0.x * v1.y - v0.y * v1.x; // Weight of v2.
+
+    // Depth as a plane over the screen, z = za*x + zb*y + zc.
+    float invArea = 1.0f / area;
+    float za = (a0 * v0.z + a1 * v1.z + a2 * v2.z) * invArea;
+    float zb = (b0 * v0.z + b1 * v1.z + b2 * v2.z) * invArea;
+    float zc = (c0 * v0.z + c1 * v1.z + c2 * v2.z) * invArea;
+
+    float* pDepth = &m_Levels[0][0];
+
+    // Start on a multiple of 4 so each row is processed in aligned groups of 4 pixels.
+    minX &= ~3;
+
+#if OCCLUSION_USE_SSE
+    __m128 pixelOffsets = _mm_setr_ps( 0.5f, 1.5f, 2.5f, 3.5f );
+    __m128 zero = _mm_setzero_ps();
+
+    for( int y=minY; y<=maxY; y++ )
+    {
+        float py = y + 0.5f;
+        __m128 e0Row = _mm_set1_ps( b0 * py + c0 );
+        __m128 e1Row = _mm_set1_ps( b1 * py + c1 );
+        __m128 e2Row = _mm_set1_ps( b2 * py + c2 );
+        __m128 zRow = _mm_set1_ps( zb * py + zc );
+
+        float* pRow = pDepth + y * m_Width;
+
+        for( int x=minX; x<=maxX; x+=4 )
+        {
+            __m128 px = _mm_add_ps( _mm_set1_ps( static_cast<float>( x ) ), pixelOffsets );
+
+            __m128 e0 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( a0 ), px ), e0Row );
+            __m128 e1 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( a1 ), px ), e1Row );
+            __m128 e2 = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( a2 ), px ), e2Row );
+
+            __m128 inside = _mm_and_ps( _mm_and_ps( _mm_cmpge_ps( e0, zero ), _mm_cmpge_ps( e1, zero ) ), _mm_cmpge_ps( e2, zero ) );
+            if( _mm_movemask_ps( inside ) == 0 )
+                continue;
+
+            __m128 z = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( za ), px ), zRow );
+            __m128 oldDepth = _mm_loadu_ps( pRow + x );
+            __m128 newDepth = _mm_min_ps( oldDepth, z );
+
+            _mm_storeu_ps( pRow + x, _mm_or_ps( _mm_and_ps( inside, newDepth ), _mm_andnot_ps( inside, oldDepth ) ) );
+        }
+    }
+#else
+    for( int y=minY; y<=maxY; y++ )
+    {
+        float py = y + 0.5f;
+        float* pRow = pDepth + y * m_Width;
+
+        for( int x=minX; x<=maxX; x++ )
+        {
+            float px = x + 0.5f;
+
+            if( a0 * px + b0 * py + c0 < 0 || a1 * px + b1 * py + c1 < 0 || a2 * px + b2 * py + c2 < 0 )
+                continue;
+
+            float z = za * px + zb * py + zc;
+            if( z < pRow[x] )
+                pRow[x] = z;
+        }
+    }
+#endif
+
+    m_Stats.trianglesRasterized++;
+}
+
+void OcclusionCuller::BuildHierarchy()
+{
+    for( size_t level=1; level<m_Levels.size(); level++ )
+    {
+        const std::vector<float>& src = m_Levels[level-1];
+        std::vector<float>& dest = m_Levels[level];
+        ivec2 srcSize = m_LevelSizes[level-1];
+        ivec2 destSize = m_LevelSizes[level];
+
+        for( int y=0; y<destSize.y; y++ )
+        {
+            int y0 = y * 2;
+            int y1 = y0 + 1 < srcSize.y ? y0 + 1 : y0;
+
+            for( int x=0; x<destSize.x; x++ )
+            {
+                int x0 = x * 2;
+                int x1 = x0 + 1 < srcSize.x ? x0 + 1 : x0;
+
+                float depth = src[y0 * srcSize.x + x0];
+                depth = fmax( depth, src[y0 * srcSize.x + x1] );
+                depth = fmax( depth, src[y1 * srcSize.x + x0] );
+                depth = fmax( depth, src[y1 * srcSize.x + x1] );
+
+                dest[y * destSize.x + x] = depth;
+            }
+        }
+    }
+}
+
+bool OcclusionCuller::IsVisible(const matrix& worldMat, vec3 boundsMin, vec3 boundsMax)
+{
+    m_Stats.objectsTested++;
+
+    matrix wvp = m_ViewProjMatrix * worldMat;
+
+    float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+    float maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+    for( int i=0; i<8; i++ )
+    {
+        vec3 corner( (i & 1) ? boundsMax.x : boundsMin.x,
+                     (i & 2) ? boundsMax.y : boundsMin.y,
+                     (i & 4) ? boundsMax.z : boundsMin.z );
+
+        vec4 clip = wvp * vec4( corner.x, corner.y, corner.z, 1 );
+
+        // Crossing the near plane, it's right in front of the camera.
+        if( clip.w < c_MinClipW )
+            return true;
+
+        float invW = 1.0f / clip.w;
+        float x = (clip.x * invW * 0.5f + 0.5f) * m_Width;
+        float y = (clip.y * invW * 0.5f + 0.5f) * m_Height;
+        float z = clip.z * invW * 0.5f + 0.5f;
+
+        minX = fmin( minX, x ); maxX = fmax( maxX, x );
+        minY = fmin( minY, y ); maxY = fmax( maxY, y );
+        minZ = fmin( minZ, z );
+    }
+
+    // Off screen, leave it for the GPU to clip.
+    if( maxX < 0 || maxY < 0 || minX >= m_Width || minY >= m_Height )
+        return true;
+
+    int x0 = minX < 0 ? 0 : static_cast<int>( minX );
+    int y0 = minY < 0 ? 0 : static_cast<int>( minY );
+    int x1 = maxX >= m_Width ? m_Width - 1 : static_cast<int>( maxX );
+    int y1 = maxY >= m_Height ? m_Height - 1 : static_cast<int>( maxY );
+
+    // Go up the pyramid until the rect covers at most 2x2 texels.
+    int level = 0;
+    while( level < GetNumLevels() - 1 && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1) )
+        level++;
+
+    const std::vector<float>& depth = m_Levels[level];
+    int levelWidth = m_LevelSizes[level].x;
+
+    for( int y=(y0 >> level); y<=(y1 >> level); y++ )
+    {
+        for( int x=(x0 >> level); x<=(x1 >> level); x++ )
+        {
+            // Some part of this texel is farther away than the object's nearest point.
+            if( depth[y * levelWidth + x] >= minZ )
+                return true;
+        }
+    }
+
+    m_Stats.objectsCulled++;
+    return false;
+}
+
+} // namespace fw
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Math/Vector.h"
+#include "Math/Matrix.h"
+
+namespace fw {
+
+struct OcclusionStats
+{
+    unsigned int occludersRasterized = 0;
+    unsigned int trianglesRasterized = 0;
+    unsigned int objectsTested = 0;
+    unsigned int objectsCulled = 0;
+};
+
+// Software occlusion culling, entirely on the CPU.
+// Occluder triangles are rasterized into a small depth buffer, which is then reduced into a max-depth pyramid.
+// Object bounds are projected to the screen and tested against the pyramid level that covers them in a few texels.
+// Depth is 0 at the near plane and 1 at the far plane.
+class OcclusionCuller
+{
+public:
+    OcclusionCuller(int width = 256, int height = 128);
+    virtual ~OcclusionCuller();
+
+    // Clears the depth buffer and sets the camera used for this frame.
+    void Begin(const matrix& viewProjMatrix);
+
+    // Triangles crossing the near plane are skipped, so occluders never hide more than they should.
+    void RasterizeOccluder(const matrix& worldMat, const std::vector<vec3>& positions, const std::vector<unsigned int>& indices);
+
+    // Call once all occluders are rasterized, before any visibility tests.
+    void BuildHierarchy();
+
+    // Tests a local space AABB, returns false only if it's fully behind the rasterized occluders.
+    bool IsVisible(const matrix& worldMat, vec3 boundsMin, vec3 boundsMax);
+
+    // Getters.
+    int GetWidth() { return m_Width; }
+    int GetHeight() { return m_Height; }
+    int GetNumLevels() { return static_cast<int>( m_Levels.size() ); }
+    ivec2 GetLevelSize(int level) { return m_LevelSizes[level]; }
+    const float* GetDepthBuffer(int level) { return &m_Levels[level][0]; }
+    const OcclusionStats& GetStats() { return m_Stats; }
+
+protected:
+    void RasterizeTriangle(vec3 v0, vec3 v1, vec3 v2);
+
+protected:
+    int m_Width = 0;
+    int m_Height = 0;
+
+    matrix m_ViewProjMatrix;
+
+    // Level 0 is the full resolution buffer, each level above stores the max depth of 2x2 texels below it.
+    std::vector<std::vector<float>> m_Levels;
+    std::vector<ivec2> m_LevelSizes;
+
+    // Screen space positions of the occluder being rasterized, z is depth, w is 0 if behind the near plane.
+    std::vector<vec4> m_ScreenVerts;
+
+    OcclusionStats m_Stats;
+};
+
+} // namespace fw
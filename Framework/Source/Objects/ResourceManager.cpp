@@ -85,6 +85,17 @@ bool ResourceManager::CreateMesh(std::string name, GLenum primitiveType, const s
 	return AddMesh(name, mesh);
 }
 
+bool ResourceManager::CreateMesh(std::string name, GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices, unsigned int numIndices)
+{
+	if (m_Meshes.count(name))
+	{
+		return false;
+	}
+
+	Mesh* mesh = new Mesh(primitiveType, pVerts, numVerts, pIndices, numIndices);
+	return AddMesh(name, mesh);
+}
+
 bool ResourceManager::CreateTexture(std::string name, const char* filename)
 {
 	if (m_Textures.count(name))
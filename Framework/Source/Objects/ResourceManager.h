@@ -29,6 +29,7 @@ public:
 	bool CreateMesh(std::string name);
 	bool CreateMesh(std::string name, GLenum primitiveType, const std::vector<VertexFormat>& verts);
 	bool CreateMesh(std::string name, GLenum primitiveType, const std::vector<VertexFormat>& verts, const std::vector<unsigned int>& indices);
+	bool CreateMesh(std::string name, GLenum primitiveType, const VertexFormat* pVerts, unsigned int numVerts, const unsigned int* pIndices = nullptr, unsigned int numIndices = 0);
 	
 	bool CreateTexture(std::string name, const char* filename);
     bool CreateTexture(std::string name, std::vector<const char*> filenames);
@@ -1,22 +1,35 @@
-#include "Framework.h"
+#include "CoreHeaders.h"
+
+#include "../Libraries/imgui/imgui.h"
 
 #include "Scene.h"
+#include "GameCore.h"
 #include "Components/ComponentManager.h"
 #include "Events/Event.h"
+#include "Objects/EntityCommandBuffer.h"
 #include "Objects/Camera.h"
+#include "Objects/ResourceManager.h"
 #include "Physics/PhysicsWorld.h"
+#include "Utility/SlabAllocator.h"
 #include "GameObject.h"
 
+#include <algorithm>
+
 
 namespace fw {
 Scene::Scene(GameCore* pGameCore) : m_pGame(pGameCore)
 {
-    m_pComponentManager = new ComponentManager();
+    m_pComponentManager = new ComponentManager(pGameCore->GetJobSystem());
+    m_pCommandBuffer = new EntityCommandBuffer(this, pGameCore->GetJobSystem());
 	m_pResourceManager = pGameCore->GetResourceManager();
 }
 
 Scene::~Scene()
 {
+    // Not played back, the derived scene may already have deleted objects it refers to.
+    m_pCommandBuffer->Clear();
+    delete m_pCommandBuffer;
+
     for (fw::GameObject* pObject : m_Objects)
     {
         delete pObject;
@@ -27,6 +40,9 @@ Scene::~Scene()
     delete m_pComponentManager;
 
     delete m_pPhysicsWorld;
+
+    // Last, everything above may have come from it.
+    delete m_pArena;
 }
 void Scene::OnEvent(Event* pEvent)
 {
@@ -35,39 +51,56 @@ void Scene::OnEvent(Event* pEvent)
         RemoveFromGameEvent* pRemoveFromGameEvent = static_cast<RemoveFromGameEvent*>(pEvent);
         fw::GameObject* pObject = pRemoveFromGameEvent->GetGameObject();
 
-        auto it = std::find(m_Objects.begin(), m_Objects.end(), pObject);
-        m_Objects.erase(it);
-
-        delete pObject;
+        // Events can come in while something is walking the scene, and the same object can be sent more than once.
+        m_pCommandBuffer->DestroyObject(pObject);
     }
 }
+void Scene::AddObject(GameObject* pObject)
+{
+    assert(pObject->m_Handle.IsValid() == false);
+
+    pObject->m_Handle = m_Objects.Add(pObject);
+}
+void Scene::RemoveObject(GameObject* pObject)
+{
+    m_Objects.Remove(pObject->m_Handle);
+    pObject->m_Handle = Handle();
+}
+GameObject* Scene::GetGameObject(Handle handle)
+{
+    GameObject** ppObject = m_Objects.Get(handle);
+    return ppObject ? *ppObject : nullptr;
+}
 void Scene::Update(float deltaTime)
 {
+    m_pComponentManager->Update(deltaTime, SystemStage::BeforePhysics);
+
 	if (m_pPhysicsWorld)
 	{
 		m_pPhysicsWorld->Update(deltaTime);
 	}
 
-    m_pComponentManager->Update(deltaTime);
+    m_pComponentManager->Update(deltaTime, SystemStage::AfterPhysics);
+
+    // Everything recorded by systems, jobs and event handlers since the last frame.
+    m_pCommandBuffer->Playback();
 
     m_pCamera->Update(deltaTime);
 
 	if (m_showObjectList)
 	{
-		if (m_showObjectDetails.size() < m_Objects.size())
-		{
-			m_showObjectDetails.clear();
-			m_showObjectDetails.resize(m_Objects.size());
-		}
-
 		Editor_ShowObjectList();
 	}
 
-	for (int i = 0; i < m_showObjectDetails.size(); i++)
+	for (size_t i = 0; i < m_showObjectDetails.size(); )
 	{
-		if (m_showObjectDetails[i])
+		if (Editor_ShowObjectDetails(m_showObjectDetails[i]))
 		{
-			Editor_ShowObjectDetails(i);
+			i++;
+		}
+		else
+		{
+			m_showObjectDetails.erase(m_showObjectDetails.begin() + i);
 		}
 	}
 
@@ -93,15 +126,17 @@ void Scene::Editor_ShowObjectList()
 		{
 			if(ImGui::BeginMenu("Scene Objects"))
 			{
-				if (!m_Objects.empty())
+				if (!m_Objects.IsEmpty())
 				{
-					for (int i = 0; i < m_Objects.size(); i++)
+					for (size_t i = 0; i < m_Objects.GetSize(); i++)
 					{
 						char name[30];
 						sprintf_s(name, 30, "%s", m_Objects[i]->GetName().c_str());
 
-						bool toggle = m_showObjectDetails[i];
-						if (ImGui::MenuItem(name, "", &toggle)) { m_showObjectDetails[i] = true; }
+						Handle handle = m_Objects.GetHandle(i);
+						bool shown = std::find(m_showObjectDetails.begin(), m_showObjectDetails.end(), handle) != m_showObjectDetails.end();
+						bool toggle = shown;
+						if (ImGui::MenuItem(name, "", &toggle) && !shown) { m_showObjectDetails.push_back(handle); }
 					}
 				}
 				ImGui::EndMenu();
@@ -126,7 +161,7 @@ void Scene::Editor_ShowObjectPopoutList()
 		return;
 	}
 
-	for (int i = 0; i < m_Objects.size(); i++)
+	for (size_t i = 0; i < m_Objects.GetSize(); i++)
 	{
 		char name[30];
 		sprintf_s(name, 30, "%s", m_Objects[i]->GetName().c_str());
@@ -141,23 +176,29 @@ void Scene::Editor_ShowObjectPopoutList()
 	ImGui::End();
 }
 
-void Scene::Editor_ShowObjectDetails(int index)
+bool Scene::Editor_ShowObjectDetails(Handle handle)
 {
 	//ImGui::SetNextWindowSize(ImVec2(260, 250), ImGuiCond_Always);
 
+	GameObject** ppObject = m_Objects.Get(handle);
+	if (ppObject == nullptr)
+	{
+		return false;
+	}
+
 	char name[30];
-	sprintf_s(name, 30, "%s", m_Objects[index]->GetName().c_str());
+	sprintf_s(name, 30, "%s", (*ppObject)->GetName().c_str());
 	
-	bool toggle = m_showObjectDetails[index];
+	bool toggle = true;
 	if (!ImGui::Begin(name, &toggle))
 	{
 		ImGui::End();
-		return;
+		return toggle;
 	}
-	m_showObjectDetails[index] = toggle;
-	m_Objects[index]->Editor_OutputObjectDetails();
+	(*ppObject)->Editor_OutputObjectDetails();
 
 	ImGui::End();
+	return toggle;
 }
 
 } // namespace fw
@@ -1,15 +1,18 @@
 #pragma once
 #include "Events/EventManager.h"
+#include "Utility/SlotMap.h"
 
 namespace fw {
 
 class Camera;
+class EntityCommandBuffer;
 class Event;
 class GameCore;
 class GameObject;
 class PhysicsWorld;
 class ComponentManager;
 class ResourceManager;
+class SlabArena;
 
 class Scene : public EventListener
 {
@@ -19,15 +22,23 @@ protected:
 
     Camera* m_pCamera = nullptr;
     PhysicsWorld* m_pPhysicsWorld = nullptr;
-    std::vector<GameObject*> m_Objects;
+
+    // Owned by the scene. Removing swaps the last object into the gap, so indices aren't stable, handles are.
+    SlotMap<GameObject*> m_Objects;
 
     ComponentManager* m_pComponentManager = nullptr;
 
+    // Played back by Update() once the systems are done.
+    EntityCommandBuffer* m_pCommandBuffer = nullptr;
+
+    // Optional, a scene that creates one and allocates inside a SlabArena::Scope gets all of it back in one go when it's deleted.
+    SlabArena* m_pArena = nullptr;
+
 	bool m_debugDraw = false;
 
 	bool m_showObjectList = true;
     bool m_showObjectPopoutList = false;
-	std::vector<bool> m_showObjectDetails;
+	std::vector<Handle> m_showObjectDetails; // Objects with a details window open, by handle since their indices move.
 public:
     Scene(GameCore* pGameCore);
     virtual ~Scene();
@@ -49,9 +60,19 @@ public:
 
 	void Editor_ShowObjectList();
     void Editor_ShowObjectPopoutList();
-	void Editor_ShowObjectDetails(int index);
+	bool Editor_ShowObjectDetails(Handle handle); // False once the window is closed or the object is gone.
+
+    void AddObject(GameObject* pObject);
+
+    // Takes the object out of the list without deleting it, so it can be reused or deleted later.
+    void RemoveObject(GameObject* pObject);
+
+    // nullptr once the object has been removed from the scene.
+    GameObject* GetGameObject(Handle handle);
 
     ComponentManager* GetComponentManager() { return m_pComponentManager; }
+    EntityCommandBuffer* GetCommandBuffer() { return m_pCommandBuffer; }
+    SlabArena* GetArena() { return m_pArena; }
 };
 
 } // namespace fw
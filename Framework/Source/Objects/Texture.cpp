@@ -59,6 +59,10 @@ Texture::Texture(std::vector<const char*> filenames)
     SetCubeMapTexture(filenames);
 }
 
+Texture::Texture(GLuint textureID) : m_TextureID(textureID)
+{
+}
+
 Texture::~Texture()
 {
     glDeleteTextures( 1, &m_TextureID );
@@ -8,6 +8,7 @@ public:
     Texture();
     Texture(const char* filename);
     Texture(std::vector<const char*> filenames);
+    Texture(GLuint textureID); // Takes ownership of a texture created elsewhere.
     virtual ~Texture();
 
     // Getters.
@@ -43,6 +43,13 @@ vec3 PhysicsBodyBullet::GetRotation()
     return angles;
 }
 
+quat PhysicsBodyBullet::GetRotationQuat()
+{
+    // Same layout and convention as fw::quat, see matrix::CreateRotation(quat).
+    btQuaternion rot = m_pBody->getWorldTransform().getRotation();
+    return quat( rot.x(), rot.y(), rot.z(), rot.w() );
+}
+
 vec3 PhysicsBodyBullet::GetVelocity()
 {
     return vec3();
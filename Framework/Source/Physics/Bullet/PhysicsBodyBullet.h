@@ -19,6 +19,9 @@ public:
 	virtual vec3 GetRotation() override;
 	virtual vec3 GetVelocity() override;
 
+	virtual bool HasQuaternionRotation() override { return true; }
+	virtual quat GetRotationQuat() override;
+
 	// Setters.
 	virtual void SetPosition(vec3 pos) override;
 	virtual void SetTransform(vec3 pos, vec3 rot) override;
@@ -67,7 +67,8 @@ PhysicsBody* PhysicsWorldBullet::CreateBody(GameObject* owner, bool isDynamic, v
     btTransform transform;
     transform.setIdentity();
     transform.setOrigin(btVector3(pos.x, pos.y, pos.z));
-    transform.setRotation(btQuaternion(rot.x, rot.y, rot.z));
+    quat rotQuat = quat::CreateEuler(rot); // btQuaternion's Euler constructor takes radians in a different order.
+    transform.setRotation(btQuaternion(rotQuat.x, rotQuat.y, rotQuat.z, rotQuat.w));
 
     // Create the shape, ideally these would be shared between objects.
     vec3 scale = size;
@@ -107,7 +108,8 @@ PhysicsBody* PhysicsWorldBullet::CreateBody(GameObject* owner, bool isDynamic, f
     btTransform transform;
     transform.setIdentity();
     transform.setOrigin(btVector3(pos.x, pos.y, pos.z));
-    transform.setRotation(btQuaternion(rot.x, rot.y, rot.z));
+    quat rotQuat = quat::CreateEuler(rot); // btQuaternion's Euler constructor takes radians in a different order.
+    transform.setRotation(btQuaternion(rotQuat.x, rotQuat.y, rotQuat.z, rotQuat.w));
 
     // Create the shape, ideally these would be shared between objects.
     btCollisionShape* pShape = new btSphereShape(radius);
@@ -186,7 +188,8 @@ void PhysicsWorldBullet::CreateSensor(GameObject* owner, TransformComponent* pTr
     btTransform transform;
     transform.setIdentity();
     transform.setOrigin(btVector3(pos.x, pos.y, pos.z));
-    transform.setRotation(btQuaternion(rot.x, rot.y, rot.z));
+    quat rotQuat = quat::CreateEuler(rot); // btQuaternion's Euler constructor takes radians in a different order.
+    transform.setRotation(btQuaternion(rotQuat.x, rotQuat.y, rotQuat.z, rotQuat.w));
 
     // Create the shape, ideally these would be shared between objects.
     btCollisionShape* pShape = new btBoxShape(btVector3(scale.x, scale.y, scale.z) / 2);
@@ -1,16 +1,21 @@
 #pragma once
 
 #include "Math/Vector.h"
+#include "Math/Quaternion.h"
 
 namespace fw {
 
 class PhysicsBody
 {
 public:
-    virtual ~PhysicsBody() = 0 {}
+    virtual ~PhysicsBody() {}
     virtual vec3 GetPosition() = 0;
     virtual vec3 GetRotation() = 0;
     virtual vec3 GetVelocity() = 0;
+
+    // Bodies that store a quaternion hand it over as is, skipping the trip through Euler angles.
+    virtual bool HasQuaternionRotation() { return false; }
+    virtual quat GetRotationQuat() { return quat::CreateEuler(GetRotation()); }
     
     virtual void SetPosition(vec3 pos) = 0;
     virtual void SetTransform(vec3 pos, vec3 rot) = 0;
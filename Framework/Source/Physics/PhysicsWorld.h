@@ -19,7 +19,7 @@ protected:
 
 public:
 	PhysicsWorld(EventManager* pEventManager) : m_pEventManager(pEventManager) {}
-    virtual ~PhysicsWorld() = 0 {}
+    virtual ~PhysicsWorld() {}
 
     virtual void Update(float deltaTime) = 0;
 
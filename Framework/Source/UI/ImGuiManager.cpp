@@ -5,6 +5,7 @@
 #include "ImGuiManager.h"
 #include "../Libraries/imgui/imgui.h"
 #include "Events/Event.h"
+#include "GL/GLRecorder.h"
 
 namespace fw {
 
@@ -216,6 +217,7 @@ void ImGuiManager::RenderDrawLists(ImDrawData* draw_data)
             {
                 glBindTexture( GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId );
                 glScissor( (int)pcmd->ClipRect.x, (int)(fb_height - pcmd->ClipRect.w), (int)(pcmd->ClipRect.z - pcmd->ClipRect.x), (int)(pcmd->ClipRect.w - pcmd->ClipRect.y) );
+                GLRecorder::RecordDraw( GL_TRIANGLES, (int)pcmd->ElemCount );
                 glDrawElements( GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset );
             }
             idx_buffer_offset += pcmd->ElemCount;
@@ -261,7 +263,7 @@ bool ImGuiManager::CreateFontsTexture()
     glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
 
     // Store our identifier
-    io.Fonts->TexID = (void*)(unsigned __int64)m_FontTexture;
+    io.Fonts->TexID = (void*)(intptr_t)m_FontTexture;
 
     // Restore state
     glBindTexture( GL_TEXTURE_2D, last_texture );
@@ -0,0 +1,135 @@
+#include "CoreHeaders.h"
+
+#include "FrameBenchmark.h"
+#include "GameCore.h"
+#include "Events/EventManager.h"
+#include "GL/GLRecorder.h"
+#include "Utility/JobSystem.h"
+#include "Utility/Utility.h"
+
+#include "../Libraries/rapidjson/prettywriter.h"
+#include "../Libraries/rapidjson/stringbuffer.h"
+
+#include <algorithm>
+
+namespace fw {
+
+static bool WriteBenchmarkReport(GLBackend backend, const BenchmarkSettings& settings, const std::vector<double>& frameTimes, const std::vector<GLRecorderStats>& frameStats)
+{
+    const char* backendNames[] = { "Native", "Recording", "NullShim" };
+
+    auto writeStats = [](rapidjson::PrettyWriter<rapidjson::StringBuffer>& writer, const GLRecorderStats& stats)
+    {
+        writer.StartObject();
+        writer.Key( "glCalls" );               writer.Uint( stats.glCalls );
+        writer.Key( "drawCalls" );             writer.Uint( stats.drawCalls );
+        writer.Key( "indicesSubmitted" );      writer.Uint( stats.indicesSubmitted );
+        writer.Key( "primitivesSubmitted" );   writer.Uint( stats.primitivesSubmitted );
+        writer.Key( "programChanges" );        writer.Uint( stats.programChanges );
+        writer.Key( "bufferBinds" );           writer.Uint( stats.bufferBinds );
+        writer.Key( "framebufferBinds" );      writer.Uint( stats.framebufferBinds );
+        writer.Key( "textureUnitChanges" );    writer.Uint( stats.textureUnitChanges );
+        writer.Key( "uniformUploads" );        writer.Uint( stats.uniformUploads );
+        writer.Key( "bufferUploadBytes" );     writer.Uint( stats.bufferUploadBytes );
+        writer.Key( "redundantStateChanges" ); writer.Uint( stats.redundantStateChanges );
+        writer.Key( "validationErrors" );      writer.Uint( stats.validationErrors );
+        writer.EndObject();
+    };
+
+    // CPU frame time summary, in milliseconds.
+    std::vector<double> sorted = frameTimes;
+    std::sort( sorted.begin(), sorted.end() );
+
+    double total = 0;
+    for( double time : sorted )
+        total += time;
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer( buffer );
+
+    writer.StartObject();
+    writer.Key( "label" );      writer.String( settings.label.c_str() );
+    writer.Key( "backend" );    writer.String( backendNames[static_cast<int>( backend )] );
+    writer.Key( "frames" );     writer.Uint( static_cast<unsigned int>( frameTimes.size() ) );
+    writer.Key( "deltaTime" );  writer.Double( settings.deltaTime );
+
+    writer.Key( "cpuFrameTimeMs" );
+    writer.StartObject();
+    if( sorted.empty() == false )
+    {
+        writer.Key( "min" );    writer.Double( sorted.front() * 1000 );
+        writer.Key( "max" );    writer.Double( sorted.back() * 1000 );
+        writer.Key( "mean" );   writer.Double( total / sorted.size() * 1000 );
+        writer.Key( "median" ); writer.Double( sorted[sorted.size() / 2] * 1000 );
+        writer.Key( "p95" );    writer.Double( sorted[(sorted.size() * 95) / 100] * 1000 );
+    }
+    writer.EndObject();
+
+    writer.Key( "totals" );
+    writeStats( writer, GLRecorder::GetTotalStats() );
+
+    writer.Key( "perFrame" );
+    writer.StartArray();
+    for( size_t i=0; i<frameTimes.size(); i++ )
+    {
+        writer.StartObject();
+        writer.Key( "cpuMs" );     writer.Double( frameTimes[i] * 1000 );
+        writer.Key( "drawCalls" ); writer.Uint( frameStats[i].drawCalls );
+        writer.Key( "glCalls" );   writer.Uint( frameStats[i].glCalls );
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.Key( "validationMessages" );
+    writer.StartArray();
+    for( const std::string& message : GLRecorder::GetValidationMessages() )
+        writer.String( message.c_str() );
+    writer.EndArray();
+
+    writer.EndObject();
+
+    FILE* filehandle;
+    errno_t error = fopen_s( &filehandle, settings.reportFilename.c_str(), "wb" );
+    if( error != 0 || filehandle == nullptr )
+    {
+        OutputMessage( "Failed to write benchmark report: %s\n", settings.reportFilename.c_str() );
+        return false;
+    }
+
+    fwrite( buffer.GetString(), 1, buffer.GetSize(), filehandle );
+    fclose( filehandle );
+
+    return true;
+}
+
+int RunFrameBenchmark(GameCore& game, EventManager* pEventManager, GLBackend backend, const BenchmarkSettings& settings, std::function<bool()> endFrame)
+{
+    std::vector<double> frameTimes;
+    std::vector<GLRecorderStats> frameStats;
+    frameTimes.reserve( settings.numFrames );
+    frameStats.reserve( settings.numFrames );
+
+    for( unsigned int frame=0; frame<settings.numFrames; frame++ )
+    {
+        GLRecorder::ResetFrameStats();
+
+        double startTime = GetSystemTime();
+
+        game.StartFrame( settings.deltaTime );
+        pEventManager->ProcessEvents();
+        game.Update( settings.deltaTime );
+        game.GetJobSystem()->RunMainThreadJobs();
+        game.Draw();
+
+        // Measure CPU time before the swap so vsync doesn't end up in the numbers.
+        frameTimes.push_back( GetSystemTime() - startTime );
+        frameStats.push_back( GLRecorder::GetFrameStats() );
+
+        if( endFrame && endFrame() == false )
+            break;
+    }
+
+    return WriteBenchmarkReport( backend, settings, frameTimes, frameStats ) ? 0 : 1;
+}
+
+} // namespace fw
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <functional>
+
+#include "GL/GLRecorder.h"
+
+namespace fw {
+
+class EventManager;
+class GameCore;
+
+struct BenchmarkSettings
+{
+    unsigned int numFrames = 300;
+    float deltaTime = 1.0f / 60.0f;
+    std::string label;
+    std::string reportFilename = "BenchmarkReport.json";
+};
+
+// Runs a fixed number of frames with a fixed deltaTime and writes a JSON report of CPU frame times and GL usage.
+// Needs no window, with the NullShim backend the whole run is headless.
+// endFrame is called once each frame has been timed, i.e. to swap buffers, and ends the run early by returning false.
+// Returns the process exit code.
+int RunFrameBenchmark(GameCore& game, EventManager* pEventManager, GLBackend backend, const BenchmarkSettings& settings, std::function<bool()> endFrame = nullptr);
+
+} // namespace fw
@@ -0,0 +1,433 @@
+#include "CoreHeaders.h"
+
+#include "JobSystem.h"
+#include "Math/SoAArray.h"
+
+#include <thread>
+
+namespace fw {
+
+// Lock free work stealing deque (Chase and Lev, with the memory orders from Le et al. 2013).
+// Only the owning thread pushes and pops, at the bottom. Any thread can steal from the top.
+class JobDeque
+{
+public:
+    static const int64_t Capacity = 4096;
+
+    // Fails when full, the caller puts the job somewhere else.
+    bool Push(Job* pJob)
+    {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top >= Capacity)
+            return false;
+
+        m_Jobs[bottom & (Capacity - 1)].store(pJob, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    Job* Pop()
+    {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            // Empty.
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* pJob = m_Jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // The last one, race the thieves for it.
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                pJob = nullptr;
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return pJob;
+    }
+
+    Job* Steal()
+    {
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+            return nullptr;
+
+        Job* pJob = m_Jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+
+        return pJob;
+    }
+
+protected:
+    // Apart, so the owner and the thieves don't fight over a cache line.
+    alignas(64) std::atomic<int64_t> m_Top{ 0 };
+    alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+    std::atomic<Job*> m_Jobs[Capacity];
+};
+
+struct JobSystem::Worker
+{
+    JobDeque deque;
+    std::thread thread;
+
+    // Finished jobs go back to the list of the thread that ran them, so only that thread touches it.
+    std::vector<Job*> freeJobs;
+    std::vector<Job*> jobBlocks;
+
+    std::atomic<uint64_t> executed{ 0 };
+    std::atomic<uint64_t> stolen{ 0 };
+
+    // Where stealing starts looking, so thieves spread out.
+    unsigned int nextVictim = 0;
+
+    // The deque's alignas(64) is only honoured by plain new from C++17 on, so allocate workers aligned by hand.
+    static void* operator new(size_t size)
+    {
+        void* p = AlignedAlloc(size, alignof(Worker));
+        if (p == nullptr)
+            throw std::bad_alloc();
+        return p;
+    }
+
+    static void operator delete(void* p) { AlignedFree(p); }
+};
+
+static const size_t c_JobsPerBlock = 64;
+
+// Which JobSystem the current thread works for, the main thread and outside threads have none.
+static thread_local JobSystem* t_pJobSystem = nullptr;
+static thread_local unsigned int t_WorkerIndex = 0;
+
+JobSystem::JobSystem(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+    if (numThreads == 0)
+    {
+        numThreads = 1;
+    }
+    if (numThreads > MaxWorkers)
+    {
+        numThreads = MaxWorkers;
+    }
+
+    m_NumThreads = numThreads;
+    m_MainThreadID = std::this_thread::get_id();
+
+    for (unsigned int i = 0; i < m_NumThreads; i++)
+    {
+        m_Workers.push_back(new Worker());
+        m_Workers[i]->nextVictim = i + 1;
+    }
+
+    // Worker 0 is the calling thread.
+    for (unsigned int i = 1; i < m_NumThreads; i++)
+    {
+        m_Workers[i]->thread = std::thread(&JobSystem::WorkerMain, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_Quit = true;
+    }
+    m_WakeUp.notify_all();
+
+    for (Worker* pWorker : m_Workers)
+    {
+        if (pWorker->thread.joinable())
+        {
+            pWorker->thread.join();
+        }
+    }
+
+    // Everything should have been waited on by now.
+    assert(m_NumQueued == 0 && m_MainQueue.empty());
+
+    for (Worker* pWorker : m_Workers)
+    {
+        for (Job* pBlock : pWorker->jobBlocks)
+        {
+            delete[] pBlock;
+        }
+        delete pWorker;
+    }
+}
+
+void JobSystem::Wait(JobCounter* pCounter)
+{
+    assert(IsOwnThread());
+    unsigned int workerIndex = GetCurrentWorkerIndex();
+
+    while (!pCounter->IsDone())
+    {
+        if (!RunOneJob(workerIndex))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // The thread that finished the last job can still be inside Signal(), wait for it to let go of the counter.
+    std::lock_guard<std::mutex> lock(pCounter->m_Mutex);
+}
+
+void JobSystem::RunMainThreadJobs()
+{
+    assert(GetCurrentWorkerIndex() == 0);
+
+    std::vector<Job*> jobs;
+    {
+        std::lock_guard<std::mutex> lock(m_MainQueueMutex);
+        jobs.swap(m_MainQueue);
+    }
+
+    for (Job* pJob : jobs)
+    {
+        Execute(pJob, 0);
+    }
+}
+
+unsigned int JobSystem::GetCurrentWorkerIndex()
+{
+    return t_WorkerIndex;
+}
+
+void JobSystem::SetProfileHooks(JobProfileHook beginHook, JobProfileHook endHook, void* pUserData)
+{
+    m_BeginHook = beginHook;
+    m_EndHook = endHook;
+    m_pProfileUserData = pUserData;
+}
+
+JobStats JobSystem::GetStats(unsigned int workerIndex) const
+{
+    assert(workerIndex < m_NumThreads);
+
+    JobStats stats;
+    stats.executed = m_Workers[workerIndex]->executed.load(std::memory_order_relaxed);
+    stats.stolen = m_Workers[workerIndex]->stolen.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void JobSystem::ResetStats()
+{
+    for (Worker* pWorker : m_Workers)
+    {
+        pWorker->executed = 0;
+        pWorker->stolen = 0;
+    }
+}
+
+bool JobSystem::IsOwnThread() const
+{
+    return t_pJobSystem == this || std::this_thread::get_id() == m_MainThreadID;
+}
+
+Job* JobSystem::AllocateJob()
+{
+    assert(IsOwnThread());
+
+    Worker* pWorker = m_Workers[GetCurrentWorkerIndex()];
+    if (pWorker->freeJobs.empty())
+    {
+        Job* pBlock = new Job[c_JobsPerBlock];
+        pWorker->jobBlocks.push_back(pBlock);
+        for (size_t i = 0; i < c_JobsPerBlock; i++)
+        {
+            pWorker->freeJobs.push_back(&pBlock[i]);
+        }
+    }
+
+    Job* pJob = pWorker->freeJobs.back();
+    pWorker->freeJobs.pop_back();
+    return pJob;
+}
+
+void JobSystem::Submit(Job* pJob, JobCounter* pDependency)
+{
+    if (pDependency)
+    {
+        // Checked under the lock, Signal() takes it before handing out the waiting jobs.
+        std::lock_guard<std::mutex> lock(pDependency->m_Mutex);
+        if (pDependency->m_Count.load() > 0)
+        {
+            pDependency->m_WaitingJobs.push_back(pJob);
+            return;
+        }
+    }
+
+    Push(pJob);
+}
+
+void JobSystem::Push(Job* pJob)
+{
+    if (pJob->affinity == JobAffinity::MainThread)
+    {
+        std::lock_guard<std::mutex> lock(m_MainQueueMutex);
+        m_MainQueue.push_back(pJob);
+        return;
+    }
+
+    m_NumQueued.fetch_add(1);
+
+    // A full deque spills into the shared queue.
+    if (!m_Workers[GetCurrentWorkerIndex()]->deque.Push(pJob))
+    {
+        std::lock_guard<std::mutex> lock(m_SharedQueueMutex);
+        m_SharedQueue.push_back(pJob);
+    }
+
+    if (m_NumSleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_WakeUp.notify_one();
+    }
+}
+
+bool JobSystem::RunOneJob(unsigned int workerIndex)
+{
+    Job* pJob = nullptr;
+
+    // GL work first on the main thread, it can't go anywhere else.
+    if (workerIndex == 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_MainQueueMutex);
+            if (!m_MainQueue.empty())
+            {
+                pJob = m_MainQueue.back();
+                m_MainQueue.pop_back();
+            }
+        }
+        if (pJob)
+        {
+            Execute(pJob, workerIndex);
+            return true;
+        }
+    }
+
+    pJob = m_Workers[workerIndex]->deque.Pop();
+
+    if (pJob == nullptr && m_NumQueued.load(std::memory_order_relaxed) > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_SharedQueueMutex);
+            if (!m_SharedQueue.empty())
+            {
+                pJob = m_SharedQueue.back();
+                m_SharedQueue.pop_back();
+            }
+        }
+
+        // Steal from the others, starting somewhere different each time.
+        Worker* pWorker = m_Workers[workerIndex];
+        for (unsigned int i = 0; i < m_NumThreads && pJob == nullptr; i++)
+        {
+            unsigned int victim = (pWorker->nextVictim + i) % m_NumThreads;
+            if (victim == workerIndex)
+                continue;
+
+            pJob = m_Workers[victim]->deque.Steal();
+            if (pJob)
+            {
+                pWorker->nextVictim = victim;
+                pWorker->stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    if (pJob == nullptr)
+        return false;
+
+    m_NumQueued.fetch_sub(1);
+    Execute(pJob, workerIndex);
+    return true;
+}
+
+void JobSystem::Execute(Job* pJob, unsigned int workerIndex)
+{
+    if (m_BeginHook)
+    {
+        m_BeginHook(pJob->name, workerIndex, m_pProfileUserData);
+    }
+
+    pJob->pInvoke(pJob);
+
+    if (m_EndHook)
+    {
+        m_EndHook(pJob->name, workerIndex, m_pProfileUserData);
+    }
+
+    JobCounter* pSignal = pJob->pSignal;
+    pJob->pDestroy(pJob);
+
+    m_Workers[workerIndex]->executed.fetch_add(1, std::memory_order_relaxed);
+    m_Workers[workerIndex]->freeJobs.push_back(pJob);
+
+    if (pSignal)
+    {
+        Signal(pSignal);
+    }
+}
+
+void JobSystem::Signal(JobCounter* pCounter)
+{
+    std::vector<Job*> readyJobs;
+    {
+        std::lock_guard<std::mutex> lock(pCounter->m_Mutex);
+        if (pCounter->m_Count.fetch_sub(1) == 1)
+        {
+            readyJobs.swap(pCounter->m_WaitingJobs);
+        }
+    }
+
+    // The counter may be gone already, only the local list is used from here.
+    for (Job* pJob : readyJobs)
+    {
+        Push(pJob);
+    }
+}
+
+void JobSystem::WorkerMain(unsigned int workerIndex)
+{
+    t_pJobSystem = this;
+    t_WorkerIndex = workerIndex;
+
+    while (!m_Quit)
+    {
+        if (RunOneJob(workerIndex))
+            continue;
+
+        // Spin a little before sleeping, new jobs often show up right away.
+        bool foundJob = false;
+        for (int i = 0; i < 64 && !foundJob; i++)
+        {
+            std::this_thread::yield();
+            foundJob = m_NumQueued.load() > 0;
+        }
+        if (foundJob)
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_NumSleeping.fetch_add(1);
+        m_WakeUp.wait(lock, [this]() { return m_NumQueued.load() > 0 || m_Quit; });
+        m_NumSleeping.fetch_sub(1);
+    }
+}
+
+} // namespace fw
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace fw {
+
+class JobCounter;
+class JobSystem;
+
+enum class JobAffinity
+{
+    Any,
+    MainThread, // For GL work, only run by the thread that created the JobSystem.
+};
+
+// A queued function, with its captures stored inline so queuing one doesn't allocate.
+struct Job
+{
+    static const size_t MaxFuncSize = 64;
+
+    void (*pInvoke)(Job* pJob) = nullptr;
+    void (*pDestroy)(Job* pJob) = nullptr;
+
+    const char* name = nullptr;
+    JobCounter* pSignal = nullptr;
+    JobAffinity affinity = JobAffinity::Any;
+
+    alignas(16) unsigned char func[MaxFuncSize];
+};
+
+// Number of unfinished jobs that signal it. Jobs can be held back until one reaches zero,
+// and JobSystem::Wait() runs other jobs until it does.
+class JobCounter
+{
+    friend class JobSystem;
+
+public:
+    JobCounter() {}
+    JobCounter(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+    int GetCount() const { return m_Count.load(std::memory_order_relaxed); }
+
+protected:
+    std::atomic<int> m_Count{ 0 };
+
+    // Jobs that depend on this counter, queued when it reaches zero.
+    std::mutex m_Mutex;
+    std::vector<Job*> m_WaitingJobs;
+};
+
+struct JobStats
+{
+    uint64_t executed = 0;
+    uint64_t stolen = 0;
+};
+
+// Called around every job with its name and the index of the thread running it.
+typedef void (*JobProfileHook)(const char* name, unsigned int workerIndex, void* pUserData);
+
+// Worker threads that each own a Chase-Lev deque. A thread pushes and pops jobs at the bottom of its own deque
+// and steals from the top of the others' when it runs out. The thread that creates the JobSystem is worker 0,
+// it only runs jobs while it's in Wait(), ParallelFor() or RunMainThreadJobs().
+class JobSystem
+{
+public:
+    static const unsigned int MaxWorkers = 64;
+
+    // numThreads includes the calling thread, 0 picks one per core.
+    JobSystem(unsigned int numThreads = 0);
+    virtual ~JobSystem();
+
+    // Queues func(), pSignal goes down by one once it's done. With a dependency the job isn't queued until that's done.
+    template <class Func> void Run(const char* name, Func&& func, JobCounter* pSignal = nullptr, JobCounter* pDependency = nullptr, JobAffinity affinity = JobAffinity::Any);
+
+    // Runs other jobs until the counter reaches zero, so waiting threads never sit idle.
+    // Jobs can only be queued and waited on from the thread that created the JobSystem, or from inside a job.
+    // Waiting on a counter that needs main thread jobs only finishes when called from the main thread.
+    void Wait(JobCounter* pCounter);
+
+    // Calls body(begin, end) over ranges that cover [0, count), spread across the threads, returns when all are done.
+    // Ranges are split in half until they're near count / (threads * 4), but never below minGrainSize.
+    template <class Func> void ParallelFor(const char* name, size_t count, Func&& body, size_t minGrainSize = 1);
+
+    // Runs the main thread jobs queued so far, call once a frame on the main thread.
+    void RunMainThreadJobs();
+
+    unsigned int GetNumThreads() const { return m_NumThreads; }
+
+    // 0 on the main thread, and on threads that don't belong to a JobSystem.
+    static unsigned int GetCurrentWorkerIndex();
+
+    // True on the thread that created the JobSystem and on its workers, the only ones allowed to queue and wait.
+    bool IsOwnThread() const;
+
+    // Set these before queuing anything, they're read without a lock.
+    void SetProfileHooks(JobProfileHook beginHook, JobProfileHook endHook, void* pUserData);
+
+    JobStats GetStats(unsigned int workerIndex) const;
+    void ResetStats();
+
+protected:
+    struct Worker;
+
+    Job* AllocateJob();
+    void Submit(Job* pJob, JobCounter* pDependency);
+    void Push(Job* pJob);
+    bool RunOneJob(unsigned int workerIndex);
+    void Execute(Job* pJob, unsigned int workerIndex);
+    void Signal(JobCounter* pCounter);
+    void WorkerMain(unsigned int workerIndex);
+
+    template <class Func> void SplitRange(const char* name, size_t begin, size_t end, size_t grainSize, Func& body, JobCounter* pCounter);
+
+protected:
+    unsigned int m_NumThreads = 1;
+    std::thread::id m_MainThreadID;
+    std::vector<Worker*> m_Workers;
+
+    // Jobs pushed from threads without a deque.
+    std::mutex m_SharedQueueMutex;
+    std::vector<Job*> m_SharedQueue;
+
+    std::mutex m_MainQueueMutex;
+    std::vector<Job*> m_MainQueue;
+
+    // Queued jobs any worker can take, sleeping workers wake up when it goes above zero.
+    std::atomic<int> m_NumQueued{ 0 };
+    std::atomic<int> m_NumSleeping{ 0 };
+    std::atomic<bool> m_Quit{ false };
+    std::mutex m_SleepMutex;
+    std::condition_variable m_WakeUp;
+
+    JobProfileHook m_BeginHook = nullptr;
+    JobProfileHook m_EndHook = nullptr;
+    void* m_pProfileUserData = nullptr;
+};
+
+template <class Func> void JobSystem::Run(const char* name, Func&& func, JobCounter* pSignal, JobCounter* pDependency, JobAffinity affinity)
+{
+    typedef typename std::decay<Func>::type FuncType;
+    static_assert(sizeof(FuncType) <= Job::MaxFuncSize, "Job function is too big, capture large things by reference.");
+    static_assert(alignof(FuncType) <= 16, "Job function needs more alignment than a Job has.");
+
+    Job* pJob = AllocateJob();
+    new (pJob->func) FuncType(std::forward<Func>(func));
+    pJob->pInvoke = [](Job* pJob) { (*reinterpret_cast<FuncType*>(pJob->func))(); };
+    pJob->pDestroy = [](Job* pJob) { reinterpret_cast<FuncType*>(pJob->func)->~FuncType(); };
+    pJob->name = name;
+    pJob->pSignal = pSignal;
+    pJob->affinity = affinity;
+
+    // Counted now, the job could be finished before Submit returns.
+    if (pSignal)
+    {
+        pSignal->m_Count.fetch_add(1);
+    }
+
+    Submit(pJob, pDependency);
+}
+
+template <class Func> void JobSystem::ParallelFor(const char* name, size_t count, Func&& body, size_t minGrainSize)
+{
+    if (count == 0)
+        return;
+
+    size_t grainSize = count / (m_NumThreads * 4);
+    if (grainSize < minGrainSize)
+        grainSize = minGrainSize;
+    if (grainSize < 1)
+        grainSize = 1;
+
+    if (count <= grainSize)
+    {
+        body(size_t(0), count);
+        return;
+    }
+
+    JobCounter counter;
+    SplitRange(name, 0, count, grainSize, body, &counter);
+    Wait(&counter);
+}
+
+template <class Func> void JobSystem::SplitRange(const char* name, size_t begin, size_t end, size_t grainSize, Func& body, JobCounter* pCounter)
+{
+    // Hand the upper half to whoever steals it and keep splitting the lower half here.
+    while (end - begin > grainSize)
+    {
+        size_t middle = begin + (end - begin) / 2;
+        Run(name, [this, name, middle, end, grainSize, &body, pCounter]() { SplitRange(name, middle, end, grainSize, body, pCounter); }, pCounter);
+        end = middle;
+    }
+
+    body(begin, end);
+}
+
+} // namespace fw
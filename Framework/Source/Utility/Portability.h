@@ -0,0 +1,67 @@
+#pragma once
+
+// Stand-ins for the MSVC secure CRT functions used around the framework, for builds outside of Windows.
+// Only covers the way the framework calls them, i.e. no %s or %c in sscanf_s formats.
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef int errno_t;
+
+#define _TRUNCATE ((size_t)-1)
+
+inline errno_t fopen_s(FILE** ppFile, const char* filename, const char* mode)
+{
+    *ppFile = fopen( filename, mode );
+    return *ppFile ? 0 : errno;
+}
+
+inline int vsnprintf_s(char* buffer, size_t size, size_t count, const char* format, va_list args)
+{
+    return vsnprintf( buffer, count < size ? count + 1 : size, format, args );
+}
+
+template<size_t size> errno_t strcpy_s(char (&dest)[size], const char* src)
+{
+    if( strlen( src ) >= size )
+    {
+        dest[0] = '\0';
+        return ERANGE;
+    }
+    strcpy( dest, src );
+    return 0;
+}
+
+#define sprintf_s snprintf
+#define sscanf_s sscanf
+#define strtok_s strtok_r
+
+// Win32 virtual-key codes, the IDs InputEvents use for keys that aren't letters or digits.
+#define VK_BACK     0x08
+#define VK_TAB      0x09
+#define VK_RETURN   0x0D
+#define VK_SHIFT    0x10
+#define VK_CONTROL  0x11
+#define VK_MENU     0x12
+#define VK_ESCAPE   0x1B
+#define VK_SPACE    0x20
+#define VK_PRIOR    0x21
+#define VK_NEXT     0x22
+#define VK_END      0x23
+#define VK_HOME     0x24
+#define VK_LEFT     0x25
+#define VK_UP       0x26
+#define VK_RIGHT    0x27
+#define VK_DOWN     0x28
+#define VK_INSERT   0x2D
+#define VK_DELETE   0x2E
+#define VK_LWIN     0x5B
+#define VK_RWIN     0x5C
+#define VK_LSHIFT   0xA0
+#define VK_RSHIFT   0xA1
+#define VK_LCONTROL 0xA2
+#define VK_RCONTROL 0xA3
+#define VK_LMENU    0xA4
+#define VK_RMENU    0xA5
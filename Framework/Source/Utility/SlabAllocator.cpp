@@ -0,0 +1,241 @@
+#include "CoreHeaders.h"
+
+#include "SlabAllocator.h"
+
+#include <new>
+#include <stdlib.h>
+
+namespace fw {
+
+// Room at the start of every block for the pool that owns it, keeps the first slot on a cache line boundary.
+static const size_t c_BlockHeaderSize = 64;
+
+// Enough for anything the pooled classes hold. Slots aren't padded out to whole cache lines,
+// that would take MeshComponent from 80 to 128 bytes, and packed slots mean fewer lines to walk a pool.
+static const size_t c_SlotAlignment = 16;
+
+struct SlabTypeRegistry
+{
+    std::mutex mutex;
+    const char* names[MaxSlabTypes] = {};
+    size_t sizes[MaxSlabTypes] = {};
+    unsigned int count = 0;
+};
+
+static SlabTypeRegistry& GetRegistry()
+{
+    static SlabTypeRegistry registry;
+    return registry;
+}
+
+static thread_local SlabArena* t_pCurrentArena = nullptr;
+
+SlabTypeID RegisterSlabType(const char* name, size_t size)
+{
+    SlabTypeRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Raise MaxSlabTypes if this fires.
+    assert(registry.count < MaxSlabTypes);
+
+    registry.names[registry.count] = name;
+    registry.sizes[registry.count] = size;
+    return registry.count++;
+}
+
+SlabPool::SlabPool(const char* name, size_t slotSize)
+{
+    // Every slot has to be able to hold the free list's next pointer.
+    if (slotSize < sizeof(void*))
+    {
+        slotSize = sizeof(void*);
+    }
+
+    m_SlotSize = (slotSize + c_SlotAlignment - 1) & ~(c_SlotAlignment - 1);
+    m_SlotsPerBlock = (BlockSize - c_BlockHeaderSize) / m_SlotSize;
+    assert(m_SlotsPerBlock > 0);
+
+    m_Stats.name = name;
+    m_Stats.slotSize = m_SlotSize;
+}
+
+SlabPool::~SlabPool()
+{
+    for (void* pBlock : m_Blocks)
+    {
+#if _WIN32
+        _aligned_free(pBlock);
+#else
+        free(pBlock);
+#endif
+    }
+}
+
+void* SlabPool::Allocate()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (m_pFreeList == nullptr)
+    {
+        AddBlock();
+    }
+
+    void* pSlot = m_pFreeList;
+    m_pFreeList = *static_cast<void**>(pSlot);
+
+    m_Stats.numAllocations++;
+    m_Stats.numLive++;
+    if (m_Stats.numLive > m_Stats.peakLive)
+    {
+        m_Stats.peakLive = m_Stats.numLive;
+    }
+
+    return pSlot;
+}
+
+void SlabPool::Free(void* pSlot)
+{
+    uintptr_t blockAddress = reinterpret_cast<uintptr_t>(pSlot) & ~(static_cast<uintptr_t>(BlockSize) - 1);
+    SlabPool* pPool = *reinterpret_cast<SlabPool**>(blockAddress);
+
+    std::lock_guard<std::mutex> lock(pPool->m_Mutex);
+
+    *static_cast<void**>(pSlot) = pPool->m_pFreeList;
+    pPool->m_pFreeList = pSlot;
+
+    pPool->m_Stats.numFrees++;
+    pPool->m_Stats.numLive--;
+}
+
+SlabStats SlabPool::GetStats()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+void SlabPool::AddBlock()
+{
+#if _WIN32
+    unsigned char* pBlock = static_cast<unsigned char*>(_aligned_malloc(BlockSize, BlockSize));
+#else
+    unsigned char* pBlock = static_cast<unsigned char*>(aligned_alloc(BlockSize, BlockSize));
+#endif
+    if (pBlock == nullptr)
+    {
+        // Comes through the pooled classes' operator new, which can't return null.
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast<SlabPool**>(pBlock) = this;
+    m_Blocks.push_back(pBlock);
+
+    // Linked back to front, so the first allocations come from the start of the block.
+    unsigned char* pFirstSlot = pBlock + c_BlockHeaderSize;
+    for (size_t i = m_SlotsPerBlock; i > 0; i--)
+    {
+        void* pSlot = pFirstSlot + (i - 1) * m_SlotSize;
+        *static_cast<void**>(pSlot) = m_pFreeList;
+        m_pFreeList = pSlot;
+    }
+
+    m_Stats.numBlocks++;
+    m_Stats.capacity += m_SlotsPerBlock;
+}
+
+SlabArena::SlabArena(const char* name)
+{
+    m_Name = name;
+}
+
+SlabArena::~SlabArena()
+{
+    assert(t_pCurrentArena != this);
+
+    for (std::atomic<SlabPool*>& pPool : m_Pools)
+    {
+        delete pPool.load();
+    }
+}
+
+void* SlabArena::Allocate(SlabTypeID typeID, size_t size)
+{
+    if (size != GetRegistry().sizes[typeID])
+    {
+        return ::operator new(size);
+    }
+
+    return GetCurrent()->GetPool(typeID)->Allocate();
+}
+
+void SlabArena::Free(SlabTypeID typeID, void* p, size_t size)
+{
+    if (p == nullptr)
+        return;
+
+    if (size != GetRegistry().sizes[typeID])
+    {
+        ::operator delete(p);
+        return;
+    }
+
+    // The slot knows its pool, so it doesn't matter which arena is current now.
+    SlabPool::Free(p);
+}
+
+SlabArena* SlabArena::GetDefault()
+{
+    // Never deleted, objects in it can outlive any static that would own it.
+    static SlabArena* pDefaultArena = new SlabArena("Default");
+    return pDefaultArena;
+}
+
+SlabArena* SlabArena::GetCurrent()
+{
+    return t_pCurrentArena ? t_pCurrentArena : GetDefault();
+}
+
+void SlabArena::GetStats(std::vector<SlabStats>& stats)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    stats.clear();
+    for (std::atomic<SlabPool*>& pPool : m_Pools)
+    {
+        if (pPool.load())
+        {
+            stats.push_back(pPool.load()->GetStats());
+        }
+    }
+}
+
+SlabPool* SlabArena::GetPool(SlabTypeID typeID)
+{
+    SlabPool* pPool = m_Pools[typeID].load(std::memory_order_acquire);
+    if (pPool)
+        return pPool;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    pPool = m_Pools[typeID].load();
+    if (pPool == nullptr)
+    {
+        SlabTypeRegistry& registry = GetRegistry();
+        pPool = new SlabPool(registry.names[typeID], registry.sizes[typeID]);
+        m_Pools[typeID].store(pPool, std::memory_order_release);
+    }
+
+    return pPool;
+}
+
+SlabArena::Scope::Scope(SlabArena* pArena)
+{
+    m_pPreviousArena = t_pCurrentArena;
+    t_pCurrentArena = pArena;
+}
+
+SlabArena::Scope::~Scope()
+{
+    t_pCurrentArena = m_pPreviousArena;
+}
+
+} // namespace fw
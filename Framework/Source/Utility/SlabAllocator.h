@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+namespace fw {
+
+class SlabPool;
+
+// Dense integer per pooled class, each SlabArena keeps one SlabPool per ID.
+typedef unsigned int SlabTypeID;
+
+static const unsigned int MaxSlabTypes = 32;
+
+// Hands out the next ID, a class registers once with the size of its objects.
+SlabTypeID RegisterSlabType(const char* name, size_t size);
+
+template <class Type> SlabTypeID GetSlabTypeID(const char* name)
+{
+    static const SlabTypeID id = RegisterSlabType(name, sizeof(Type));
+    return id;
+}
+
+struct SlabStats
+{
+    const char* name = nullptr;
+    size_t slotSize = 0;
+
+    size_t numLive = 0;
+    size_t peakLive = 0;
+    size_t capacity = 0; // Slots in every block, used or not.
+    size_t numBlocks = 0;
+
+    uint64_t numAllocations = 0;
+    uint64_t numFrees = 0;
+
+    // Share of the reserved slots that are empty, 0 when every block is full.
+    float GetFragmentation() const { return capacity > 0 ? 1.0f - static_cast<float>(numLive) / capacity : 0.0f; }
+};
+
+// Fixed size, 16 byte aligned slots carved out of 64KB blocks, with a free list through the empty ones.
+// Blocks are aligned to their size, so any slot can find its pool from its own address.
+class SlabPool
+{
+public:
+    static const size_t BlockSize = 64 * 1024;
+
+    SlabPool(const char* name, size_t slotSize);
+    virtual ~SlabPool();
+
+    void* Allocate();
+    static void Free(void* pSlot);
+
+    SlabStats GetStats();
+
+protected:
+    void AddBlock();
+
+protected:
+    std::mutex m_Mutex;
+
+    size_t m_SlotSize = 0;
+    size_t m_SlotsPerBlock = 0;
+
+    void* m_pFreeList = nullptr;
+    std::vector<void*> m_Blocks;
+
+    SlabStats m_Stats;
+};
+
+// A SlabPool for every pooled class. Objects of those classes come from the current arena of the thread that
+// creates them, which is a shared default one unless a Scope says otherwise. Deleting an arena frees all its blocks
+// at once, whatever is left in them, so a scene can own one and drop everything it spawned on teardown.
+class SlabArena
+{
+public:
+    SlabArena(const char* name);
+    virtual ~SlabArena();
+
+    // Used by the pooled classes' operator new/delete. Anything bigger than the registered size,
+    // i.e. a subclass with its own members, goes to the regular heap instead.
+    static void* Allocate(SlabTypeID typeID, size_t size);
+    static void Free(SlabTypeID typeID, void* p, size_t size);
+
+    static SlabArena* GetDefault();
+    static SlabArena* GetCurrent();
+
+    const char* GetName() const { return m_Name; }
+
+    // One entry per class that has been allocated from this arena.
+    void GetStats(std::vector<SlabStats>& stats);
+
+    // Makes an arena the current one on this thread for as long as it's in scope.
+    class Scope
+    {
+    public:
+        Scope(SlabArena* pArena);
+        ~Scope();
+
+    protected:
+        SlabArena* m_pPreviousArena = nullptr;
+    };
+
+protected:
+    SlabPool* GetPool(SlabTypeID typeID);
+
+protected:
+    const char* m_Name = nullptr;
+
+    // Created on first use, the lock is only taken then.
+    std::mutex m_Mutex;
+    std::atomic<SlabPool*> m_Pools[MaxSlabTypes] = {};
+};
+
+} // namespace fw
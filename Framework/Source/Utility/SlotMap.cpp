@@ -0,0 +1,75 @@
+#include "CoreHeaders.h"
+
+#include "SlotMap.h"
+
+namespace fw {
+
+Handle HandleTable::Add(uint32_t denseIndex)
+{
+    uint32_t index = m_FirstFreeSlot;
+    if (index != Handle::InvalidIndex)
+    {
+        m_FirstFreeSlot = m_Slots[index].denseIndex;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_Slots.size());
+        m_Slots.emplace_back();
+    }
+
+    Slot& slot = m_Slots[index];
+    slot.denseIndex = denseIndex;
+    slot.generation++;
+
+    Handle handle;
+    handle.index = index;
+    handle.generation = slot.generation;
+    return handle;
+}
+
+void HandleTable::Remove(Handle handle)
+{
+    assert(Contains(handle));
+
+    Slot& slot = m_Slots[handle.index];
+    slot.generation++;
+    slot.denseIndex = m_FirstFreeSlot;
+    m_FirstFreeSlot = handle.index;
+}
+
+uint32_t HandleTable::Find(Handle handle) const
+{
+    if (handle.index >= m_Slots.size())
+        return Handle::InvalidIndex;
+
+    const Slot& slot = m_Slots[handle.index];
+    if (slot.generation != handle.generation || (slot.generation & 1) == 0)
+        return Handle::InvalidIndex;
+
+    return slot.denseIndex;
+}
+
+void HandleTable::SetDenseIndex(Handle handle, uint32_t denseIndex)
+{
+    assert(Contains(handle));
+
+    m_Slots[handle.index].denseIndex = denseIndex;
+}
+
+void HandleTable::Clear()
+{
+    // Bump every generation instead of dropping the slots, so handles from before don't resolve after.
+    m_FirstFreeSlot = Handle::InvalidIndex;
+    for (uint32_t i = static_cast<uint32_t>(m_Slots.size()); i > 0; i--)
+    {
+        Slot& slot = m_Slots[i - 1];
+        if (slot.generation & 1)
+        {
+            slot.generation++;
+        }
+        slot.denseIndex = m_FirstFreeSlot;
+        m_FirstFreeSlot = i - 1;
+    }
+}
+
+} // namespace fw
@@ -0,0 +1,113 @@
+#pragma once
+
+namespace fw {
+
+// Refers to something in a HandleTable without pointing at it. The slot's generation moves on when what it
+// refers to is removed, so an old handle stops resolving instead of finding whatever reused the slot.
+struct Handle
+{
+    static const uint32_t InvalidIndex = 0xFFFFFFFF;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != InvalidIndex; }
+
+    bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+// Maps handles to positions in a dense array kept by the owner, who tells it when an element moves.
+// Freed slots are reused, last freed first.
+class HandleTable
+{
+public:
+    Handle Add(uint32_t denseIndex);
+    void Remove(Handle handle);
+
+    // Handle::InvalidIndex for handles to something that was removed.
+    uint32_t Find(Handle handle) const;
+    bool Contains(Handle handle) const { return Find(handle) != Handle::InvalidIndex; }
+
+    void SetDenseIndex(Handle handle, uint32_t denseIndex);
+
+    void Clear();
+
+protected:
+    // Odd generations are in use, so a default Handle never matches and a slot fits in 8 bytes.
+    struct Slot
+    {
+        // Next free slot while this one is free.
+        uint32_t denseIndex = Handle::InvalidIndex;
+        uint32_t generation = 0;
+    };
+
+    std::vector<Slot> m_Slots;
+    uint32_t m_FirstFreeSlot = Handle::InvalidIndex;
+};
+
+// Values packed with no holes, plus a handle for each that stays the same while the value is in the map.
+// Removing moves the last value into the freed spot, so the order changes as values come and go.
+template <class Type> class SlotMap
+{
+public:
+    Handle Add(const Type& value)
+    {
+        Handle handle = m_Table.Add(static_cast<uint32_t>(m_Values.size()));
+        m_Values.push_back(value);
+        m_Handles.push_back(handle);
+        return handle;
+    }
+
+    void Remove(Handle handle)
+    {
+        uint32_t index = m_Table.Find(handle);
+        assert(index != Handle::InvalidIndex);
+
+        // Fill the hole with the last value.
+        m_Values[index] = m_Values.back();
+        m_Handles[index] = m_Handles.back();
+        m_Table.SetDenseIndex(m_Handles[index], index);
+
+        m_Values.pop_back();
+        m_Handles.pop_back();
+        m_Table.Remove(handle);
+    }
+
+    // nullptr for handles to something that was removed.
+    Type* Get(Handle handle)
+    {
+        uint32_t index = m_Table.Find(handle);
+        return index != Handle::InvalidIndex ? &m_Values[index] : nullptr;
+    }
+
+    bool Contains(Handle handle) const { return m_Table.Contains(handle); }
+
+    Handle GetHandle(size_t index) const { return m_Handles[index]; }
+
+    void Clear()
+    {
+        m_Values.clear();
+        m_Handles.clear();
+        m_Table.Clear();
+    }
+
+    size_t GetSize() const { return m_Values.size(); }
+    bool IsEmpty() const { return m_Values.empty(); }
+
+    Type& operator[](size_t index) { return m_Values[index]; }
+    const Type& operator[](size_t index) const { return m_Values[index]; }
+
+    typename std::vector<Type>::iterator begin() { return m_Values.begin(); }
+    typename std::vector<Type>::iterator end() { return m_Values.end(); }
+    typename std::vector<Type>::const_iterator begin() const { return m_Values.begin(); }
+    typename std::vector<Type>::const_iterator end() const { return m_Values.end(); }
+
+protected:
+    HandleTable m_Table;
+
+    std::vector<Type> m_Values;
+    std::vector<Handle> m_Handles;
+};
+
+} // namespace fw
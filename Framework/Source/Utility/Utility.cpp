@@ -1,5 +1,9 @@
 #include "CoreHeaders.h"
 
+#if !_WIN32
+#include <time.h>
+#endif
+
 namespace fw {
 
 void OutputMessage(const char* message, ...)
@@ -12,7 +16,11 @@ void OutputMessage(const char* message, ...)
     va_end(arg);
 
     szBuff[MAX_MESSAGE-1] = 0; // vsnprintf_s might do this, but docs are unclear.
+#if _WIN32
     OutputDebugString( szBuff );
+#else
+    fputs( szBuff, stderr );
+#endif
 }
 
 char* LoadCompleteFile(const char* filename, long* length)
@@ -41,8 +49,163 @@ char* LoadCompleteFile(const char* filename, long* length)
     return filecontents;
 }
 
+bool SaveCompleteFile(const char* filename, const unsigned char* data, size_t length)
+{
+    FILE* filehandle;
+    if( fopen_s( &filehandle, filename, "wb" ) != 0 || filehandle == nullptr )
+        return false;
+
+    size_t written = fwrite( data, 1, length, filehandle );
+    fclose( filehandle );
+
+    return written == length;
+}
+
+struct PNG_CRC32Table
+{
+    unsigned int entries[256];
+};
+
+static PNG_CRC32Table PNG_BuildCRC32Table()
+{
+    PNG_CRC32Table table;
+    for( unsigned int n=0; n<256; n++ )
+    {
+        unsigned int c = n;
+        for( int k=0; k<8; k++ )
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        table.entries[n] = c;
+    }
+    return table;
+}
+
+static unsigned int PNG_CRC32(const unsigned char* data, size_t length, unsigned int crc = 0)
+{
+    // Built once, the first thread to get here builds it and any others wait.
+    static const PNG_CRC32Table table = PNG_BuildCRC32Table();
+
+    crc = ~crc;
+    for( size_t i=0; i<length; i++ )
+        crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+static void PNG_PushUInt32(std::vector<unsigned char>& out, unsigned int value)
+{
+    out.push_back( (unsigned char)(value >> 24) );
+    out.push_back( (unsigned char)(value >> 16) );
+    out.push_back( (unsigned char)(value >> 8) );
+    out.push_back( (unsigned char)(value) );
+}
+
+static void PNG_PushChunk(std::vector<unsigned char>& out, const char* type, const unsigned char* data, size_t length)
+{
+    PNG_PushUInt32( out, (unsigned int)length );
+
+    size_t typeStart = out.size();
+    out.insert( out.end(), type, type + 4 );
+    out.insert( out.end(), data, data + length );
+
+    PNG_PushUInt32( out, PNG_CRC32( &out[typeStart], length + 4 ) );
+}
+
+void EncodePNG(const unsigned char* pixels, int width, int height, bool flipVertically, std::vector<unsigned char>& png)
+{
+    // 8 bit RGBA, no filtering and stored (uncompressed) deflate blocks.
+    // Bigger files than a real compressor, but cheap enough to keep up with a capture every frame.
+    size_t rowSize = (size_t)width * 4;
+    size_t rawSize = (rowSize + 1) * height;
+
+    unsigned char header[13];
+    header[0] = (unsigned char)(width >> 24); header[1] = (unsigned char)(width >> 16); header[2] = (unsigned char)(width >> 8); header[3] = (unsigned char)width;
+    header[4] = (unsigned char)(height >> 24); header[5] = (unsigned char)(height >> 16); header[6] = (unsigned char)(height >> 8); header[7] = (unsigned char)height;
+    header[8] = 8;  // Bit depth.
+    header[9] = 6;  // Color type, RGBA.
+    header[10] = 0; // Compression.
+    header[11] = 0; // Filter.
+    header[12] = 0; // Interlace.
+
+    // zlib stream: header, stored blocks of at most 65535 bytes, adler32.
+    const size_t maxBlockSize = 65535;
+    size_t numBlocks = rawSize / maxBlockSize + 1;
+
+    std::vector<unsigned char> zlib;
+    zlib.reserve( 2 + rawSize + numBlocks * 5 + 4 );
+    zlib.push_back( 0x78 );
+    zlib.push_back( 0x01 );
+
+    unsigned int adlerA = 1;
+    unsigned int adlerB = 0;
+
+    size_t blockLeft = 0;
+    size_t rawLeft = rawSize;
+
+    // Appends bytes to the stream, starting new stored blocks as needed.
+    auto write = [&](const unsigned char* pData, size_t length)
+    {
+        while( length > 0 )
+        {
+            if( blockLeft == 0 )
+            {
+                blockLeft = rawLeft < maxBlockSize ? rawLeft : maxBlockSize;
+                rawLeft -= blockLeft;
+
+                zlib.push_back( rawLeft == 0 ? 1 : 0 );
+                zlib.push_back( (unsigned char)(blockLeft) );
+                zlib.push_back( (unsigned char)(blockLeft >> 8) );
+                zlib.push_back( (unsigned char)(~blockLeft) );
+                zlib.push_back( (unsigned char)(~blockLeft >> 8) );
+            }
+
+            size_t count = length < blockLeft ? length : blockLeft;
+            zlib.insert( zlib.end(), pData, pData + count );
+
+            // 5552 is the most bytes that can be summed before the 32 bit adler sums can overflow.
+            for( size_t i=0; i<count; )
+            {
+                size_t run = count - i < 5552 ? count - i : 5552;
+                for( size_t j=0; j<run; j++ )
+                {
+                    adlerA += pData[i + j];
+                    adlerB += adlerA;
+                }
+                adlerA %= 65521;
+                adlerB %= 65521;
+                i += run;
+            }
+
+            pData += count;
+            length -= count;
+            blockLeft -= count;
+        }
+    };
+
+    const unsigned char filterNone = 0;
+    for( int y=0; y<height; y++ )
+    {
+        const unsigned char* pRow = pixels + rowSize * (flipVertically ? height - 1 - y : y);
+
+        write( &filterNone, 1 );
+        write( pRow, rowSize );
+    }
+
+    PNG_PushUInt32( zlib, (adlerB << 16) | adlerA );
+
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    png.clear();
+    png.reserve( sizeof(signature) + 25 + zlib.size() + 12 + 12 );
+    png.insert( png.end(), signature, signature + sizeof(signature) );
+
+    PNG_PushChunk( png, "IHDR", header, sizeof(header) );
+    PNG_PushChunk( png, "IDAT", &zlib[0], zlib.size() );
+    PNG_PushChunk( png, "IEND", nullptr, 0 );
+}
+
 double GetSystemTime()
 {
+#if _WIN32
     unsigned __int64 freq;
     unsigned __int64 time;
 
@@ -52,6 +215,12 @@ double GetSystemTime()
     double timeseconds = (double)time / freq;
 
     return timeseconds;
+#else
+    timespec time;
+    clock_gettime( CLOCK_MONOTONIC, &time );
+
+    return time.tv_sec + time.tv_nsec * 1e-9;
+#endif
 }
 
 double GetSystemTimeSinceGameStart()
@@ -4,6 +4,8 @@ namespace fw {
 
 void OutputMessage(const char* message, ...);
 char* LoadCompleteFile(const char* filename, long* length);
+bool SaveCompleteFile(const char* filename, const unsigned char* data, size_t length);
+void EncodePNG(const unsigned char* pixels, int width, int height, bool flipVertically, std::vector<unsigned char>& png);
 double GetSystemTime();
 double GetSystemTimeSinceGameStart();
 
@@ -3,7 +3,7 @@ attribute vec3 a_Normal;
 
 uniform mat4 u_WorldMatrix;
 uniform mat4 u_WVPMatrix;
-uniform mat4 u_NormalMatrix;
+uniform mat3 u_NormalMatrix;
 
 uniform vec3 u_CamPos;
 
@@ -22,7 +22,7 @@ void main()
 
     gl_Position = clipSpacePosition;
 
-    vec4 normal = u_NormalMatrix * vec4(a_Normal, 0 );
+    vec3 normal = u_NormalMatrix * a_Normal;
 
     vec3 dirToSurface = worldSpacePosition.xyz - u_CamPos;
     v_ReflectedDir = reflect(dirToSurface, normal.xyz);
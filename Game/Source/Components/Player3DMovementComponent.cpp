@@ -61,8 +61,22 @@ void Player3DMovementComponent::Update(float deltaTime)
     //Move
     if (pPhysicsBody)
     {
-        pPhysicsBody->Update(deltaTime);
         pPhysicsBody->GetPhysicsBody()->ApplyForce(dir * speed, true);
         //pPhysicsBody->GetPhysicsBody()->ApplyTorque(vec3(0, strafeAxis, 0), true); //Camera would need to adjust
     }
 }
+
+// Input, so it runs before the physics step and the force moves the player in the same frame.
+Player3DMovementSystem::Player3DMovementSystem() : System("Player3DMovementSystem", fw::SystemStage::BeforePhysics)
+{
+    // Transforms are only read, the player's own and the camera's for steering.
+    // The PhysicsBodySystem copies the body back to the transform after the step.
+    Writes<Player3DMovementComponent>();
+    Reads<fw::TransformComponent>();
+    Writes<fw::PhysicsBodyComponent>();
+}
+
+void Player3DMovementSystem::Update(fw::ComponentManager* pManager, float deltaTime)
+{
+    ForEach<Player3DMovementComponent>(pManager, [deltaTime](Player3DMovementComponent* pComponent) { pComponent->Update(deltaTime); });
+}
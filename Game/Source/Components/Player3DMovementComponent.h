@@ -25,3 +25,11 @@ public:
     virtual const char* GetType() override { return GetStaticType(); }
 };
 
+// Pushes each player's physics body in the direction the camera is facing.
+class Player3DMovementSystem : public fw::System
+{
+public:
+    Player3DMovementSystem();
+
+    virtual void Update(fw::ComponentManager* pManager, float deltaTime) override;
+};
@@ -58,3 +58,16 @@ void SimplePlayerMovementComponent::Update(float deltaTime)
     m_pGameObject->GetTransform()->SetPosition(pos);
     m_pGameObject->GetTransform()->SetRotation(m_origRotation + vec3(0, m_pGameObject->GetScene()->GetCamera()->GetTransform()->GetRotation().y, 0));
 }
+
+// Input, so it runs before the physics step.
+SimplePlayerMovementSystem::SimplePlayerMovementSystem() : System("SimplePlayerMovementSystem", fw::SystemStage::BeforePhysics)
+{
+    // The camera's transform is read too, it's never a player so it doesn't race with the writes.
+    Writes<SimplePlayerMovementComponent>();
+    Writes<fw::TransformComponent>();
+}
+
+void SimplePlayerMovementSystem::Update(fw::ComponentManager* pManager, float deltaTime)
+{
+    ForEach<SimplePlayerMovementComponent>(pManager, [deltaTime](SimplePlayerMovementComponent* pComponent) { pComponent->Update(deltaTime); });
+}
@@ -24,3 +24,11 @@ public:
     virtual const char* GetType() override { return GetStaticType(); }
 };
 
+// Moves every player with one of these relative to the camera.
+class SimplePlayerMovementSystem : public fw::System
+{
+public:
+    SimplePlayerMovementSystem();
+
+    virtual void Update(fw::ComponentManager* pManager, float deltaTime) override;
+};
@@ -55,11 +55,11 @@ void Game::Init()
     m_pOffScreenFBO = new fw::FrameBufferObject(c_glRenderSize.x, c_glRenderSize.y, { fw::FrameBufferObject::FBOColorFormat_RGBA_UByte });
 
     // Setup Meshes 
-	m_pResourceManager->CreateMesh("Sprite", GL_TRIANGLES, g_SpriteVerts, g_SpriteIndices);
+	m_pResourceManager->CreateMesh("Sprite", GL_TRIANGLES, g_SpriteVerts.data, g_SpriteVerts.Count(), g_SpriteIndices.data, g_SpriteIndices.Count());
 	m_pResourceManager->CreateMesh("Background");
 	m_pResourceManager->GetMesh("Background")->CreatePlane(vec2(10.f, 2.f), ivec2(2, 2));
-	m_pResourceManager->CreateMesh("Platform", GL_TRIANGLES, g_BackgroundVerts, g_BackgroundIndices);
-    m_pResourceManager->CreateMesh("Cube", GL_TRIANGLES, g_CubeVerts);
+	m_pResourceManager->CreateMesh("Platform", GL_TRIANGLES, g_BackgroundVerts.data, g_BackgroundVerts.Count(), g_BackgroundIndices.data, g_BackgroundIndices.Count());
+    m_pResourceManager->CreateMesh("Cube", GL_TRIANGLES, g_CubeVerts.data, g_CubeVerts.Count());
 	m_pResourceManager->CreateMesh("Plane");
 	m_pResourceManager->GetMesh("Plane")->CreatePlane(vec2(100.f, 100.f), ivec2(1000, 1000));
     m_pResourceManager->CreateMesh("Cylinder");
@@ -240,7 +240,7 @@ void Game::Draw()
         //Render Cube
         fw::matrix identity;
         identity.SetIdentity();
-        m_pResourceManager->GetMesh("Cube")->Draw(nullptr, m_pCurrentScene->GetCamera(), m_pResourceManager->GetMaterial(m_activeCubeMap), identity, identity, 1, 0, 0);
+        m_pResourceManager->GetMesh("Cube")->Draw(nullptr, m_pCurrentScene->GetCamera(), m_pResourceManager->GetMaterial(m_activeCubeMap), identity, fw::mat3(), 1, 0, 0);
 
         //Re-Enable Z-Write
         glDepthMask(true);
@@ -250,6 +250,20 @@ void Game::Draw()
     m_pCurrentScene->Draw();
     m_pOffScreenFBO->Unbind();
 
+    // Screenshots are encoded and written by the FBO's readback worker a few frames from now.
+    if (m_saveScreenshot)
+    {
+        m_pOffScreenFBO->RequestReadback(0, [](fw::ReadbackResult& result)
+        {
+            char filename[64];
+            sprintf_s(filename, 64, "Screenshot_%u.png", result.frameRequested);
+            fw::SaveCompleteFile(filename, &result.data[0], result.data.size());
+        }, fw::ReadbackEncoding::PNG);
+
+        m_saveScreenshot = false;
+    }
+    m_pOffScreenFBO->ProcessReadbacks();
+
     // On-Screen
     glViewport(0,0, c_windowSize.x, c_windowSize.y);
     glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
@@ -463,6 +477,7 @@ void Game::MainMenu()
 				}
 
 				ImGui::MenuItem("Change Background Color", "Ctrl+B", &m_showBGColorSelect);
+				ImGui::MenuItem("Save Screenshot", "", &m_saveScreenshot);
 				ImGui::EndMenu();
 			}
 			if (ImGui::MenuItem("Quit", "Alt+F4")) { m_FWCore.Shutdown(); }
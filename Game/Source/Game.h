@@ -18,6 +18,7 @@ protected:
 	bool m_showDemo = false;
 	bool m_showBGColorSelect = false;
 	bool m_wireframeToggle = false;
+	bool m_saveScreenshot = false;
 	fw::Color4f m_backgroundColor = fw::Color4f::Black();
 	fw::Color4f m_backupColor = c_defaultBackground;
 
@@ -40,6 +41,8 @@ public:
     virtual void SetCurrentCubeMap(std::string cubeMap) { m_activeCubeMap = cubeMap; }
     virtual void SetUsingCubeMap(bool useCubeMap) { m_useCubeMap = useCubeMap; }
 
+    bool HasScene(std::string scene) { return m_Scenes.find(scene) != m_Scenes.end(); }
+
     // Getters.
 	fw::FWCore* GetFramework() { return &m_FWCore; }
 
@@ -62,7 +62,7 @@ void Player::Update(float deltaTime)
 	//Teleport
     if( m_pPlayerController->WasPressed( PlayerController::Action::Teleport ) )
     {
-        m_pTransform->SetPosition(vec2( rand()/(float)RAND_MAX * 15, rand()/(float)RAND_MAX * 15 ));
+        m_pTransform->SetPosition(vec2( fw::Random::GetFloat( 15.f ), fw::Random::GetFloat( 15.f ) ));
 
         if (pPhysicsBody)
         {
@@ -131,7 +131,7 @@ void Shaun::Update(float deltaTime)
 	//Teleport
     if( m_pPlayerController->WasPressed( PlayerController::Action::Teleport ) )
     {
-		m_pTransform->SetPosition(vec2( rand()/(float)RAND_MAX * 15, rand()/(float)RAND_MAX * 15 ));
+		m_pTransform->SetPosition(vec2( fw::Random::GetFloat( 15.f ), fw::Random::GetFloat( 15.f ) ));
 
         if (pPhysicsBody)
         {
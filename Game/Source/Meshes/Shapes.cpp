@@ -3,74 +3,38 @@
 #include "DataTypes.h"
 #include "Shapes.h"
 
-const std::vector<fw::VertexFormat> g_SpriteVerts =
-{
-    { vec3(-0.5f,-0.5f,0.f),  255,255,255,255,  vec2(0.0f,0.0f), vec3(0.f,0.f,-1.f) }, // bottom left //chage Normals to vec3(0.f,0.f,-1.f)
-    { vec3(-0.5f,0.5f,0.f),  255,255,255,255,  vec2(0.0f,1.0f), vec3(0.f,0.f,-1.f) }, // top left
-    { vec3(0.5f,-0.5f,0.f),  255,255,255,255,  vec2(1.0f,0.0f), vec3(0.f,0.f,-1.f) }, // bottom right
-    { vec3(0.5f,0.5f,0.f),  255,255,255,255,  vec2(1.0f,1.0f), vec3(0.f,0.f,-1.f) }, // top right
-};
+// Compile time checks on the generated shapes, a broken table fails the build instead of rendering wrong.
 
-const std::vector<unsigned int> g_SpriteIndices =
+// Every vert sits on the face its normal points out of, and every triangle winds the same way as the original tables.
+template<unsigned int N> constexpr bool IsClosedBox(const VertexArray<N>& verts, vec3 halfSize)
 {
-    0, 1, 2, 2, 1, 3,
-};
+    for( unsigned int i = 0; i < N; i += 3 )
+    {
+        const fw::VertexFormat& a = verts.data[i];
+        const fw::VertexFormat& b = verts.data[i+1];
+        const fw::VertexFormat& c = verts.data[i+2];
 
-const std::vector<fw::VertexFormat> g_BackgroundVerts =
-{
-	{ vec3(-0.5f,-0.5f,0.f),  255,255,255,255,  vec2(0.0f,0.0f), vec3(0.f,0.f,-1.f) }, // bottom left
-	{ vec3(-0.5f,0.5f,0.f),  255,255,255,255,  vec2(0.0f,1.0f), vec3(0.f,0.f,-1.f) }, // top left
-	{ vec3(0.5f,-0.5f,0.f),  255,255,255,255,  vec2(10.0f,0.0f), vec3(0.f,0.f,-1.f) }, // bottom right
-	{ vec3(0.5f,0.5f,0.f),  255,255,255,255,  vec2(10.0f,1.0f), vec3(0.f,0.f,-1.f) }, // top right
-};
+        if( (b.pos - a.pos).Cross( c.pos - a.pos ).Dot( a.normal ) <= 0 )
+            return false;
 
-const std::vector<unsigned int> g_BackgroundIndices =
-{
-	0, 1, 2, 2, 1, 3,
-};
+        for( unsigned int j = i; j < i + 3; j++ )
+        {
+            if( !fw::fequal( verts.data[j].pos.Dot( a.normal ), halfSize.Dot( a.normal * a.normal ) ) )
+                return false;
+        }
+    }
+    return true;
+}
+
+static_assert( g_SpriteVerts.Count() == 4, "Sprite should be a single quad." );
+static_assert( g_SpriteVerts.data[0].pos.x == -0.5f && g_SpriteVerts.data[0].pos.y == -0.5f, "Sprite should start at the bottom left." );
+static_assert( g_SpriteVerts.data[3].pos.x == 0.5f && g_SpriteVerts.data[3].uv.x == 1.f && g_SpriteVerts.data[3].uv.y == 1.f, "Sprite should end at the top right." );
+static_assert( g_SpriteVerts.data[1].normal.z == -1.f && g_SpriteVerts.data[1].color[3] == 255, "Sprite should face -z and be opaque white." );
+
+static_assert( g_BackgroundVerts.data[3].uv.x == 10.f && g_BackgroundVerts.data[3].uv.y == 1.f, "Background should repeat 10 times horizontally." );
+static_assert( g_BackgroundIndices.data[5] == 3, "Quads are 2 triangles." );
 
-const std::vector<fw::VertexFormat> g_CubeVerts =
-{   
-    //Side 1
-    { vec3(-0.5f,-0.5f,-0.5f),  255,255,255,255,     vec2(0.f,       0.f), vec3(0.f,0.f,-1.f) }, // Point 1
-    { vec3(0.5f,0.5f,-0.5f),  255,255,255,255,       vec2(1.f / 6.f, 1.f), vec3(0.f,0.f,-1.f) }, // Point 2
-    { vec3(0.5f,-0.5f,-0.5f),  255,255,255,255,      vec2(1.f / 6.f, 0.f), vec3(0.f,0.f,-1.f) }, // Point 3
-    { vec3(-0.5f,-0.5f,-0.5f),  255,255,255,255,     vec2(0.f,       0.f), vec3(0.f,0.f,-1.f) }, // Point 4
-    { vec3(-0.5f,0.5f,-0.5f),  255,255,255,255,      vec2(0.f,       1.f), vec3(0.f,0.f,-1.f) }, // Point 5
-    { vec3(0.5f,0.5f,-0.5f),  255,255,255,255,       vec2(1.f / 6.f, 1.f), vec3(0.f,0.f,-1.f) }, // Point 6
-    //Side 2
-    { vec3(-0.5f,0.5f,-0.5f),  255,255,255,255,      vec2(1.f / 6.f, 0.f), vec3(0.f,1.f,0.f) }, // Point 1
-    { vec3(0.5f,0.5f,0.5f),  255,255,255,255,        vec2(2.f / 6.f, 1.f), vec3(0.f,1.f,0.f) }, // Point 2
-    { vec3(0.5f,0.5f,-0.5f),  255,255,255,255,       vec2(2.f / 6.f, 0.f), vec3(0.f,1.f,0.f) }, // Point 3
-    { vec3(-0.5f,0.5f,-0.5f),  255,255,255,255,      vec2(1.f / 6.f, 0.f), vec3(0.f,1.f,0.f) }, // Point 4
-    { vec3(-0.5f,0.5f,0.5f),  255,255,255,255,       vec2(1.f / 6.f, 1.f), vec3(0.f,1.f,0.f) }, // Point 5
-    { vec3(0.5f,0.5f,0.5f),  255,255,255,255,        vec2(2.f / 6.f, 1.f), vec3(0.f,1.f,0.f) }, // Point 6
-    //Side 3
-    { vec3(-0.5f,0.5f,0.5f),  255,255,255,255,       vec2(3.f / 6.f, 1.f), vec3(0.f,0.f,1.f) }, // Point 1
-    { vec3(0.5f,-0.5f,0.5f),  255,255,255,255,       vec2(2.f / 6.f, 0.f), vec3(0.f,0.f,1.f) }, // Point 2
-    { vec3(0.5f,0.5f,0.5f),  255,255,255,255,        vec2(2.f / 6.f, 1.f), vec3(0.f,0.f,1.f) }, // Point 3
-    { vec3(-0.5f,0.5f,0.5f),  255,255,255,255,       vec2(3.f / 6.f, 1.f), vec3(0.f,0.f,1.f) }, // Point 4
-    { vec3(-0.5f,-0.5f,0.5f),  255,255,255,255,      vec2(3.f / 6.f, 0.f), vec3(0.f,0.f,1.f) }, // Point 5
-    { vec3(0.5f,-0.5f,0.5f),  255,255,255,255,       vec2(2.f / 6.f, 0.f), vec3(0.f,0.f,1.f) }, // Point 6
-    //Side 4
-    { vec3(-0.5f,-0.5f,0.5f),  255,255,255,255,      vec2(3.f / 6.f, 0.f), vec3(0.f,-1.f,0.f) }, // Point 1
-    { vec3(0.5f,-0.5f,-0.5f),  255,255,255,255,      vec2(4.f / 6.f, 1.f), vec3(0.f,-1.f,0.f) }, // Point 2
-    { vec3(0.5f,-0.5f,0.5f),  255,255,255,255,       vec2(4.f / 6.f, 0.f), vec3(0.f,-1.f,0.f) }, // Point 3
-    { vec3(-0.5f,-0.5f,0.5f),  255,255,255,255,      vec2(3.f / 6.f, 0.f), vec3(0.f,-1.f,0.f) }, // Point 4
-    { vec3(-0.5f,-0.5f,-0.5f),  255,255,255,255,     vec2(3.f / 6.f, 1.f), vec3(0.f,-1.f,0.f) }, // Point 5
-    { vec3(0.5f,-0.5f,-0.5f),  255,255,255,255,      vec2(4.f / 6.f, 1.f), vec3(0.f,-1.f,0.f) }, // Point 6
-    //Side 5
-    { vec3(0.5f,-0.5f,-0.5f),  255,255,255,255,      vec2(4.f / 6.f, 0.f), vec3(1.f,0.f,0.f) }, // Point 1
-    { vec3(0.5f,0.5f,0.5f),  255,255,255,255,        vec2(5.f / 6.f, 1.f), vec3(1.f,0.f,0.f) }, // Point 2
-    { vec3(0.5f,-0.5f,0.5f),  255,255,255,255,       vec2(5.f / 6.f, 0.f), vec3(1.f,0.f,0.f) }, // Point 3
-    { vec3(0.5f,-0.5f,-0.5f),  255,255,255,255,      vec2(4.f / 6.f, 0.f), vec3(1.f,0.f,0.f) }, // Point 4
-    { vec3(0.5f,0.5f,-0.5f),  255,255,255,255,       vec2(4.f / 6.f, 1.f), vec3(1.f,0.f,0.f) }, // Point 5
-    { vec3(0.5f,0.5f,0.5f),  255,255,255,255,        vec2(5.f / 6.f, 1.f), vec3(1.f,0.f,0.f) }, // Point 6
-    //Side 6
-    { vec3(-0.5f,-0.5f,0.5f),  255,255,255,255,      vec2(5.f / 6.f, 0.f), vec3(-1.f,0.f,0.f) }, // Point 1
-    { vec3(-0.5f,0.5f,-0.5f),  255,255,255,255,      vec2(1.f,       1.f), vec3(-1.f,0.f,0.f) }, // Point 2
-    { vec3(-0.5f,-0.5f,-0.5f),  255,255,255,255,     vec2(1.f,       0.f), vec3(-1.f,0.f,0.f) }, // Point 3
-    { vec3(-0.5f,-0.5f,0.5f),  255,255,255,255,      vec2(5.f / 6.f, 0.f), vec3(-1.f,0.f,0.f) }, // Point 4
-    { vec3(-0.5f,0.5f,0.5f),  255,255,255,255,       vec2(5.f / 6.f, 1.f), vec3(-1.f,0.f,0.f) }, // Point 5
-    { vec3(-0.5f,0.5f,-0.5f),  255,255,255,255,      vec2(1.f,       1.f), vec3(-1.f,0.f,0.f) }, // Point 6
-};
\ No newline at end of file
+static_assert( g_CubeVerts.Count() == 36, "Cube should be 6 faces of 2 triangles." );
+static_assert( IsClosedBox( g_CubeVerts, vec3( 0.5f, 0.5f, 0.5f ) ), "Cube faces should lie on their normals and wind consistently." );
+static_assert( IsClosedBox( CreateBoxVerts( vec3( 2.f, 4.f, 6.f ) ), vec3( 1.f, 2.f, 3.f ) ), "Boxes should scale per axis." );
+static_assert( g_CubeVerts.data[35].uv.x == 1.f && g_CubeVerts.data[12].uv.x == 2.f / 6.f, "Each face should take one sixth of the texture." );
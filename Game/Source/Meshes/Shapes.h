@@ -1,9 +1,89 @@
 #pragma once
 
-extern const std::vector<fw::VertexFormat> g_SpriteVerts;
-extern const std::vector<unsigned int> g_SpriteIndices;
+#include "DataTypes.h"
 
-extern const std::vector<fw::VertexFormat> g_BackgroundVerts;
-extern const std::vector<unsigned int> g_BackgroundIndices;
+// Fixed size vertex and index arrays, filled in at compile time by the generators below.
+template<unsigned int N> struct VertexArray
+{
+    fw::VertexFormat data[N];
 
-extern const std::vector<fw::VertexFormat> g_CubeVerts;
\ No newline at end of file
+    constexpr unsigned int Count() const { return N; }
+};
+
+template<unsigned int N> struct IndexArray
+{
+    unsigned int data[N];
+
+    constexpr unsigned int Count() const { return N; }
+};
+
+constexpr fw::VertexFormat CreateVertex(vec3 pos, vec2 uv, vec3 normal)
+{
+    return fw::VertexFormat{ pos, { 255, 255, 255, 255 }, uv, normal };
+}
+
+// Quad facing -z centered on the origin, in bottom left, top left, bottom right, top right order.
+// UVs go from 0 to uvScale, so values above 1 repeat the texture.
+constexpr VertexArray<4> CreateQuadVerts(vec2 size, vec2 uvScale)
+{
+    VertexArray<4> quad = {};
+
+    vec2 half = size / 2;
+    vec3 normal( 0.f, 0.f, -1.f );
+
+    quad.data[0] = CreateVertex( vec3( -half.x, -half.y, 0.f ), vec2( 0.f, 0.f ), normal );
+    quad.data[1] = CreateVertex( vec3( -half.x,  half.y, 0.f ), vec2( 0.f, uvScale.y ), normal );
+    quad.data[2] = CreateVertex( vec3(  half.x, -half.y, 0.f ), vec2( uvScale.x, 0.f ), normal );
+    quad.data[3] = CreateVertex( vec3(  half.x,  half.y, 0.f ), vec2( uvScale.x, uvScale.y ), normal );
+
+    return quad;
+}
+
+// Box centered on the origin, 2 triangles per face and no shared verts, so each face has its own normal.
+// Each face takes one sixth of the texture, left to right in -z, +y, +z, -y, +x, -x order.
+constexpr VertexArray<36> CreateBoxVerts(vec3 size)
+{
+    // Corner the face starts from and the 2 edges leaving it, in units of size.
+    struct Face { vec3 corner; vec3 u; vec3 v; vec3 normal; };
+    const Face faces[6] =
+    {
+        { vec3(-0.5f,-0.5f,-0.5f), vec3( 1, 0, 0), vec3( 0, 1, 0), vec3( 0, 0,-1) },
+        { vec3(-0.5f, 0.5f,-0.5f), vec3( 1, 0, 0), vec3( 0, 0, 1), vec3( 0, 1, 0) },
+        { vec3( 0.5f,-0.5f, 0.5f), vec3(-1, 0, 0), vec3( 0, 1, 0), vec3( 0, 0, 1) },
+        { vec3(-0.5f,-0.5f, 0.5f), vec3( 1, 0, 0), vec3( 0, 0,-1), vec3( 0,-1, 0) },
+        { vec3( 0.5f,-0.5f,-0.5f), vec3( 0, 0, 1), vec3( 0, 1, 0), vec3( 1, 0, 0) },
+        { vec3(-0.5f,-0.5f, 0.5f), vec3( 0, 0,-1), vec3( 0, 1, 0), vec3(-1, 0, 0) },
+    };
+
+    VertexArray<36> box = {};
+
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        const Face& face = faces[i];
+        float u0 = i / 6.f;
+        float u1 = (i + 1) / 6.f;
+
+        fw::VertexFormat a = CreateVertex( face.corner * size,                     vec2( u0, 0.f ), face.normal );
+        fw::VertexFormat b = CreateVertex( (face.corner + face.u + face.v) * size, vec2( u1, 1.f ), face.normal );
+        fw::VertexFormat c = CreateVertex( (face.corner + face.u) * size,          vec2( u1, 0.f ), face.normal );
+        fw::VertexFormat d = CreateVertex( (face.corner + face.v) * size,          vec2( u0, 1.f ), face.normal );
+
+        box.data[i*6 + 0] = a;
+        box.data[i*6 + 1] = b;
+        box.data[i*6 + 2] = c;
+        box.data[i*6 + 3] = a;
+        box.data[i*6 + 4] = d;
+        box.data[i*6 + 5] = b;
+    }
+
+    return box;
+}
+
+// Built at compile time, these live in read only memory and cost nothing at startup.
+constexpr VertexArray<4> g_SpriteVerts = CreateQuadVerts( vec2( 1.f, 1.f ), vec2( 1.f, 1.f ) );
+constexpr IndexArray<6> g_SpriteIndices = { { 0, 1, 2, 2, 1, 3 } };
+
+constexpr VertexArray<4> g_BackgroundVerts = CreateQuadVerts( vec2( 1.f, 1.f ), vec2( 10.f, 1.f ) );
+constexpr IndexArray<6> g_BackgroundIndices = { { 0, 1, 2, 2, 1, 3 } };
+
+constexpr VertexArray<36> g_CubeVerts = CreateBoxVerts( vec3( 1.f, 1.f, 1.f ) );
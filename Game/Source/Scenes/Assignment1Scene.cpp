@@ -10,6 +10,10 @@
 
 Assignment1Scene::Assignment1Scene(Game* pGame) : fw::Scene(pGame)
 {
+	// Components and plain GameObjects made while setting up, including the meteor and debris pools, come out of the scene's arena.
+	m_pArena = new fw::SlabArena("Assignment1Scene");
+	fw::SlabArena::Scope arenaScope(m_pArena);
+
 	pGame->GetFramework()->GetEventManager()->RegisterForEvents(fw::CollisionEvent::GetStaticEventType(), this);
 
 	m_pPhysicsWorld = new fw::PhysicsWorldBox2D(pGame->GetFramework()->GetEventManager());
@@ -27,7 +31,7 @@ Assignment1Scene::Assignment1Scene(Game* pGame) : fw::Scene(pGame)
 	pBackground->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Background"), m_pResourceManager->GetMaterial("Background")));
 	pBackground->SetScale(vec3(18.8f, 0.f, 10.f));
 	pBackground->SetName("Background");
-	m_Objects.push_back(pBackground);
+	AddObject(pBackground);
 
 	SetupPlatform();
 
@@ -39,7 +43,7 @@ Assignment1Scene::Assignment1Scene(Game* pGame) : fw::Scene(pGame)
     pVictory->AddComponent(new fw::PhysicsBodyComponent());
 	pVictory->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(80.0f, 2.0f, 2.0f), 1.f);
 	pVictory->SetName("Victory Box");
-	m_Objects.push_back(pVictory);
+	AddObject(pVictory);
 
 	m_pShaun = new Shaun(this, m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("NiceDaysWalk"), vec2(7.5f, 6.0f), m_pPlayerController);
     m_pShaun->SetSpriteSheet(m_pResourceManager->GetSpriteSheet("NiceDaysWalk"));
@@ -116,18 +120,11 @@ void Assignment1Scene::OnEvent(fw::Event* pEvent)
 			pMeteor->SetState(false);
 			m_pCamera->ShakeCamera();
 
-			std::vector<fw::GameObject*>::iterator it;
-			for (it = m_Objects.begin(); it != m_Objects.end();)
+			// Can collide with more than one thing in a frame, only recycle it once.
+			if (pMeteor->GetHandle().IsValid())
 			{
-				if ((*it) == pMeteor)
-				{
-					m_meteors.push_back(pMeteor);
-					it = m_Objects.erase(it);
-				}
-				else
-				{
-					it++;
-				}
+				m_meteors.push_back(pMeteor);
+				RemoveObject(pMeteor);
 			}
 		}
 		fw::GameObject* pDebris = CheckCollision(pCollisionEvent, "Debris", "Victory Box");
@@ -189,7 +186,7 @@ void Assignment1Scene::Update(float deltaTime)
 				m_meteors.back()->SetPosition(randPos);
 				m_meteors.back()->GetComponent<fw::PhysicsBodyComponent>()->ApplyImpulse(randDirect);
 				m_meteors.back()->GetComponent<fw::PhysicsBodyComponent>()->ApplyTorque(randTorque);
-				m_Objects.push_back(m_meteors.back());
+				AddObject(m_meteors.back());
 				m_meteors.pop_back();
 			}
 			m_meteorTimer = c_meteorSpawnDelay;
@@ -250,7 +247,7 @@ void Assignment1Scene::SpawnDebris(vec3 pos)
 		(*it)->SetPosition(pos);
 		(*it)->GetComponent<fw::PhysicsBodyComponent>()->ApplyImpulse(randDirect);
 		(*it)->GetComponent<fw::PhysicsBodyComponent>()->ApplyTorque(randTorque);
-		m_Objects.push_back((*it));
+		AddObject((*it));
 		it = m_debris.erase(it);
 	}
 
@@ -262,13 +259,14 @@ void Assignment1Scene::SetupPlatform()
 	fw::GameObject* pPlatform = new fw::GameObject(this, c_centerOfScreen + vec3(0.f, -5.f, 0.f), vec3(0.f, 0.f, 0.f));
 	
 	fw::MeshComponent* pPlatformMesh = new fw::MeshComponent(m_pResourceManager->GetMesh("Platform"), m_pResourceManager->GetMaterial("PlatformCenter"));
+	pPlatformMesh->SetOccluder(true);
 	
 	pPlatform->AddComponent(pPlatformMesh);
 	pPlatform->SetScale(vec3(20.f, 2.f, 0.f));
     pPlatform->AddComponent(new fw::PhysicsBodyComponent());
 	pPlatform->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(20.0f, 2.0f, 2.0f), 1.f);
 	pPlatform->SetName("Platform");
-	m_Objects.push_back(pPlatform);
+	AddObject(pPlatform);
 	
 	fw::GameObject* pLeftEdge = new fw::GameObject(this, c_centerOfScreen + vec3(-10.9f, -5.f, 0.f), vec3());
 	
@@ -281,7 +279,7 @@ void Assignment1Scene::SetupPlatform()
     pLeftEdge->AddComponent(new fw::PhysicsBodyComponent());
     pLeftEdge->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(2.0f, 2.0f, 2.0f), 1.f);
 	pLeftEdge->SetName("Platform Left Edge");
-	m_Objects.push_back(pLeftEdge);
+	AddObject(pLeftEdge);
 	
 	fw::GameObject* pRightEdge = new fw::GameObject(this, c_centerOfScreen + vec3(10.9f, -5.f, 0.f), vec3());
 	
@@ -294,7 +292,7 @@ void Assignment1Scene::SetupPlatform()
     pRightEdge->AddComponent(new fw::PhysicsBodyComponent());
     pLeftEdge->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(2.0f, 2.0f, 2.0f), 1.f);
 	pRightEdge->SetName("Platform Right Edge");
-	m_Objects.push_back(pRightEdge);
+	AddObject(pRightEdge);
 }
 
 void Assignment1Scene::FillDebrisPool()
@@ -364,18 +362,15 @@ void Assignment1Scene::FillMeteorPool()
 
 void Assignment1Scene::ResetDebrisPool()
 {
-	std::vector<fw::GameObject*>::iterator it;
-	for (it = m_Objects.begin(); it != m_Objects.end();)
+	// Backwards, removing swaps the last object into the gap.
+	for (size_t i = m_Objects.GetSize(); i > 0; i--)
 	{
-		if ((*it)->GetName() == "Debris")
+		fw::GameObject* pObject = m_Objects[i - 1];
+		if (pObject->GetName() == "Debris")
 		{
-			(*it)->SetState(false);
-			m_debris.push_back((*it));
-			it = m_Objects.erase(it);
-		}
-		else
-		{
-			it++;
+			pObject->SetState(false);
+			m_debris.push_back(pObject);
+			RemoveObject(pObject);
 		}
 	}
 
@@ -385,18 +380,15 @@ void Assignment1Scene::ResetDebrisPool()
 
 void Assignment1Scene::ResetMeteorPool()
 {
-	std::vector<fw::GameObject*>::iterator it;
-	for (it = m_Objects.begin(); it != m_Objects.end();)
+	// Backwards, removing swaps the last object into the gap.
+	for (size_t i = m_Objects.GetSize(); i > 0; i--)
 	{
-		if ((*it)->GetName() == "Meteor")
-		{
-			(*it)->SetState(false);
-			m_meteors.push_back((*it));
-			it = m_Objects.erase(it);
-		}
-		else
+		fw::GameObject* pObject = m_Objects[i - 1];
+		if (pObject->GetName() == "Meteor")
 		{
-			it++;
+			pObject->SetState(false);
+			m_meteors.push_back(pObject);
+			RemoveObject(pObject);
 		}
 	}
 }
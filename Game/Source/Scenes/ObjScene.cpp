@@ -31,7 +31,7 @@ ObjScene::ObjScene(Game* pGame) : fw::Scene(pGame)
     fw::GameObject* pObj= new fw::GameObject(this, pos, vec3());
     pObj->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Obj"), m_pResourceManager->GetMaterial("Arcade_Cabinet")));
 	pObj->SetName("Loaded Obj");
-    m_Objects.push_back(pObj);
+    AddObject(pObj);
 
     m_pResourceManager->GetMesh("Obj")->LoadObj(m_lastObj.c_str(), true);
 
@@ -39,7 +39,7 @@ ObjScene::ObjScene(Game* pGame) : fw::Scene(pGame)
     pFloor->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("Arcade_Floor")));
     pFloor->SetScale(vec3(28.f));
 	pFloor->SetName("Floor");
-    m_Objects.push_back(pFloor);
+    AddObject(pFloor);
 }
 
 ObjScene::~ObjScene()
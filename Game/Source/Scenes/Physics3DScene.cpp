@@ -51,7 +51,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
         pBox->AddComponent(new fw::PhysicsBodyComponent());
         pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
 		pBox->SetName(name);
-		m_Objects.push_back(pBox);
+		AddObject(pBox);
 	}
 
 	//p2p Joint
@@ -61,7 +61,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
 	pBox->AddComponent(new fw::PhysicsBodyComponent());
 	pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
 	pBox->SetName(name);
-	m_Objects.push_back(pBox);
+	AddObject(pBox);
 
 	m_pPhysicsWorld->CreateJoint(pBox->GetComponent<fw::PhysicsBodyComponent>()->GetPhysicsBody(), vec3(0.f, 10.0f, 0.f));
 
@@ -72,7 +72,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
 	pBox->AddComponent(new fw::PhysicsBodyComponent());
 	pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
 	pBox->SetName(name);
-	m_Objects.push_back(pBox);
+	AddObject(pBox);
 
 	m_pPhysicsWorld->CreateSlider(pBox->GetComponent<fw::PhysicsBodyComponent>()->GetPhysicsBody(), vec3(2.f, 0.0f, 0.f));
 
@@ -82,7 +82,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pBox->SetScale(vec3(1.f, 0.25f, 1.f));
     pBox->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("On")));
     pBox->SetName(name);
-    m_Objects.push_back(pBox);
+    AddObject(pBox);
 
     m_pPhysicsWorld->CreateSensor(pBox, pBox->GetTransform(), true);
 
@@ -91,7 +91,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pBox->SetScale(vec3(1.f, 0.25f, 1.f));
     pBox->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Off")));
     pBox->SetName(name);
-    m_Objects.push_back(pBox);
+    AddObject(pBox);
 
     m_pPhysicsWorld->CreateSensor(pBox, pBox->GetTransform(), true);
 
@@ -99,27 +99,27 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     fw::GameObject* pLight = new fw::GameObject(this, vec3(2.f, 10.f, 3.f), vec3(-90.f, 0.f, 0.f));
     pLight->AddComponent(new fw::LightComponent(fw::LightType::SpotLight, Color4f(0.f, 0.f, 0.f, 1.f), 20.f, 2.f, 60.f));
     pLight->SetName("Spot Light");
-    m_Objects.push_back(pLight);
+    AddObject(pLight);
 
     pLight = new fw::GameObject(this, vec3(-9.f, 10.f, -3.f), vec3(-30.f, -90.f, 0.f));
     pLight->AddComponent(new fw::LightComponent(fw::LightType::SpotLight, Color4f(2.f, 2.f, 2.f, 1.f), 40.f, 2.f, 20.f));
     pLight->SetName("Slider Light");
-    m_Objects.push_back(pLight);
+    AddObject(pLight);
 
     pLight = new fw::GameObject(this, vec3(9.f, 10.f, -3.f), vec3());
     pLight->AddComponent(new fw::LightComponent(fw::LightType::PointLight, Color4f(0.2f, 0.f, 0.3f, 1.f), 40.f, 2.f, 20.f));
     pLight->SetName("Area Light");
-    m_Objects.push_back(pLight);
+    AddObject(pLight);
 
     pLight = new fw::GameObject(this, vec3(12.f, 10.f, 3.f), vec3(-90.f, 0.f, 0.f));
     pLight->AddComponent(new fw::LightComponent(fw::LightType::SpotLight, Color4f(1.f, 1.f, 1.f, 1.f), 20.f, 2.f, 60.f));
     pLight->SetName("Joint Light");
-    m_Objects.push_back(pLight);
+    AddObject(pLight);
 
     pLight = new fw::GameObject(this, c_centerOfScreen + vec3(-7.f, 10.f, -7.f), vec3(-45.f, 45.f, 0.f));
     pLight->AddComponent(new fw::LightComponent(fw::LightType::Directional, Color4f(0.5f, 0.5f, 0.5f, 1.f), 10.f, 2.f));
     pLight->SetName("Directional Light");
-    m_Objects.push_back(pLight);
+    AddObject(pLight);
 
     //Platform
 	fw::GameObject* pPlatform = new fw::GameObject(this, c_centerOfScreen + vec3(0.f, -4.5f, 0.f), vec3(0.f, 0.f, 0.f));
@@ -131,7 +131,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pPlatform->AddComponent(new fw::PhysicsBodyComponent());
 	pPlatform->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(25.0f, 0.5f, 15.0f), 0.f);
 	pPlatform->SetName("Platform");
-	m_Objects.push_back(pPlatform);
+	AddObject(pPlatform);
 
     fw::GameObject* pWall = new fw::GameObject(this, c_centerOfScreen + vec3(0.f, -4.5f, 8.f), vec3(0.f, 0.f, 0.f));
     pWall->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-DarkPurple")));
@@ -139,7 +139,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pWall->AddComponent(new fw::PhysicsBodyComponent());
     pWall->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(25.0f, 2.f, 1.0f), 0.f);
     pWall->SetName("Back Wall");
-    m_Objects.push_back(pWall);
+    AddObject(pWall);
 
     pWall = new fw::GameObject(this, c_centerOfScreen + vec3(0.f, -4.5f, -8.f), vec3(0.f, 0.f, 0.f));
     pWall->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-DarkPurple")));
@@ -147,7 +147,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pWall->AddComponent(new fw::PhysicsBodyComponent());
     pWall->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(25.0f, 2.f, 1.0f), 0.f);
     pWall->SetName("Front Wall");
-    m_Objects.push_back(pWall);
+    AddObject(pWall);
 
     pWall = new fw::GameObject(this, c_centerOfScreen + vec3(-13.f, -4.5f, 0.f), vec3(0.f, 0.f, 0.f));
     pWall->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-DarkPurple")));
@@ -155,7 +155,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pWall->AddComponent(new fw::PhysicsBodyComponent());
     pWall->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(1.f, 2.f, 17.f), 0.f);
     pWall->SetName("Left Wall");
-    m_Objects.push_back(pWall);
+    AddObject(pWall);
 
     pWall = new fw::GameObject(this, c_centerOfScreen + vec3(13.f, -4.5f, 0.f), vec3(0.f, 0.f, 0.f));
     pWall->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-DarkPurple")));
@@ -163,7 +163,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     pWall->AddComponent(new fw::PhysicsBodyComponent());
     pWall->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(1.f, 2.f, 17.f), 0.f);
     pWall->SetName("Right Wall");
-    m_Objects.push_back(pWall);
+    AddObject(pWall);
 
     //Player
     m_pPlayer = new fw::GameObject(this, vec2(7.5f, 16.0f), vec3());
@@ -173,6 +173,7 @@ Physics3DScene::Physics3DScene(Game* pGame) : fw::Scene(pGame)
     m_pPlayer->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, 0.5f, 1.f);
     m_pPlayer->AddComponent(new Player3DMovementComponent(m_pPlayerController));
     m_pPlayer->SetName("Player");
+    m_pComponentManager->AddSystem(new Player3DMovementSystem());
 
     m_pCamera->AttachTo(m_pPlayer);
 }
@@ -202,7 +203,7 @@ void Physics3DScene::OnEvent(fw::Event* pEvent)
 
         if (collisObjTwo->GetName() == "Player" && collisObjOne->GetName() == "On Button")
         {
-            for (size_t i = 0; i < m_Objects.size(); i++)
+            for (size_t i = 0; i < m_Objects.GetSize(); i++)
             {
                 if (m_Objects[i]->GetName() == "Spot Light")
                 {
@@ -214,7 +215,7 @@ void Physics3DScene::OnEvent(fw::Event* pEvent)
         }
         else if (collisObjTwo->GetName() == "Player" && collisObjOne->GetName() == "Off Button")
         {
-            for (size_t i = 0; i < m_Objects.size(); i++)
+            for (size_t i = 0; i < m_Objects.GetSize(); i++)
             {
                 if (m_Objects[i]->GetName() == "Spot Light")
                 {
@@ -234,13 +235,6 @@ void Physics3DScene::Update(float deltaTime)
     static_cast<Game*>(m_pGame)->SetUsingCubeMap(true);
     static_cast<Game*>(m_pGame)->SetCurrentCubeMap("NightMeadow");
 
-    std::vector<fw::Component*>& list = m_pComponentManager->GetComponentsOfType(Player3DMovementComponent::GetStaticType());
-    for (fw::Component* pComponent : list)
-    {
-        Player3DMovementComponent* pPlayerComp = static_cast<Player3DMovementComponent*>(pComponent);
-        pPlayerComp->Update(deltaTime);
-    }
-
     Scene::Update(deltaTime);
 
     fw::FWCore* pFramework = static_cast<Game*>(m_pGame)->GetFramework();
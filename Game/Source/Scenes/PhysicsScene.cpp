@@ -25,7 +25,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
 	pBackground->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Background"), m_pResourceManager->GetMaterial("Background")));
 	pBackground->SetScale(vec3(18.8f, 0.f, 10.f));
 	pBackground->SetName("Background");
-	m_Objects.push_back(pBackground);
+	AddObject(pBackground);
 
 	for (int i = 0; i < 6; i++)
 	{
@@ -49,7 +49,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
         pBox->AddComponent(new fw::PhysicsBodyComponent());
         pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
 		pBox->SetName(name);
-		m_Objects.push_back(pBox);
+		AddObject(pBox);
 	}
 
     std::string name = "Jointed Box";
@@ -59,7 +59,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
     pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
     m_pPhysicsWorld->CreateJoint(pBox->GetComponent<fw::PhysicsBodyComponent>()->GetPhysicsBody(), vec3(11.5f, 10.0f, 2.f)); //Kept to Demo
     pBox->SetName(name);
-    m_Objects.push_back(pBox);
+    AddObject(pBox);
 
     pBox = new fw::GameObject(this, vec3(1.5f, 5.f, 2.f), vec3());
     pBox->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Cube")));
@@ -67,7 +67,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
     pBox->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, true, vec3(1.0f, 1.0f, 1.0f), 1.f);
     m_pPhysicsWorld->CreateJoint(pBox->GetComponent<fw::PhysicsBodyComponent>()->GetPhysicsBody(), vec3(1.5f, 10.0f, 2.f)); //Kept to Demo
     pBox->SetName(name);
-    m_Objects.push_back(pBox);
+    AddObject(pBox);
 
 
 
@@ -82,7 +82,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
         pPlatform->AddComponent(new fw::PhysicsBodyComponent());
 		pPlatform->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(20.0f, 2.0f, 2.0f), 1.f);
 		pPlatform->SetName("Platform");
-		m_Objects.push_back(pPlatform);
+		AddObject(pPlatform);
 
 		fw::GameObject* pLeftEdge = new fw::GameObject(this, c_centerOfScreen + vec3(-10.f, -4.5f, 0.f), vec3());
 
@@ -95,7 +95,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
         pLeftEdge->AddComponent(new fw::PhysicsBodyComponent());
 		pLeftEdge->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(2.0f, 2.0f, 2.0f), 1.f);
 		pLeftEdge->SetName("Platform Left Edge");
-		m_Objects.push_back(pLeftEdge);
+		AddObject(pLeftEdge);
 
 		fw::GameObject* pRightEdge = new fw::GameObject(this, c_centerOfScreen + vec3(10.f, -4.5f, 0.f), vec3());
 
@@ -108,7 +108,7 @@ PhysicsScene::PhysicsScene(Game* pGame) : fw::Scene(pGame)
         pRightEdge->AddComponent(new fw::PhysicsBodyComponent());
 		pRightEdge->GetComponent<fw::PhysicsBodyComponent>()->CreateBody(m_pPhysicsWorld, false, vec3(2.0f, 2.0f, 2.0f), 1.f);
 		pRightEdge->SetName("Platform Right Edge");
-		m_Objects.push_back(pRightEdge);
+		AddObject(pRightEdge);
 	}
 
     m_pPlayer = new Player(this, m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("Sokoban"), vec2(7.5f, 11.0f), m_pPlayerController);
@@ -18,13 +18,13 @@ RockPaperScissors::RockPaperScissors(Game* pGame) : fw::Scene(pGame)
     pComputer->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("White")));
     //pComputer->SetScale(vec3(18.8f, 0.f, 10.f));
     pComputer->SetName("Computer");
-    m_Objects.push_back(pComputer);
+    AddObject(pComputer);
 
     fw::GameObject* pPlayer = new fw::GameObject(this, c_centerOfScreen + vec3(1.f, 0.f, 0.f), vec3());
     pPlayer->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("White")));
     //pPlayer->SetScale(vec3(18.8f, 0.f, 10.f));
     pPlayer->SetName("Player");
-    m_Objects.push_back(pPlayer);
+    AddObject(pPlayer);
 }
 
 RockPaperScissors::~RockPaperScissors()
@@ -39,55 +39,55 @@ ThirdPersonScene::ThirdPersonScene(Game* pGame) : fw::Scene(pGame)
     fw::GameObject* pObj= new fw::GameObject(this, pos, vec3());
     pObj->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Obj"), m_pResourceManager->GetMaterial("Lit-Arcade_Cabinet")));
 	pObj->SetName("Loaded Obj");
-    m_Objects.push_back(pObj);
+    AddObject(pObj);
 
     m_pResourceManager->GetMesh("Obj")->LoadObj(m_lastObj.c_str(), true);
 
 	fw::GameObject* pCube = new fw::GameObject(this, c_centerOfScreen + vec3(-10.f, -3.f, 1.f), vec3());
 	pCube->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-White")));
 	pCube->SetName("White Cube");
-	m_Objects.push_back(pCube);
+	AddObject(pCube);
 
 	pCube = new fw::GameObject(this, c_centerOfScreen + vec3(4.f, -3.f, 2.f), vec3());
 	pCube->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-Red")));
 	pCube->SetName("Red Cube");
-	m_Objects.push_back(pCube);
+	AddObject(pCube);
 
 	pCube = new fw::GameObject(this, c_centerOfScreen + vec3(6.f, -3.f, 3.f), vec3());
 	pCube->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Cube"), m_pResourceManager->GetMaterial("Lit-Cube")));
 	pCube->SetName("Textured Cube");
-	m_Objects.push_back(pCube);
+	AddObject(pCube);
 
     //Lights
 	fw::GameObject* pLight = new fw::GameObject(this, c_centerOfScreen + vec3(-7.f, 0.f, 7.f), vec3());
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::PointLight, Color4f(1.f, 0.f, 0.f, 1.f), 25.f, 2.f));
 	pLight->SetName("Red Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
 	pLight = new fw::GameObject(this, c_centerOfScreen + vec3(7.f, 0.f, -7.f), vec3());
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::PointLight, Color4f(0.f, 1.f, 0.f, 1.f), 25.f, 2.f));
 	pLight->SetName("Green Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
 	pLight = new fw::GameObject(this, c_centerOfScreen + vec3(7.f, 0.f, 7.f), vec3());
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::PointLight, Color4f(0.f, 0.f, 1.f, 1.f), 25.f, 2.f));
 	pLight->SetName("Blue Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
 	pLight = new fw::GameObject(this, c_centerOfScreen + vec3(-7.f, 0.f, -7.f), vec3());
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::PointLight, Color4f(1.f, 1.f, 1.f, 1.f), 10.f, 2.f));
 	pLight->SetName("White Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
 	pLight = new fw::GameObject(this, c_centerOfScreen + vec3(-7.f, 10.f, -7.f), vec3());
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::Directional, Color4f(0.025f, 0.025f, 0.025f, 1.f), 10.f, 2.f));
 	pLight->SetName("Directional Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
 	pLight = new fw::GameObject(this, vec3(7.f, 14.f, -7.f), vec3(-45.f,0.f,0.f));
 	pLight->AddComponent(new fw::LightComponent(fw::LightType::SpotLight, Color4f(2.f, 2.f, 2.f, 1.f), 20.f, 2.f, 60.f));
 	pLight->SetName("Spot Light");
-	m_Objects.push_back(pLight);
+	AddObject(pLight);
 
     fw::GameObject* pPlayer = new fw::GameObject(this, vec3(7.5f, 5.f, -7.5f), vec3());
     pPlayer->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Sphere"), m_pResourceManager->GetMaterial("Lit-White")));
@@ -97,7 +97,8 @@ ThirdPersonScene::ThirdPersonScene(Game* pGame) : fw::Scene(pGame)
     //pPlayer->SetScale(vec3(0.1f, 0.1f, 0.1f));
     pPlayer->AddComponent(new SimplePlayerMovementComponent(m_pPlayerController));
 	pPlayer->SetName("Player");
-	m_Objects.push_back(pPlayer);
+	AddObject(pPlayer);
+    m_pComponentManager->AddSystem(new SimplePlayerMovementSystem());
 	
 	m_pCamera->AttachTo(pPlayer);
 
@@ -105,7 +106,7 @@ ThirdPersonScene::ThirdPersonScene(Game* pGame) : fw::Scene(pGame)
     pFloor->AddComponent(new fw::MeshComponent(m_pResourceManager->GetMesh("Sprite"), m_pResourceManager->GetMaterial("Lit-SolidColor")));
     pFloor->SetScale(vec3(28.f));
 	pFloor->SetName("Floor");
-    m_Objects.push_back(pFloor);
+    AddObject(pFloor);
 }
 
 ThirdPersonScene::~ThirdPersonScene()
@@ -125,13 +126,6 @@ void ThirdPersonScene::Update(float deltaTime)
 {
     static_cast<Game*>(m_pGame)->SetUsingCubeMap(false);
 
-    std::vector<fw::Component*>& list = m_pComponentManager->GetComponentsOfType(SimplePlayerMovementComponent::GetStaticType());
-    for (fw::Component* pComponent : list)
-    {
-        SimplePlayerMovementComponent* pPlayerComp = static_cast<SimplePlayerMovementComponent*>(pComponent);
-        pPlayerComp->Update(deltaTime);
-    }
-
     Scene::Update(deltaTime);
 
 	fw::FWCore* pFramework = static_cast<Game*>(m_pGame)->GetFramework();
@@ -170,7 +164,7 @@ void ThirdPersonScene::Update(float deltaTime)
     }
 
     m_Objects[0]->SetRotation(vec3(m_Objects[0]->GetRotation().x, rot + offset, m_Objects[0]->GetRotation().z));
-    m_Objects.back()->SetRotation(vec3(-90.f, rot + offset, 0.f));
+    m_Objects[m_Objects.GetSize() - 1]->SetRotation(vec3(-90.f, rot + offset, 0.f));
 }
 
 void ThirdPersonScene::Slider(float& rot)
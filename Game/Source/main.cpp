@@ -3,8 +3,114 @@
 #include "Game.h"
 #include "DefaultSettings.h"
 
+#include <sstream>
+
+// Command line options for automated performance runs, i.e.
+//     -benchmark Cube -frames 600 -dt 0.0166 -backend nullshim -report Cube.json
+// -backend is one of native, recording or nullshim (no window, no GL context, the only choice outside of Windows).
+struct CommandLineOptions
+{
+    bool benchmark = false;
+    std::string scene;
+#if _WIN32
+    fw::GLBackend backend = fw::GLBackend::Recording;
+#else
+    fw::GLBackend backend = fw::GLBackend::NullShim;
+#endif
+    fw::BenchmarkSettings settings;
+};
+
+CommandLineOptions ParseCommandLine(const std::vector<std::string>& args)
+{
+    CommandLineOptions options;
+
+    for( size_t i=0; i<args.size(); i++ )
+    {
+        const std::string& arg = args[i];
+        std::string value = i + 1 < args.size() ? args[i + 1] : "";
+
+        if( arg == "-benchmark" )
+        {
+            options.benchmark = true;
+            options.scene = value;
+            i++;
+        }
+        else if( arg == "-frames" )
+        {
+            options.settings.numFrames = static_cast<unsigned int>( atoi( value.c_str() ) );
+            i++;
+        }
+        else if( arg == "-dt" )
+        {
+            options.settings.deltaTime = static_cast<float>( atof( value.c_str() ) );
+            i++;
+        }
+        else if( arg == "-report" )
+        {
+            options.settings.reportFilename = value;
+            i++;
+        }
+        else if( arg == "-backend" )
+        {
+            if( value == "native" )
+                options.backend = fw::GLBackend::Native;
+            else if( value == "nullshim" )
+                options.backend = fw::GLBackend::NullShim;
+            else
+                options.backend = fw::GLBackend::Recording;
+            i++;
+        }
+    }
+
+    options.settings.label = options.scene;
+
+    return options;
+}
+
+// Runs options.scene for a fixed number of frames and writes the report, returns the process exit code.
+int RunBenchmark(const CommandLineOptions& options)
+{
+    // Fixed seed so every run spawns the same objects.
+    fw::Random::SetSeed( 0 );
+
+    fw::FWCore fwCore( c_windowSize.x, c_windowSize.y, options.backend );
+
+    int result = 1;
+
+    // Scoped so the game is gone before the recorder is uninstalled.
+    {
+        Game game( fwCore );
+
+        if( game.HasScene( options.scene ) )
+        {
+            game.SetCurrentScene( options.scene );
+            result = fwCore.RunBenchmark( game, options.settings );
+        }
+        else
+        {
+            fw::OutputMessage( "Unknown scene: %s\n", options.scene.c_str() );
+        }
+    }
+
+    fwCore.Shutdown();
+
+    return result;
+}
+
+#if _WIN32
 int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPSTR lpCmdLine, _In_ int nCmdShow)
 {
+    std::vector<std::string> args;
+    std::istringstream stream( lpCmdLine ? lpCmdLine : "" );
+    std::string arg;
+    while( stream >> arg )
+        args.push_back( arg );
+
+    CommandLineOptions options = ParseCommandLine( args );
+
+    if( options.benchmark )
+        return RunBenchmark( options );
+
     {
         fw::FWCore fwCore(c_windowSize.x, c_windowSize.y);
 
@@ -18,3 +124,19 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
         fwCore.Shutdown();
     }
 }
+#else
+// No window outside of Windows, only benchmark runs, i.e.
+//     GameProject -benchmark Cube -frames 600 -report Cube.json
+int main(int argc, char** argv)
+{
+    CommandLineOptions options = ParseCommandLine( std::vector<std::string>( argv + 1, argv + argc ) );
+
+    if( options.benchmark == false )
+    {
+        fw::OutputMessage( "Usage: GameProject -benchmark <scene> [-frames <count>] [-dt <seconds>] [-report <file>]\n" );
+        return 1;
+    }
+
+    return RunBenchmark( options );
+}
+#endif